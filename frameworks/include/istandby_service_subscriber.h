@@ -18,11 +18,23 @@
 
 #include <iremote_broker.h>
 #include <nocopyable.h>
+#include <string>
+#include <vector>
 
 #include "refbase.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
+/**
+ * @brief net change of the allow types of a uid and process name.
+ */
+struct AllowListChange {
+    int32_t uid_ {0};
+    std::string name_ {""};
+    uint32_t allowType_ {0};
+    bool added_ {false};
+};
+
 class IStandbyServiceSubscriber : public IRemoteBroker {
 public:
     IStandbyServiceSubscriber() = default;
@@ -47,6 +59,19 @@ public:
      */
     virtual void OnAllowListChanged(int32_t uid, const std::string& name, uint32_t allowType, bool added) = 0;
 
+    /**
+     * @brief report a batch of allow list changes to subscriber, by default each change is reported by
+     * OnAllowListChanged.
+     *
+     * @param changes net changes of allow list, added and removed types of the same uid are reported separately.
+     */
+    virtual void OnAllowListChangedBatch(const std::vector<AllowListChange>& changes)
+    {
+        for (const auto& change : changes) {
+            OnAllowListChanged(change.uid_, change.name_, change.allowType_, change.added_);
+        }
+    }
+
     /**
      * @brief report change of restrict list to subscriber.
      *
@@ -27,6 +27,7 @@ namespace DevStandbyMgr {
         ON_POWER_OVERUSED,
         ON_RESTRICT_LIST_CHANGED,
         ON_ACTION_CHANGED,
+        ON_ALLOW_LIST_CHANGED_BATCH,
     };
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
@@ -47,6 +47,13 @@ public:
      */
     void OnAllowListChanged(int32_t uid, const std::string& name, uint32_t allowType, bool added) override;
 
+    /**
+     * @brief report a batch of allow list changes to subscriber with one ipc call.
+     *
+     * @param changes net changes of allow list.
+     */
+    void OnAllowListChangedBatch(const std::vector<AllowListChange>& changes) override;
+
     /**
      * @brief report change of restrict list to subscriber.
      *
@@ -73,6 +80,10 @@ public:
      */
     void OnActionChanged(const std::string& module, uint32_t action) override;
 
+private:
+    void SendAllowListChangedBatch(const sptr<IRemoteObject>& remote, const std::vector<AllowListChange>& changes,
+        size_t begin, size_t end);
+
 private:
     static inline BrokerDelegator<StandbyServiceSubscriberProxy> delegator_;
 };
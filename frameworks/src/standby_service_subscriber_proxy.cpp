@@ -15,6 +15,7 @@
 
 #include "standby_service_subscriber_proxy.h"
 
+#include <algorithm>
 #include <message_parcel.h>
 
 #include "standby_service_errors.h"
@@ -23,6 +24,11 @@
 
 namespace OHOS {
 namespace DevStandbyMgr {
+namespace {
+    // well below the number accepted by the stub, so that a parcel also fits in the async transaction buffer
+    constexpr size_t MAX_ALLOW_LIST_CHANGE_NUM_PER_PARCEL = 1000;
+}
+
 StandbyServiceSubscriberProxy::StandbyServiceSubscriberProxy(const sptr<IRemoteObject>& impl)
     : IRemoteProxy<IStandbyServiceSubscriber>(impl) {}
 StandbyServiceSubscriberProxy::~StandbyServiceSubscriberProxy() {}
@@ -83,6 +89,51 @@ void StandbyServiceSubscriberProxy::OnAllowListChanged(int32_t uid, const std::s
     }
 }
 
+void StandbyServiceSubscriberProxy::OnAllowListChangedBatch(const std::vector<AllowListChange>& changes)
+{
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        STANDBYSERVICE_LOGW("OnAllowListChangedBatch remote is dead.");
+        return;
+    }
+    // a diff of any size is split into parcels the stub accepts and the async buffer can hold
+    for (size_t begin = 0; begin < changes.size(); begin += MAX_ALLOW_LIST_CHANGE_NUM_PER_PARCEL) {
+        size_t end = std::min(changes.size(), begin + MAX_ALLOW_LIST_CHANGE_NUM_PER_PARCEL);
+        SendAllowListChangedBatch(remote, changes, begin, end);
+    }
+}
+
+void StandbyServiceSubscriberProxy::SendAllowListChangedBatch(const sptr<IRemoteObject>& remote,
+    const std::vector<AllowListChange>& changes, size_t begin, size_t end)
+{
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(StandbyServiceSubscriberProxy::GetDescriptor())) {
+        STANDBYSERVICE_LOGW("OnAllowListChangedBatch write interface token failed.");
+        return;
+    }
+
+    if (!data.WriteUint32(static_cast<uint32_t>(end - begin))) {
+        STANDBYSERVICE_LOGW("OnAllowListChangedBatch write notification failed.");
+        return;
+    }
+    for (size_t index = begin; index < end; ++index) {
+        const auto& change = changes[index];
+        if (!data.WriteInt32(change.uid_) || !data.WriteString(change.name_) ||
+            !data.WriteUint32(change.allowType_) || !data.WriteBool(change.added_)) {
+            STANDBYSERVICE_LOGW("OnAllowListChangedBatch write notification failed.");
+            return;
+        }
+    }
+
+    MessageParcel reply;
+    MessageOption option = {MessageOption::TF_ASYNC};
+    int32_t ret = remote->SendRequest(
+        static_cast<uint32_t>(StandbySubscriberInterfaceCode::ON_ALLOW_LIST_CHANGED_BATCH), data, reply, option);
+    if (ret!= ERR_OK) {
+        STANDBYSERVICE_LOGE("OnAllowListChangedBatch SendRequest failed, error code: %d", ret);
+    }
+}
+
 void StandbyServiceSubscriberProxy::OnRestrictListChanged(int32_t uid, const std::string& name, uint32_t allowType,
     bool added)
 {
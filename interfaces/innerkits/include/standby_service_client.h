@@ -23,6 +23,7 @@
 #include "allow_info.h"
 #include "resource_request.h"
 #include "standby_service_errors.h"
+#include "standby_state_page.h"
 #include "istandby_service_subscriber.h"
 
 namespace OHOS {
@@ -83,6 +84,22 @@ public:
      */
     ErrCode UnapplyAllowResource(const sptr<ResourceRequest>& resourceRequest);
 
+    /**
+     * @brief add allow list for a batch of services or apps with one ipc call.
+     *
+     * @param resourceRequests resources to be added.
+     * @return ErrCode ERR_OK if success, others if fail, none of the resources is added if fail.
+     */
+    ErrCode ApplyAllowResourceBatch(const std::vector<sptr<ResourceRequest>>& resourceRequests);
+
+    /**
+     * @brief remove a batch of uids with allow type from allow list with one ipc call.
+     *
+     * @param resourceRequests resources to be removed.
+     * @return ErrCode ERR_OK if success, others if fail, none of the resources is removed if fail.
+     */
+    ErrCode UnapplyAllowResourceBatch(const std::vector<sptr<ResourceRequest>>& resourceRequests);
+
     /**
      * @brief Get the Allow List object.
      *
@@ -141,6 +158,17 @@ public:
      */
     ErrCode IsDeviceInStandby(bool& isStandby);
 
+    /**
+     * @brief block until the standby state changes, the state is read from the state page shared by the service.
+     *
+     * @param generation generation of the state known by the caller, 0 if none. Updated to the current one, left
+     * unchanged if timeout.
+     * @param isStandby true if device in standby, else false.
+     * @param timeoutMs max time to wait in milliseconds.
+     * @return ErrCode ERR_OK if success, ERR_STANDBY_OBJECT_NOT_EXIST if the state page is not available.
+     */
+    ErrCode WaitForStandbyStateChange(uint32_t& generation, bool& isStandby, int64_t timeoutMs);
+
     /**
      * @brief set nat timeout interval;
      *
@@ -206,7 +234,11 @@ public:
 
 private:
     bool GetStandbyServiceProxy();
+    // map the state page on first use, return nullptr if the service does not provide it
+    std::shared_ptr<StandbyStatePage> GetStandbyStatePage();
     void ResetStandbyServiceClient();
+    bool GetResourceRequestList(const std::vector<sptr<ResourceRequest>>& resourceRequests,
+        std::vector<ResourceRequest>& requestList);
 
     class StandbyServiceDeathRecipient : public IRemoteObject::DeathRecipient {
     public:
@@ -224,6 +256,8 @@ private:
     std::mutex mutex_;
     sptr<IStandbyService> standbyServiceProxy_;
     sptr<StandbyServiceDeathRecipient> deathRecipient_;
+    std::shared_ptr<StandbyStatePage> statePage_ {nullptr};
+    bool isStatePageUnavailable_ {false};
 };
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
@@ -48,6 +48,7 @@ public:
 private:
     ErrCode HandleOnDeviceIdleMode(MessageParcel& data);
     ErrCode HandleOnAllowListChanged(MessageParcel& data);
+    ErrCode HandleOnAllowListChangedBatch(MessageParcel& data);
     ErrCode HandleOnRestrictListChanged(MessageParcel& data);
     ErrCode HandleOnPowerOverused(MessageParcel& data);
     ErrCode HandleOnActionChanged(MessageParcel& data);
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_INTERFACES_INNERKITS_INCLUDE_STANDBY_STATE_PAGE_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_INTERFACES_INNERKITS_INCLUDE_STANDBY_STATE_PAGE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+struct StandbyStateRecord {
+    uint32_t state_ {0};
+    uint32_t phase_ {0};
+    // day and night condition of TimeProvider
+    uint32_t condition_ {0};
+    // increased every time the record is written
+    uint32_t generation_ {0};
+};
+
+/**
+ * @brief one shared memory page holding the latest standby state, written by the service and mapped read-only by
+ * clients, so that state queries do not cost an ipc.
+ *
+ * The record is protected by a seqlock, readers retry when they race with the writer. The generation is also a
+ * futex word, clients can block until it changes instead of polling.
+ */
+class StandbyStatePage {
+public:
+    DISALLOW_COPY_AND_MOVE(StandbyStatePage);
+    StandbyStatePage() = default;
+    ~StandbyStatePage();
+
+    /**
+     * @brief create a page for writing, the fd of the page is sealed so that others can only map it read-only.
+     *
+     * @return nullptr if the page can not be sealed, clients fall back to ipc then.
+     */
+    static std::shared_ptr<StandbyStatePage> Create();
+
+    /**
+     * @brief map the page created by the service for reading.
+     *
+     * @param fd fd of the page, the caller keeps the ownership.
+     */
+    static std::shared_ptr<StandbyStatePage> Map(int32_t fd);
+
+    // only the process which created the page writes it, concurrent writers must be serialized by the caller
+    void Write(uint32_t state, uint32_t phase, uint32_t condition);
+
+    // withdraw the record when the service is no longer ready, readers fail until the next write
+    void Unpublish();
+
+    /**
+     * @brief read a consistent record, retrying a bounded number of times while a write is in progress.
+     *
+     * @return false if nothing is published or no consistent record is read, the caller falls back to ipc.
+     */
+    bool Read(StandbyStateRecord& record) const;
+
+    /**
+     * @brief block until the generation differs from the given one.
+     *
+     * @return true if the generation changed before timeout.
+     */
+    bool WaitForChange(uint32_t generation, int64_t timeoutMs) const;
+
+    int32_t GetFd() const;
+
+private:
+    struct Layout {
+        std::atomic<uint32_t> magic_;
+        std::atomic<uint32_t> version_;
+        // odd while the record is being written
+        std::atomic<uint32_t> sequence_;
+        std::atomic<uint32_t> generation_;
+        std::atomic<uint32_t> state_;
+        std::atomic<uint32_t> phase_;
+        std::atomic<uint32_t> condition_;
+        // zero before the first write and after the record is withdrawn
+        std::atomic<uint32_t> isPublished_;
+    };
+
+    Layout* layout_ {nullptr};
+    // only kept by the writer
+    int32_t fd_ {-1};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_INTERFACES_INNERKITS_INCLUDE_STANDBY_STATE_PAGE_H
@@ -16,12 +16,14 @@
 #include "standby_service_client.h"
 
 #include <message_parcel.h>
+#include <unistd.h>
 
 #include "iservice_registry.h"
 #include "system_ability_definition.h"
 #include "standby_service_errors.h"
 #include "standby_service_log.h"
 #include "standby_service_proxy.h"
+#include "standby_state.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
@@ -95,6 +97,52 @@ ErrCode StandbyServiceClient::UnapplyAllowResource(const sptr<ResourceRequest>&
     return standbyServiceProxy_->UnapplyAllowResource(request);
 }
 
+ErrCode StandbyServiceClient::ApplyAllowResourceBatch(const std::vector<sptr<ResourceRequest>>& resourceRequests)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!GetStandbyServiceProxy()) {
+        STANDBYSERVICE_LOGE("get standby service proxy failed");
+        return ERR_STANDBY_SERVICE_NOT_CONNECTED;
+    }
+    std::vector<ResourceRequest> requestList;
+    if (!GetResourceRequestList(resourceRequests, requestList)) {
+        return ERR_STANDBY_INVALID_PARAM;
+    }
+    return standbyServiceProxy_->ApplyAllowResourceBatch(requestList);
+}
+
+ErrCode StandbyServiceClient::UnapplyAllowResourceBatch(const std::vector<sptr<ResourceRequest>>& resourceRequests)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!GetStandbyServiceProxy()) {
+        STANDBYSERVICE_LOGE("get standby service proxy failed");
+        return ERR_STANDBY_SERVICE_NOT_CONNECTED;
+    }
+    std::vector<ResourceRequest> requestList;
+    if (!GetResourceRequestList(resourceRequests, requestList)) {
+        return ERR_STANDBY_INVALID_PARAM;
+    }
+    return standbyServiceProxy_->UnapplyAllowResourceBatch(requestList);
+}
+
+bool StandbyServiceClient::GetResourceRequestList(const std::vector<sptr<ResourceRequest>>& resourceRequests,
+    std::vector<ResourceRequest>& requestList)
+{
+    if (resourceRequests.empty()) {
+        STANDBYSERVICE_LOGE("resource request list is empty");
+        return false;
+    }
+    requestList.reserve(resourceRequests.size());
+    for (const auto& resourceRequest : resourceRequests) {
+        if (resourceRequest == nullptr) {
+            STANDBYSERVICE_LOGE("resource request is nullptr");
+            return false;
+        }
+        requestList.emplace_back(*resourceRequest.GetRefPtr());
+    }
+    return true;
+}
+
 ErrCode StandbyServiceClient::GetAllowList(uint32_t allowType, std::vector<AllowInfo>& allowInfoArray,
     uint32_t reasonCode)
 {
@@ -117,9 +165,56 @@ ErrCode StandbyServiceClient::IsDeviceInStandby(bool& isStandby)
         STANDBYSERVICE_LOGE("get standby service proxy failed");
         return ERR_STANDBY_SERVICE_NOT_CONNECTED;
     }
+    StandbyStateRecord record;
+    if (auto statePage = GetStandbyStatePage(); statePage != nullptr && statePage->Read(record)) {
+        isStandby = (record.state_ == StandbyState::SLEEP);
+        return ERR_OK;
+    }
     return standbyServiceProxy_->IsDeviceInStandby(isStandby);
 }
 
+ErrCode StandbyServiceClient::WaitForStandbyStateChange(uint32_t& generation, bool& isStandby, int64_t timeoutMs)
+{
+    std::shared_ptr<StandbyStatePage> statePage {nullptr};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!GetStandbyServiceProxy()) {
+            STANDBYSERVICE_LOGE("get standby service proxy failed");
+            return ERR_STANDBY_SERVICE_NOT_CONNECTED;
+        }
+        statePage = GetStandbyStatePage();
+    }
+    if (statePage == nullptr) {
+        return ERR_STANDBY_OBJECT_NOT_EXIST;
+    }
+    // the page is kept alive by the local reference even if the service dies while waiting
+    statePage->WaitForChange(generation, timeoutMs);
+    StandbyStateRecord record;
+    if (!statePage->Read(record)) {
+        return ERR_STANDBY_SYS_NOT_READY;
+    }
+    generation = record.generation_;
+    isStandby = (record.state_ == StandbyState::SLEEP);
+    return ERR_OK;
+}
+
+std::shared_ptr<StandbyStatePage> StandbyServiceClient::GetStandbyStatePage()
+{
+    if (statePage_ != nullptr || isStatePageUnavailable_) {
+        return statePage_;
+    }
+    int32_t fd = -1;
+    if (standbyServiceProxy_->GetStandbyStatePage(fd) != ERR_OK || fd < 0) {
+        STANDBYSERVICE_LOGW("standby state page is unavailable, query state by ipc");
+        isStatePageUnavailable_ = true;
+        return nullptr;
+    }
+    statePage_ = StandbyStatePage::Map(fd);
+    close(fd);
+    isStatePageUnavailable_ = (statePage_ == nullptr);
+    return statePage_;
+}
+
 ErrCode StandbyServiceClient::SetNatInterval(uint32_t& type, bool& enable, uint32_t& interval)
 {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -282,6 +377,9 @@ void StandbyServiceClient::ResetStandbyServiceClient()
         standbyServiceProxy_->AsObject()->RemoveDeathRecipient(deathRecipient_);
     }
     standbyServiceProxy_ = nullptr;
+    // the page of the dead service is no longer written, map the new one after reconnecting
+    statePage_ = nullptr;
+    isStatePageUnavailable_ = false;
 }
 
 StandbyServiceClient::StandbyServiceDeathRecipient::StandbyServiceDeathRecipient(
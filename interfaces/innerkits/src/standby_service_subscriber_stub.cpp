@@ -23,6 +23,10 @@
 
 namespace OHOS {
 namespace DevStandbyMgr {
+namespace {
+    constexpr uint32_t MAX_ALLOW_LIST_CHANGE_NUM = 10000;
+}
+
 StandbyServiceSubscriberStub::~StandbyServiceSubscriberStub() {}
 
 ErrCode StandbyServiceSubscriberStub::OnRemoteRequest(uint32_t code,
@@ -57,6 +61,9 @@ ErrCode StandbyServiceSubscriberStub::OnRemoteRequestInner(uint32_t code,
         case (static_cast<uint32_t>(StandbySubscriberInterfaceCode::ON_ACTION_CHANGED)): {
             return HandleOnActionChanged(data);
         }
+        case (static_cast<uint32_t>(StandbySubscriberInterfaceCode::ON_ALLOW_LIST_CHANGED_BATCH)): {
+            return HandleOnAllowListChangedBatch(data);
+        }
         default:
             return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
     }
@@ -107,6 +114,25 @@ ErrCode StandbyServiceSubscriberStub::HandleOnAllowListChanged(MessageParcel& da
     return ERR_OK;
 }
 
+ErrCode StandbyServiceSubscriberStub::HandleOnAllowListChangedBatch(MessageParcel& data)
+{
+    uint32_t changeNum {0};
+    if (!data.ReadUint32(changeNum) || changeNum > MAX_ALLOW_LIST_CHANGE_NUM) {
+        STANDBYSERVICE_LOGW("HandleOnAllowListChangedBatch Read parcel failed.");
+        return ERR_INVALID_DATA;
+    }
+    std::vector<AllowListChange> changes(changeNum);
+    for (auto& change : changes) {
+        if (!data.ReadInt32(change.uid_) || !data.ReadString(change.name_) ||
+            !data.ReadUint32(change.allowType_) || !data.ReadBool(change.added_)) {
+            STANDBYSERVICE_LOGW("HandleOnAllowListChangedBatch Read parcel failed.");
+            return ERR_INVALID_DATA;
+        }
+    }
+    OnAllowListChangedBatch(changes);
+    return ERR_OK;
+}
+
 ErrCode StandbyServiceSubscriberStub::HandleOnRestrictListChanged(MessageParcel& data)
 {
     int32_t uid {0};
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "standby_state_page.h"
+
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+#include "standby_service_log.h"
+
+#ifndef F_SEAL_FUTURE_WRITE
+#define F_SEAL_FUTURE_WRITE 0x0010
+#endif
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+    constexpr uint32_t PAGE_MAGIC = 0x50535453;  // "STSP"
+    // bump when the layout of the page changes
+    constexpr uint32_t PAGE_VERSION = 2;
+    constexpr size_t PAGE_SIZE_BYTES = 4096;
+    const char* const PAGE_NAME = "standby_state_page";
+    constexpr uint32_t MAX_SPIN_TIMES = 64;
+    // a writer dead or stopped in the middle of a write leaves the sequence odd, the reader gives up after it
+    constexpr uint32_t MAX_READ_TIMES = MAX_SPIN_TIMES + 64;
+    constexpr int64_t MSEC_PER_SEC = 1000;
+    constexpr int64_t NSEC_PER_MSEC = 1000000;
+
+    int64_t FutexWait(const std::atomic<uint32_t>* addr, uint32_t expected, const struct timespec* timeout)
+    {
+        // not private, the word is shared by processes mapping the same page
+        return syscall(SYS_futex, reinterpret_cast<const uint32_t*>(addr), FUTEX_WAIT, expected, timeout,
+            nullptr, 0);
+    }
+
+    void FutexWakeAll(std::atomic<uint32_t>* addr)
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+
+    int64_t GetMonotonicTimeMs()
+    {
+        struct timespec now {};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<int64_t>(now.tv_sec) * MSEC_PER_SEC + now.tv_nsec / NSEC_PER_MSEC;
+    }
+}
+
+StandbyStatePage::~StandbyStatePage()
+{
+    if (layout_ != nullptr) {
+        munmap(static_cast<void*>(layout_), PAGE_SIZE_BYTES);
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+std::shared_ptr<StandbyStatePage> StandbyStatePage::Create()
+{
+    int32_t fd = memfd_create(PAGE_NAME, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) {
+        STANDBYSERVICE_LOGE("failed to create standby state page, errno: %{public}d", errno);
+        return nullptr;
+    }
+    if (ftruncate(fd, PAGE_SIZE_BYTES) != 0) {
+        STANDBYSERVICE_LOGE("failed to resize standby state page, errno: %{public}d", errno);
+        close(fd);
+        return nullptr;
+    }
+    void* addr = mmap(nullptr, PAGE_SIZE_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        STANDBYSERVICE_LOGE("failed to map standby state page, errno: %{public}d", errno);
+        close(fd);
+        return nullptr;
+    }
+    // the mapping above stays writable, mappings created from now on can only be read-only.
+    // without the future write seal any client could map the fd writable, so the page is not handed out at all
+    if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_FUTURE_WRITE | F_SEAL_SEAL) != 0) {
+        STANDBYSERVICE_LOGE("failed to seal standby state page, errno: %{public}d", errno);
+        munmap(addr, PAGE_SIZE_BYTES);
+        close(fd);
+        return nullptr;
+    }
+    auto statePage = std::make_shared<StandbyStatePage>();
+    statePage->fd_ = fd;
+    statePage->layout_ = new (addr) Layout {};
+    statePage->layout_->version_.store(PAGE_VERSION, std::memory_order_relaxed);
+    statePage->layout_->magic_.store(PAGE_MAGIC, std::memory_order_release);
+    return statePage;
+}
+
+std::shared_ptr<StandbyStatePage> StandbyStatePage::Map(int32_t fd)
+{
+    struct stat pageStat {};
+    if (fd < 0 || fstat(fd, &pageStat) != 0 || pageStat.st_size < static_cast<off_t>(PAGE_SIZE_BYTES)) {
+        STANDBYSERVICE_LOGE("standby state page is invalid");
+        return nullptr;
+    }
+    void* addr = mmap(nullptr, PAGE_SIZE_BYTES, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        STANDBYSERVICE_LOGE("failed to map standby state page, errno: %{public}d", errno);
+        return nullptr;
+    }
+    auto* layout = static_cast<Layout*>(addr);
+    if (layout->magic_.load(std::memory_order_acquire) != PAGE_MAGIC ||
+        layout->version_.load(std::memory_order_relaxed) != PAGE_VERSION) {
+        STANDBYSERVICE_LOGE("layout of standby state page mismatch");
+        munmap(addr, PAGE_SIZE_BYTES);
+        return nullptr;
+    }
+    auto statePage = std::make_shared<StandbyStatePage>();
+    statePage->layout_ = layout;
+    return statePage;
+}
+
+void StandbyStatePage::Write(uint32_t state, uint32_t phase, uint32_t condition)
+{
+    uint32_t sequence = layout_->sequence_.load(std::memory_order_relaxed);
+    layout_->sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    layout_->state_.store(state, std::memory_order_relaxed);
+    layout_->phase_.store(phase, std::memory_order_relaxed);
+    layout_->condition_.store(condition, std::memory_order_relaxed);
+    layout_->isPublished_.store(1, std::memory_order_relaxed);
+    layout_->generation_.fetch_add(1, std::memory_order_relaxed);
+    layout_->sequence_.store(sequence + 2, std::memory_order_release);
+    FutexWakeAll(&layout_->generation_);
+}
+
+void StandbyStatePage::Unpublish()
+{
+    // the sequence keeps increasing, resetting it would let a racing reader take a stale record as consistent
+    uint32_t sequence = layout_->sequence_.load(std::memory_order_relaxed);
+    layout_->sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    layout_->isPublished_.store(0, std::memory_order_relaxed);
+    layout_->generation_.fetch_add(1, std::memory_order_relaxed);
+    layout_->sequence_.store(sequence + 2, std::memory_order_release);
+    FutexWakeAll(&layout_->generation_);
+}
+
+bool StandbyStatePage::Read(StandbyStateRecord& record) const
+{
+    for (uint32_t times = 0; times < MAX_READ_TIMES; ++times) {
+        uint32_t sequence = layout_->sequence_.load(std::memory_order_acquire);
+        if ((sequence & 1) == 0) {
+            record.state_ = layout_->state_.load(std::memory_order_relaxed);
+            record.phase_ = layout_->phase_.load(std::memory_order_relaxed);
+            record.condition_ = layout_->condition_.load(std::memory_order_relaxed);
+            record.generation_ = layout_->generation_.load(std::memory_order_relaxed);
+            bool isPublished = (layout_->isPublished_.load(std::memory_order_relaxed) != 0);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (layout_->sequence_.load(std::memory_order_relaxed) == sequence) {
+                return isPublished;
+            }
+        }
+        // the writer may be preempted in the middle of a write
+        if (times >= MAX_SPIN_TIMES) {
+            std::this_thread::yield();
+        }
+    }
+    return false;
+}
+
+bool StandbyStatePage::WaitForChange(uint32_t generation, int64_t timeoutMs) const
+{
+    int64_t deadline = GetMonotonicTimeMs() + timeoutMs;
+    while (layout_->generation_.load(std::memory_order_acquire) == generation) {
+        int64_t remainTime = deadline - GetMonotonicTimeMs();
+        if (remainTime <= 0) {
+            return false;
+        }
+        struct timespec timeout {};
+        timeout.tv_sec = static_cast<time_t>(remainTime / MSEC_PER_SEC);
+        timeout.tv_nsec = static_cast<long>((remainTime % MSEC_PER_SEC) * NSEC_PER_MSEC);
+        if (FutexWait(&layout_->generation_, generation, &timeout) != 0 && errno != EAGAIN && errno != EINTR &&
+            errno != ETIMEDOUT) {
+            STANDBYSERVICE_LOGE("failed to wait for standby state page, errno: %{public}d", errno);
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t StandbyStatePage::GetFd() const
+{
+    return fd_;
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
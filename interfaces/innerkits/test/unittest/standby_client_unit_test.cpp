@@ -12,10 +12,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <atomic>
 #include <functional>
 #include <chrono>
 #include <thread>
+#include <vector>
 #include <message_parcel.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include "gtest/gtest.h"
 #include "singleton.h"
@@ -29,11 +33,22 @@
 #include "standby_service_proxy.h"
 #include "standby_service_subscriber_stub.h"
 #include "standby_service_subscriber_proxy.h"
+#include "standby_state_page.h"
 
 using namespace testing::ext;
 
 namespace OHOS {
 namespace DevStandbyMgr {
+class BatchRecordingSubscriber : public StandbyServiceSubscriberStub {
+public:
+    void OnAllowListChangedBatch(const std::vector<AllowListChange>& changes) override
+    {
+        batchSizes_.emplace_back(changes.size());
+    }
+
+    std::vector<size_t> batchSizes_ {};
+};
+
 class StandbyServiceClientUnitTest : public testing::Test {
 public:
     static void SetUpTestCase() {}
@@ -343,5 +358,154 @@ HWTEST_F(StandbyServiceClientUnitTest, StandbyServiceClientUnitTest_018, TestSiz
     EXPECT_EQ(subscriber->HandleOnRestrictListChanged(restrictListData), ERR_OK);
 }
 
+/**
+ * @tc.name: StandbyServiceClientUnitTest_019
+ * @tc.desc: test ApplyAllowResourceBatch and UnapplyAllowResourceBatch.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceClientUnitTest, StandbyServiceClientUnitTest_019, TestSize.Level1)
+{
+    std::vector<sptr<ResourceRequest>> resourceRequests;
+    EXPECT_NE(StandbyServiceClient::GetInstance().ApplyAllowResourceBatch(resourceRequests), ERR_OK);
+    resourceRequests.emplace_back(nullptr);
+    EXPECT_NE(StandbyServiceClient::GetInstance().ApplyAllowResourceBatch(resourceRequests), ERR_OK);
+    EXPECT_NE(StandbyServiceClient::GetInstance().UnapplyAllowResourceBatch(resourceRequests), ERR_OK);
+
+    resourceRequests.clear();
+    resourceRequests.emplace_back(new (std::nothrow) ResourceRequest(AllowType::NETWORK,
+        0, "test_process", 100, "test", 1));
+    resourceRequests.emplace_back(new (std::nothrow) ResourceRequest(AllowType::NETWORK,
+        1, "test_process", 100, "test", 1));
+    EXPECT_EQ(StandbyServiceClient::GetInstance().ApplyAllowResourceBatch(resourceRequests), ERR_OK);
+    EXPECT_EQ(StandbyServiceClient::GetInstance().UnapplyAllowResourceBatch(resourceRequests), ERR_OK);
+}
+
+/**
+ * @tc.name: StandbyServiceClientUnitTest_020
+ * @tc.desc: test HandleOnAllowListChangedBatch of StandbyServiceSubscriberStub.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceClientUnitTest, StandbyServiceClientUnitTest_020, TestSize.Level1)
+{
+    sptr<StandbyServiceSubscriberStub> subscriber = new (std::nothrow) StandbyServiceSubscriberStub();
+    MessageParcel emptyData {};
+    EXPECT_NE(subscriber->HandleOnAllowListChangedBatch(emptyData), ERR_OK);
+    MessageParcel truncatedData {};
+    truncatedData.WriteUint32(1);
+    EXPECT_NE(subscriber->HandleOnAllowListChangedBatch(truncatedData), ERR_OK);
+    MessageParcel data {};
+    data.WriteUint32(1);
+    data.WriteInt32(0);
+    data.WriteString("test");
+    data.WriteUint32(AllowType::NETWORK);
+    data.WriteBool(true);
+    EXPECT_EQ(subscriber->HandleOnAllowListChangedBatch(data), ERR_OK);
+
+    sptr<IRemoteObject> impl {};
+    sptr<StandbyServiceSubscriberProxy> proxy = new (std::nothrow) StandbyServiceSubscriberProxy(impl);
+    proxy->OnAllowListChangedBatch({AllowListChange {0, "test", AllowType::NETWORK, true}});
+    EXPECT_NE(proxy, nullptr);
+}
+
+/**
+ * @tc.name: StandbyServiceClientUnitTest_021
+ * @tc.desc: test StandbyStatePage read by concurrent readers and waiters.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceClientUnitTest, StandbyServiceClientUnitTest_021, TestSize.Level1)
+{
+    EXPECT_EQ(StandbyStatePage::Map(-1), nullptr);
+    auto writer = StandbyStatePage::Create();
+    ASSERT_NE(writer, nullptr);
+    int32_t fd = dup(writer->GetFd());
+    // the page is only handed out once sealed, nobody else can map it writable
+    EXPECT_EQ(mmap(nullptr, getpagesize(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0), MAP_FAILED);
+    auto reader = StandbyStatePage::Map(fd);
+    close(fd);
+    ASSERT_NE(reader, nullptr);
+    StandbyStateRecord record;
+    EXPECT_FALSE(reader->Read(record));
+    EXPECT_FALSE(reader->WaitForChange(0, 1));
+
+    constexpr uint32_t writeTimes = 10000;
+    constexpr int32_t readerNum = 4;
+    std::atomic<bool> isWriting {true};
+    std::atomic<uint32_t> tornCount {0};
+    std::vector<std::thread> readers;
+    for (int32_t index = 0; index < readerNum; ++index) {
+        readers.emplace_back([&reader, &isWriting, &tornCount]() {
+            StandbyStateRecord readRecord;
+            while (isWriting.load()) {
+                if (reader->Read(readRecord) && (readRecord.state_ != readRecord.phase_ ||
+                    readRecord.state_ != readRecord.condition_)) {
+                    ++tornCount;
+                }
+            }
+        });
+    }
+    for (uint32_t value = 1; value <= writeTimes; ++value) {
+        writer->Write(value, value, value);
+    }
+    isWriting.store(false);
+    for (auto& thread : readers) {
+        thread.join();
+    }
+    EXPECT_EQ(tornCount.load(), 0);
+    EXPECT_TRUE(reader->Read(record));
+    EXPECT_EQ(record.state_, writeTimes);
+    EXPECT_EQ(record.generation_, writeTimes);
+
+    EXPECT_FALSE(reader->WaitForChange(record.generation_, 10));
+    std::thread waiter([&reader, &record]() {
+        EXPECT_TRUE(reader->WaitForChange(record.generation_, 1000));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    writer->Write(0, 0, 0);
+    waiter.join();
+    EXPECT_TRUE(reader->Read(record));
+    EXPECT_EQ(record.state_, 0);
+    EXPECT_EQ(record.generation_, writeTimes + 1);
+
+    // a withdrawn record wakes waiters and is not read until the next write
+    writer->Unpublish();
+    EXPECT_TRUE(reader->WaitForChange(record.generation_, 0));
+    EXPECT_FALSE(reader->Read(record));
+    writer->Write(1, 1, 1);
+    EXPECT_TRUE(reader->Read(record));
+    EXPECT_EQ(record.state_, 1);
+
+    uint32_t generation = 0;
+    bool isStandby = false;
+    EXPECT_NE(StandbyServiceClient::GetInstance().WaitForStandbyStateChange(generation, isStandby, 1), ERR_OK);
+}
+
+/**
+ * @tc.name: StandbyServiceClientUnitTest_022
+ * @tc.desc: test a large diff of allow list is split into parcels accepted by the subscriber stub.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceClientUnitTest, StandbyServiceClientUnitTest_022, TestSize.Level1)
+{
+    sptr<BatchRecordingSubscriber> subscriber = new (std::nothrow) BatchRecordingSubscriber();
+    ASSERT_NE(subscriber, nullptr);
+    sptr<StandbyServiceSubscriberProxy> proxy = new (std::nothrow) StandbyServiceSubscriberProxy(
+        subscriber->AsObject());
+    ASSERT_NE(proxy, nullptr);
+    constexpr size_t changeNum = 12345;
+    std::vector<AllowListChange> changes(changeNum, AllowListChange {0, "test", AllowType::NETWORK, true});
+    proxy->OnAllowListChangedBatch(changes);
+    ASSERT_GT(subscriber->batchSizes_.size(), 1);
+    size_t receivedNum = 0;
+    for (auto batchSize : subscriber->batchSizes_) {
+        EXPECT_GT(batchSize, 0);
+        EXPECT_LE(batchSize, 1000);
+        receivedNum += batchSize;
+    }
+    EXPECT_EQ(receivedNum, changeNum);
+}
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
@@ -77,6 +77,13 @@ public:
      */
     virtual ErrCode OnDestroy() = 0;
     virtual void ShellDump(const std::vector<std::string>& argsInStr, std::string& result) = 0;
+    /**
+     * @brief messages handled by the strategy, other messages are not delivered to it
+     */
+    virtual StandbyEventMask GetEventInterest() const
+    {
+        return ALL_STANDBY_EVENTS;
+    }
     virtual ~IBaseStrategy() = default;
 };
 }  // namespace DevStandbyMgr
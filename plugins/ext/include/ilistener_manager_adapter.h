@@ -34,6 +34,10 @@ public:
     virtual ErrCode StopListener() = 0;
     virtual void HandleEvent(const StandbyMessage& message) = 0;
     virtual void ShellDump(const std::vector<std::string>& argsInStr, std::string& result) = 0;
+    virtual StandbyEventMask GetEventInterest() const
+    {
+        return ALL_STANDBY_EVENTS;
+    }
     virtual ~IListenerManagerAdapter() = default;
 protected:
     std::vector<std::shared_ptr<IMesssageListener>> messageListenerList_ {};
@@ -37,6 +37,10 @@ public:
     virtual bool Init() = 0;
     virtual bool UnInit() = 0;
     virtual void HandleEvent(const StandbyMessage& message) = 0;
+    virtual StandbyEventMask GetEventInterest() const
+    {
+        return ALL_STANDBY_EVENTS;
+    }
 
     virtual ErrCode StartEvalCurrentState(const ConstraintEvalParam& params) = 0;
     virtual ErrCode EndEvalCurrentState(bool evalResult) = 0;
@@ -32,6 +32,10 @@ public:
     virtual bool UnInit() = 0;
     virtual void HandleEvent(const StandbyMessage& message) = 0;
     virtual void ShellDump(const std::vector<std::string>& argsInStr, std::string& result) = 0;
+    virtual StandbyEventMask GetEventInterest() const
+    {
+        return ALL_STANDBY_EVENTS;
+    }
 protected:
     virtual void RegisterPolicy(const std::vector<std::string>& strategies) = 0;
 protected:
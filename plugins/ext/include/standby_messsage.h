@@ -21,6 +21,8 @@
 #include <memory>
 #include <unordered_map>
 #include <optional>
+#include <variant>
+#include <vector>
 
 #include "want.h"
 
@@ -28,6 +30,16 @@
 
 namespace OHOS {
 namespace DevStandbyMgr {
+/**
+ * @brief version of the binary interface between the service and a plugin.
+ *
+ * StandbyMessage is passed to plugins by reference, so any change of its layout or of a payload struct is an ABI
+ * break. Bump it on such a change, the service rejects a plugin which exports another version and falls back to the
+ * built-in plugin. Version 2 adds the typed payload_, whose payloads own std::string and std::vector members, and
+ * drops compatibility with plugins built before it: the typed messages no longer carry their params in want_.
+ */
+constexpr uint32_t STANDBY_PLUGIN_INTERFACE_VERSION = 2;
+
 struct StandbyMessageType {
     enum : uint32_t {
         COMMON_EVENT = 1,
@@ -62,14 +74,119 @@ struct StandbyMessageType {
     };
 };
 
+/**
+ * @brief bit set of StandbyMessageType, components declare the messages they handle with it.
+ */
+using StandbyEventMask = uint64_t;
+constexpr StandbyEventMask ALL_STANDBY_EVENTS = ~static_cast<StandbyEventMask>(0);
+constexpr uint32_t MAX_MASKED_EVENT_ID = 64;
+
+// event ids out of the mask range are routed to every component which handles anything
+constexpr StandbyEventMask GetEventMask(uint32_t eventId)
+{
+    return eventId < MAX_MASKED_EVENT_ID ? (static_cast<StandbyEventMask>(1) << eventId) : ALL_STANDBY_EVENTS;
+}
+
+/**
+ * @brief typed payload of PROCESS_STATE_CHANGED.
+ */
+struct ProcessStateChangedPayload {
+    int32_t uid_ {-1};
+    int32_t pid_ {-1};
+    std::string name_ {""};
+    bool isCreated_ {false};
+
+    static ProcessStateChangedPayload FromWant(const AAFwk::Want& want)
+    {
+        return {want.GetIntParam("uid", -1), want.GetIntParam("pid", -1), want.GetStringParam("name"),
+            want.GetBoolParam("isCreated", false)};
+    }
+};
+
+/**
+ * @brief typed payload of ALLOW_LIST_CHANGED, carries the net diff of allow list.
+ */
+struct AllowListChangedPayload {
+    struct Entry {
+        int32_t uid_ {-1};
+        std::string name_ {""};
+        uint32_t allowType_ {0};
+        bool added_ {false};
+    };
+
+    // union of all changed types, lets strategies skip the whole diff at once
+    uint32_t allowType_ {0};
+    std::vector<Entry> changes_ {};
+
+    static AllowListChangedPayload FromWant(const AAFwk::Want& want)
+    {
+        AllowListChangedPayload payload;
+        payload.allowType_ = static_cast<uint32_t>(want.GetIntParam("allowType", 0));
+        std::vector<int32_t> uids = want.GetIntArrayParam("uids");
+        std::vector<std::string> names = want.GetStringArrayParam("names");
+        std::vector<int32_t> allowTypes = want.GetIntArrayParam("allowTypes");
+        std::vector<bool> addeds = want.GetBoolArrayParam("addeds");
+        if (names.size() != uids.size() || allowTypes.size() != uids.size() || addeds.size() != uids.size()) {
+            return payload;
+        }
+        for (size_t i = 0; i < uids.size(); ++i) {
+            payload.changes_.push_back({uids[i], names[i], static_cast<uint32_t>(allowTypes[i]), addeds[i]});
+        }
+        return payload;
+    }
+};
+
+/**
+ * @brief typed payload of BG_TASK_STATUS_CHANGE.
+ */
+struct BgTaskStatusPayload {
+    std::string type_ {""};
+    bool started_ {false};
+    int32_t uid_ {0};
+    std::string bundleName_ {""};
+    int32_t typeId_ {-1};
+
+    static BgTaskStatusPayload FromWant(const AAFwk::Want& want)
+    {
+        return {want.GetStringParam(BG_TASK_TYPE), want.GetBoolParam(BG_TASK_STATUS, false),
+            want.GetIntParam(BG_TASK_UID, 0), want.GetStringParam(BG_TASK_BUNDLE_NAME),
+            want.GetIntParam(BG_TASK_TYPE_ID, -1)};
+    }
+};
+
+using StandbyMessagePayload = std::variant<std::monostate, ProcessStateChangedPayload, AllowListChangedPayload,
+    BgTaskStatusPayload>;
+
 struct StandbyMessage {
     StandbyMessage() = default;
     explicit StandbyMessage(uint32_t eventId): eventId_(eventId) {}
     StandbyMessage(uint32_t eventId, const std::string& action): eventId_(eventId), action_(action) {}
+    StandbyMessage(uint32_t eventId, StandbyMessagePayload&& payload): eventId_(eventId),
+        payload_(std::move(payload)) {}
+
+    /**
+     * @brief get the typed payload, decode it from want_ if the message is produced with a want only.
+     *
+     * @param decoded storage of the payload decoded from want_
+     * @return pointer to the payload, nullptr if the message carries neither
+     */
+    template<typename T>
+    const T* GetPayload(T& decoded) const
+    {
+        if (const T* payload = std::get_if<T>(&payload_); payload != nullptr) {
+            return payload;
+        }
+        if (!want_.has_value()) {
+            return nullptr;
+        }
+        decoded = T::FromWant(*want_);
+        return &decoded;
+    }
 
     uint32_t eventId_ {0};
     std::string action_ {""};
     std::optional<AAFwk::Want> want_ {};
+    StandbyMessagePayload payload_ {};
 };
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
@@ -78,7 +78,7 @@ uint32_t BaseState::GetCurInnerPhase()
 
 void BaseState::StartTransitNextState(const std::shared_ptr<BaseState>& statePtr)
 {
-    handler_->PostTask([statePtr]() {
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [statePtr]() {
         STANDBYSERVICE_LOGD("due to timeout, try to enter %{public}s state from %{public}s",
             STATE_NAME_LIST[statePtr->nextState_].c_str(), STATE_NAME_LIST[statePtr->curState_].c_str());
         BaseState::AcquireStandbyRunningLock();
@@ -118,6 +118,7 @@ void BaseState::TransitToPhaseInner(uint32_t prePhase, uint32_t curPhase)
         STANDBYSERVICE_LOGW("state manager is nullptr, can not implement function to enter next phase");
         return;
     }
+    StandbyServiceImpl::GetInstance()->PublishStandbyState(curState_, curPhase);
     StandbyMessage message(StandbyMessageType::PHASE_TRANSIT);
     message.want_ = AAFwk::Want{};
     message.want_->SetParam(CURRENT_STATE, static_cast<int32_t>(curState_));
@@ -175,7 +176,7 @@ ErrCode BaseState::StopTimedTask(const std::string& timedTaskName)
 void BaseState::DestroyAllTimedTask()
 {
     for (auto& [timeTaskName, timerId] : timedTaskMap_) {
-        handler_->RemoveTask(timeTaskName);
+        StandbyServiceImpl::GetInstance()->RemoveLaneTask(timeTaskName);
         if (timerId > 0) {
             TimeServiceClient::GetInstance()->StopTimer(timerId);
             TimeServiceClient::GetInstance()->DestroyTimer(timerId);
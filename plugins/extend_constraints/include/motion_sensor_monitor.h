@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_PLUGINS_CONSTRAINTS_INCLUDE_MOTION_SENSOR_CONSTRAINT_H
 #define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_PLUGINS_CONSTRAINTS_INCLUDE_MOTION_SENSOR_CONSTRAINT_H
 
+#include <atomic>
 #include <memory>
 #include <map>
 #include <functional>
@@ -25,6 +26,7 @@
 #include "sensor_agent_type.h"
 #include "iconstraint_monitor.h"
 #include "base_state.h"
+#include "spsc_ring.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
@@ -34,12 +36,15 @@ class MotionSensorMonitor : public IConstraintMonitor,
 public:
     MotionSensorMonitor(int32_t detectionTimeOut, int32_t restTimeOut, int32_t totalTimeOut,
         const ConstraintEvalParam& params);
+    ~MotionSensorMonitor() override;
     bool Init() override;
     void StartMonitoring() override;
     void StopMonitoring() override;
     static double GetEnergy();
     static void SetEnergy(double energy);
     static void AddEnergy(AccelData *accelData);
+    // add the squared difference between each sample and the reference sample, only called in the handler thread
+    static void AddEnergy(const AccelData* samples, size_t count);
     static void MotionSensorCallback(SensorEvent *event);
     static void AcceleromterCallback(SensorEvent *event);
     static void RepeatAcceleromterCallback(SensorEvent *event);
@@ -55,17 +60,34 @@ private:
     void StopSensor();
     void PeriodlyStartMotionDetection();
     void StopMotionDetection();
+    // cache the threshold and rearm the result of a new evaluation
+    void ResetEvaluation();
+    // called in the sensor callback thread, push the sample for the handler thread to evaluate
+    static void PushAccelSample(SensorEvent *event);
+    void DrainAccelSamples();
+    // post the motion detected result once per evaluation
+    void PostMotionDetected();
 
 private:
+    static constexpr size_t SAMPLE_RING_CAPACITY = 256;
+
     const int32_t detectionTimeOut_;
     const int32_t restTimeOut_;
     const int32_t totalTimeOut_;
 
+    // energy and the reference sample are only accessed in the handler thread
     static double energy_;
     static bool hasPrevAccelData_;
     static AccelData previousAccelData_;
-    static AccelData currentAccelData_;
+    // monitor whose sensors are subscribed, sensor callbacks carry no user data
+    static std::atomic<MotionSensorMonitor*> activeMonitor_;
     std::shared_ptr<AppExecFwk::EventHandler> handler_ {};
+    SpscRing<AccelData, SAMPLE_RING_CAPACITY> sampleRing_ {};
+    std::atomic<bool> isDrainPosted_ {false};
+    std::atomic<bool> hasPostedResult_ {false};
+    std::atomic<uint64_t> droppedSampleCount_ {0};
+    // threshold cached when the evaluation starts
+    double motionThreshold_ {0};
     ConstraintEvalParam params_{};
     bool isMonitoring_ {false};
 
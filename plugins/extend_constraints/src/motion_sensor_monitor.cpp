@@ -15,6 +15,7 @@
 
 #include "motion_sensor_monitor.h"
 
+#include <array>
 #include <vector>
 #include <string>
 
@@ -28,6 +29,42 @@ namespace DevStandbyMgr {
 namespace {
     const int32_t COUNT_TIMES = 15;
     const int32_t MAX_COUNT_SENSOR = 200;
+    constexpr size_t DRAIN_BATCH_SIZE = 64;
+    constexpr size_t ENERGY_LANE_NUM = 4;
+
+    int32_t GetMotionThreshold()
+    {
+        // resolve the param name once, sensor callbacks then read the config snapshot without locking
+        static const uint32_t motionThresholdHandle =
+            StandbyConfigManager::GetInstance()->GetParamHandle(MOTION_THREADSHOLD);
+        return StandbyConfigManager::GetInstance()->GetStandbyParamByHandle(motionThresholdHandle);
+    }
+
+    float GetSquaredDiff(const AccelData& sample, const AccelData& reference)
+    {
+        AccelData diff {sample.x - reference.x, sample.y - reference.y, sample.z - reference.z};
+        return (diff.x * diff.x) + (diff.y * diff.y) + (diff.z * diff.z);
+    }
+
+    // independent accumulators carry no dependency between lanes, so that the loop is vectorized
+    double ComputeSquaredDiffEnergy(const AccelData* samples, size_t count, const AccelData& reference)
+    {
+        std::array<double, ENERGY_LANE_NUM> partialEnergy {};
+        size_t index = 0;
+        for (; index + ENERGY_LANE_NUM <= count; index += ENERGY_LANE_NUM) {
+            for (size_t lane = 0; lane < ENERGY_LANE_NUM; ++lane) {
+                partialEnergy[lane] += GetSquaredDiff(samples[index + lane], reference);
+            }
+        }
+        double energy = 0;
+        for (; index < count; ++index) {
+            energy += GetSquaredDiff(samples[index], reference);
+        }
+        for (double laneEnergy : partialEnergy) {
+            energy += laneEnergy;
+        }
+        return energy;
+    }
 }
 
 double MotionSensorMonitor::energy_ = 0;
@@ -35,7 +72,7 @@ double MotionSensorMonitor::energy_ = 0;
 // hasPrevAccelData_ is true if we has previous acceleration data to calculate the difference
 bool MotionSensorMonitor::hasPrevAccelData_ = false;
 AccelData MotionSensorMonitor::previousAccelData_ {0, 0, 0};
-AccelData MotionSensorMonitor::currentAccelData_ {0, 0, 0};
+std::atomic<MotionSensorMonitor*> MotionSensorMonitor::activeMonitor_ {nullptr};
 
 MotionSensorMonitor::MotionSensorMonitor(int32_t detectionTimeOut, int32_t restTimeOut, int32_t totalTimeOut,
     const ConstraintEvalParam& params): detectionTimeOut_(detectionTimeOut), restTimeOut_(restTimeOut),
@@ -44,6 +81,12 @@ MotionSensorMonitor::MotionSensorMonitor(int32_t detectionTimeOut, int32_t restT
     handler_ = StandbyServiceImpl::GetInstance()->GetHandler();
 }
 
+MotionSensorMonitor::~MotionSensorMonitor()
+{
+    MotionSensorMonitor* monitor = this;
+    activeMonitor_.compare_exchange_strong(monitor, nullptr);
+}
+
 bool MotionSensorMonitor::CheckSersorUsable(SensorInfo *sensorInfo, int32_t count, int32_t sensorTypeId)
 {
     if (sensorInfo == nullptr || !(count > 0 && count < MAX_COUNT_SENSOR)) {
@@ -63,42 +106,67 @@ bool MotionSensorMonitor::CheckSersorUsable(SensorInfo *sensorInfo, int32_t coun
 
 void MotionSensorMonitor::AcceleromterCallback(SensorEvent *event)
 {
-    if (event == NULL) {
+    PushAccelSample(event);
+}
+
+void MotionSensorMonitor::RepeatAcceleromterCallback(SensorEvent *event)
+{
+    // the repeated detection differs in threshold only, which is decided when the evaluation starts
+    PushAccelSample(event);
+}
+
+void MotionSensorMonitor::MotionSensorCallback(SensorEvent *event)
+{
+    if (auto monitor = activeMonitor_.load(std::memory_order_acquire); monitor != nullptr) {
+        monitor->PostMotionDetected();
+    }
+}
+
+void MotionSensorMonitor::PushAccelSample(SensorEvent *event)
+{
+    if (event == nullptr || event->data == nullptr) {
+        return;
+    }
+    MotionSensorMonitor* monitor = activeMonitor_.load(std::memory_order_acquire);
+    if (monitor == nullptr) {
         return;
     }
-    AccelData* sensorData = reinterpret_cast<AccelData*>(event->data);
-    MotionSensorMonitor::AddEnergy(sensorData);
-    STANDBYSERVICE_LOGD("sensor motion: %{public}lf, threshold: %{public}d", MotionSensorMonitor::GetEnergy(),
-        StandbyConfigManager::GetInstance()->GetStandbyParam(MOTION_THREADSHOLD));
-    if (MotionSensorMonitor::GetEnergy() > StandbyConfigManager::GetInstance()->
-            GetStandbyParam(MOTION_THREADSHOLD)) {
-        StandbyServiceImpl::GetInstance()->GetHandler()->PostTask([]() {
-            StandbyServiceImpl::GetInstance()->GetStateManager()->EndEvalCurrentState(false);
-            }, MOTION_DECTION_TASK);
+    if (!monitor->sampleRing_.Push(*reinterpret_cast<AccelData*>(event->data))) {
+        ++monitor->droppedSampleCount_;
     }
+    // one drain task takes all samples pushed before it runs
+    if (monitor->isDrainPosted_.exchange(true)) {
+        return;
+    }
+    std::weak_ptr<MotionSensorMonitor> weakMonitor = monitor->weak_from_this();
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [weakMonitor]() {
+        if (auto drainMonitor = weakMonitor.lock(); drainMonitor != nullptr) {
+            drainMonitor->DrainAccelSamples();
+        }
+        }, MOTION_DECTION_TASK);
 }
 
-void MotionSensorMonitor::RepeatAcceleromterCallback(SensorEvent *event)
+void MotionSensorMonitor::DrainAccelSamples()
 {
-    if (event == NULL) {
-        return;
+    // cleared before popping, samples pushed after the last pop are taken by the next drain task
+    isDrainPosted_.store(false);
+    std::array<AccelData, DRAIN_BATCH_SIZE> samples;
+    size_t sampleCount = 0;
+    while ((sampleCount = sampleRing_.PopBatch(samples.data(), samples.size())) > 0) {
+        AddEnergy(samples.data(), sampleCount);
     }
-    STANDBYSERVICE_LOGD("periodly receive Acceleromter motion sensor callback");
-    AccelData* sensorData = reinterpret_cast<AccelData*>(event->data);
-    MotionSensorMonitor::AddEnergy(sensorData);
-    STANDBYSERVICE_LOGD("sensor motion: %{public}lf, threshold: %{public}lf", MotionSensorMonitor::GetEnergy(),
-        StandbyConfigManager::GetInstance()->GetStandbyParam(MOTION_THREADSHOLD) * 1.0 / COUNT_TIMES);
-    if (MotionSensorMonitor::GetEnergy() > StandbyConfigManager::GetInstance()->
-            GetStandbyParam(MOTION_THREADSHOLD) * 1.0 / COUNT_TIMES) {
-        StandbyServiceImpl::GetInstance()->GetHandler()->PostTask([]() {
-            StandbyServiceImpl::GetInstance()->GetStateManager()->EndEvalCurrentState(false);
-            }, MOTION_DECTION_TASK);
+    STANDBYSERVICE_LOGD("sensor motion: %{public}lf, threshold: %{public}lf", energy_, motionThreshold_);
+    if (isMonitoring_ && energy_ > motionThreshold_) {
+        PostMotionDetected();
     }
 }
 
-void MotionSensorMonitor::MotionSensorCallback(SensorEvent *event)
+void MotionSensorMonitor::PostMotionDetected()
 {
-    StandbyServiceImpl::GetInstance()->GetHandler()->PostTask([]() {
+    if (hasPostedResult_.exchange(true)) {
+        return;
+    }
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, []() {
         StandbyServiceImpl::GetInstance()->GetStateManager()->EndEvalCurrentState(false);
         }, MOTION_DECTION_TASK);
 }
@@ -118,14 +186,20 @@ void MotionSensorMonitor::AddEnergy(AccelData *accelData)
     if (accelData == nullptr) {
         return;
     }
-    currentAccelData_ = *accelData;
+    AddEnergy(accelData, 1);
+}
+
+void MotionSensorMonitor::AddEnergy(const AccelData* samples, size_t count)
+{
+    if (samples == nullptr || count == 0) {
+        return;
+    }
+    // the first sample of the evaluation is the reference of all samples after it
     if (!hasPrevAccelData_) {
         hasPrevAccelData_ = true;
-        previousAccelData_ = currentAccelData_;
+        previousAccelData_ = samples[0];
     }
-    AccelData diff {currentAccelData_.x - previousAccelData_.x, currentAccelData_.y - previousAccelData_.y,
-        currentAccelData_.z - previousAccelData_.z};
-    energy_ += (diff.x *  diff.x) + (diff.y *  diff.y) + (diff.z *  diff.z);
+    energy_ += ComputeSquaredDiffEnergy(samples, count, previousAccelData_);
 }
 
 bool MotionSensorMonitor::Init()
@@ -197,16 +271,24 @@ void MotionSensorMonitor::AssignMotionSensorCallBack()
 void MotionSensorMonitor::StartMonitoring()
 {
     STANDBYSERVICE_LOGD("start motion sensor monitoring");
-    handler_->PostTask([]() {
+    ResetEvaluation();
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, []() {
         STANDBYSERVICE_LOGI("stop motion sensor monitoring");
         StandbyServiceImpl::GetInstance()->GetStateManager()->EndEvalCurrentState(true);
         }, MOTION_DECTION_TASK, totalTimeOut_);
     PeriodlyStartMotionDetection();
 }
 
+void MotionSensorMonitor::ResetEvaluation()
+{
+    motionThreshold_ = params_.isRepeatedDetection_ ? GetMotionThreshold() * 1.0 / COUNT_TIMES :
+        GetMotionThreshold();
+    hasPostedResult_.store(false);
+}
+
 void MotionSensorMonitor::StopMotionDetection()
 {
-    handler_->PostTask([monitor = shared_from_this()]() {
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [monitor = shared_from_this()]() {
         monitor->StopMonitoringInner();
         }, MOTION_DECTION_TASK, detectionTimeOut_);
 }
@@ -219,7 +301,7 @@ void MotionSensorMonitor::PeriodlyStartMotionDetection()
         return;
     }
     StopMotionDetection();
-    handler_->PostTask([monitor = shared_from_this()]() {
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [monitor = shared_from_this()]() {
         monitor->PeriodlyStartMotionDetection();
         }, MOTION_DECTION_TASK, detectionTimeOut_ + restTimeOut_);
 }
@@ -228,6 +310,10 @@ ErrCode MotionSensorMonitor::StartMonitoringInner()
 {
     energy_ = 0;
     isMonitoring_ = true;
+    // samples left by the last detection belong to another window
+    sampleRing_.Clear();
+    isDrainPosted_.store(false);
+    activeMonitor_.store(this, std::memory_order_release);
     if (StartSensor() == ERR_OK) {
         return ERR_OK;
     }
@@ -239,7 +325,7 @@ ErrCode MotionSensorMonitor::StartMonitoringInner()
 
 void MotionSensorMonitor::StopMonitoring()
 {
-    handler_->RemoveTask(MOTION_DECTION_TASK);
+    StandbyServiceImpl::GetInstance()->RemoveLaneTask(MOTION_DECTION_TASK);
     StopMonitoringInner();
 }
 
@@ -247,6 +333,12 @@ void MotionSensorMonitor::StopMonitoringInner()
 {
     StopSensor();
     isMonitoring_ = false;
+    MotionSensorMonitor* monitor = this;
+    activeMonitor_.compare_exchange_strong(monitor, nullptr);
+    if (uint64_t droppedCount = droppedSampleCount_.exchange(0); droppedCount > 0) {
+        STANDBYSERVICE_LOGW("%{public}llu motion samples dropped as the ring is full",
+            static_cast<unsigned long long>(droppedCount));
+    }
 }
 
 ErrCode MotionSensorMonitor::StartSensor()
@@ -27,6 +27,7 @@ public:
     bool Init() override;
     bool UnInit() override;
     void HandleEvent(const StandbyMessage& message) override;
+    StandbyEventMask GetEventInterest() const override;
     ErrCode StartListener() override;
     ErrCode StopListener() override;
     void ShellDump(const std::vector<std::string>& argsInStr, std::string& result) override;
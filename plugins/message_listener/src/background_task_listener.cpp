@@ -92,14 +92,8 @@ void BackgroundTaskListener::BgTaskListenerImpl::OnContinuousTaskStop(
 void BackgroundTaskListener::BgTaskListenerImpl::OnTaskStatusChanged(const std::string& type, bool started,
     int32_t uid, int32_t pid, const std::string& bundleName, int32_t typeId)
 {
-    StandbyMessage standbyMessage {StandbyMessageType::BG_TASK_STATUS_CHANGE};
-    standbyMessage.want_ = AAFwk::Want {};
-    standbyMessage.want_->SetParam(BG_TASK_TYPE, type);
-    standbyMessage.want_->SetParam(BG_TASK_STATUS, started);
-    standbyMessage.want_->SetParam(BG_TASK_UID, uid);
-    standbyMessage.want_->SetParam(BG_TASK_BUNDLE_NAME, bundleName);
-    standbyMessage.want_->SetParam(BG_TASK_TYPE_ID, typeId);
-    StandbyServiceImpl::GetInstance()->DispatchEvent(standbyMessage);
+    StandbyServiceImpl::GetInstance()->DispatchEvent(StandbyMessage(StandbyMessageType::BG_TASK_STATUS_CHANGE,
+        BgTaskStatusPayload {type, started, uid, bundleName, typeId}));
 }
 } // OHOS
 } // DevStandbyMgr
\ No newline at end of file
@@ -73,6 +73,11 @@ void ListenerManagerAdapter::HandleEvent(const StandbyMessage& message)
     }
 }
 
+StandbyEventMask ListenerManagerAdapter::GetEventInterest() const
+{
+    return GetEventMask(StandbyMessageType::SYS_ABILITY_STATUS_CHANGED);
+}
+
 void ListenerManagerAdapter::UpdateListenerList(const StandbyMessage& message)
 {
     if (!message.want_.has_value()) {
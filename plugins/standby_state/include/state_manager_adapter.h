@@ -26,6 +26,7 @@ public:
     bool Init() override;
     bool UnInit() override;
     void HandleEvent(const StandbyMessage& message) override;
+    StandbyEventMask GetEventInterest() const override;
     uint32_t GetCurState() override;
     uint32_t GetPreState() override;
 
@@ -22,6 +22,7 @@
 #include "standby_config_manager.h"
 #include "iconstraint_manager_adapter.h"
 #include "istate_manager_adapter.h"
+#include "standby_service_impl.h"
 
 
 namespace OHOS {
@@ -51,7 +52,7 @@ ErrCode DarkState::BeginState()
 ErrCode DarkState::EndState()
 {
     StopTimedTask(TRANSIT_NEXT_STATE_TIMED_TASK);
-    handler_->RemoveTask(TRANSIT_NEXT_STATE_TIMED_TASK);
+    StandbyServiceImpl::GetInstance()->RemoveLaneTask(TRANSIT_NEXT_STATE_TIMED_TASK);
     return ERR_OK;
 }
 
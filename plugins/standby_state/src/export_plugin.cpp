@@ -17,11 +17,17 @@
 #include "constraint_manager_adapter.h"
 #include "strategy_manager_adapter.h"
 #include "state_manager_adapter.h"
+#include "standby_messsage.h"
 #include "standby_service_impl.h"
 #include "standby_service_log.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
+extern "C" uint32_t GetPluginInterfaceVersion()
+{
+    return STANDBY_PLUGIN_INTERFACE_VERSION;
+}
+
 extern "C" bool OnPluginRegister()
 {
     IConstraintManagerAdapter* constraintManager = new ConstraintManagerAdapter();
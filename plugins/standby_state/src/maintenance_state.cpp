@@ -19,6 +19,7 @@
 #include "standby_config_manager.h"
 #include "iconstraint_manager_adapter.h"
 #include "istate_manager_adapter.h"
+#include "standby_service_impl.h"
 #include "time_provider.h"
 
 namespace OHOS {
@@ -44,7 +45,7 @@ ErrCode MaintenanceState::BeginState()
 ErrCode MaintenanceState::EndState()
 {
     StopTimedTask(TRANSIT_NEXT_STATE_TIMED_TASK);
-    handler_->RemoveTask(TRANSIT_NEXT_STATE_TIMED_TASK);
+    StandbyServiceImpl::GetInstance()->RemoveLaneTask(TRANSIT_NEXT_STATE_TIMED_TASK);
     return ERR_OK;
 }
 
@@ -21,6 +21,7 @@
 #include "standby_config_manager.h"
 #include "iconstraint_manager_adapter.h"
 #include "istate_manager_adapter.h"
+#include "standby_service_impl.h"
 #include "time_provider.h"
 
 namespace OHOS {
@@ -61,7 +62,7 @@ ErrCode NapState::BeginState()
         STANDBYSERVICE_LOGI("napTimeOut is " SPUBI64 " ms", napTimeOut);
         StartStateTransitionTimer(napTimeOut);
     }
-    handler_->PostTask([napState = shared_from_this()]() {
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [napState = shared_from_this()]() {
         BaseState::AcquireStandbyRunningLock();
         napState->TransitToPhase(napState->curPhase_, napState->curPhase_ + 1);
         }, TRANSIT_NEXT_PHASE_INSTANT_TASK);
@@ -71,8 +72,8 @@ ErrCode NapState::BeginState()
 ErrCode NapState::EndState()
 {
     StopTimedTask(TRANSIT_NEXT_STATE_TIMED_TASK);
-    handler_->RemoveTask(TRANSIT_NEXT_STATE_TIMED_TASK);
-    handler_->RemoveTask(TRANSIT_NEXT_PHASE_INSTANT_TASK);
+    StandbyServiceImpl::GetInstance()->RemoveLaneTask(TRANSIT_NEXT_STATE_TIMED_TASK);
+    StandbyServiceImpl::GetInstance()->RemoveLaneTask(TRANSIT_NEXT_PHASE_INSTANT_TASK);
     return ERR_OK;
 }
 
@@ -97,7 +98,7 @@ void NapState::SetPhaseTransitTask(bool evalResult)
     }
     curPhase_ += 1;
     if (curPhase_ < NapStatePhase::END) {
-        handler_->PostTask([napState = shared_from_this()]() {
+        StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [napState = shared_from_this()]() {
             napState->TransitToPhase(napState->curPhase_, napState->curPhase_ + 1);
             }, TRANSIT_NEXT_PHASE_INSTANT_TASK);
     } else {
@@ -22,6 +22,7 @@
 #include "standby_config_manager.h"
 #include "iconstraint_manager_adapter.h"
 #include "istate_manager_adapter.h"
+#include "standby_service_impl.h"
 #include "time_provider.h"
 #include "timed_task.h"
 
@@ -64,7 +65,7 @@ ErrCode SleepState::Init(const std::shared_ptr<BaseState>& statePtr)
 
 void SleepState::StartPeriodlyMotionDetection()
 {
-    handler_->PostTask([sleepState = this]() {
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [sleepState = this]() {
         sleepState->isRepeatedDetection_ = true;
         ConstraintEvalParam params{sleepState->curState_, sleepState->curPhase_,
             sleepState->curState_, sleepState->curPhase_};
@@ -109,7 +110,7 @@ ErrCode SleepState::BeginState()
     maintIntervalTimeOut = CalculateMaintTimeOut(stateManagerPtr, true);
     STANDBYSERVICE_LOGI("maintIntervalTimeOut is " SPUBI64 " ms", maintIntervalTimeOut);
 
-    handler_->PostTask([sleepState = this]() {
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [sleepState = this]() {
         BaseState::AcquireStandbyRunningLock();
         sleepState->TransitToPhase(sleepState->curPhase_, sleepState->curPhase_ + 1);
         }, TRANSIT_NEXT_PHASE_INSTANT_TASK);
@@ -123,9 +124,11 @@ void SleepState::TryToEnterNextPhase(const std::shared_ptr<IStateManagerAdapter>
 {
     if (stateManagerPtr->IsEvalution()) {
         STANDBYSERVICE_LOGW("state is in evalution, postpone to enter next phase");
-        handler_->PostTask([sleepState = this, stateManagerPtr, retryTimeOut]() {
+        auto retryTask = [sleepState = this, stateManagerPtr, retryTimeOut]() {
             sleepState->TryToEnterNextPhase(stateManagerPtr, retryTimeOut);
-            }, TRANSIT_NEXT_PHASE_INSTANT_TASK, retryTimeOut);
+        };
+        StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, retryTask, TRANSIT_NEXT_PHASE_INSTANT_TASK,
+            retryTimeOut);
     } else if (curPhase_ < SleepStatePhase::END) {
         TransitToPhase(curPhase_, curPhase_ + 1);
     }
@@ -135,9 +138,9 @@ ErrCode SleepState::EndState()
 {
     StopTimedTask(TRANSIT_NEXT_STATE_TIMED_TASK);
     StopTimedTask(REPEATED_MOTION_DETECTION_TASK);
-    handler_->RemoveTask(TRANSIT_NEXT_STATE_TIMED_TASK);
-    handler_->RemoveTask(TRANSIT_NEXT_PHASE_INSTANT_TASK);
-    handler_->RemoveTask(REPEATED_MOTION_DETECTION_TASK);
+    StandbyServiceImpl::GetInstance()->RemoveLaneTask(TRANSIT_NEXT_STATE_TIMED_TASK);
+    StandbyServiceImpl::GetInstance()->RemoveLaneTask(TRANSIT_NEXT_PHASE_INSTANT_TASK);
+    StandbyServiceImpl::GetInstance()->RemoveLaneTask(REPEATED_MOTION_DETECTION_TASK);
     return ERR_OK;
 }
 
@@ -174,7 +177,7 @@ void SleepState::SetPhaseTransitOrRepeatedTask()
 {
     curPhase_ += 1;
     if (curPhase_ < SleepStatePhase::END) {
-        handler_->PostTask([sleepState = this]() {
+        StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [sleepState = this]() {
             sleepState->TransitToPhase(sleepState->curPhase_, sleepState->curPhase_ + 1);
             }, TRANSIT_NEXT_PHASE_INSTANT_TASK);
     } else {
@@ -192,10 +195,10 @@ void SleepState::ShellDump(const std::vector<std::string>& argsInStr, std::strin
     if (argsInStr[DUMP_FIRST_PARAM] == DUMP_SIMULATE_SENSOR) {
         if (argsInStr[DUMP_SECOND_PARAM] == "--repeat") {
             StartPeriodlyMotionDetection();
-            handler_->PostTask([sleepState = this]() {
+            StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [sleepState = this]() {
                 STANDBYSERVICE_LOGD("after 100ms, stop sensor");
                 sleepState->stateManager_.lock()->EndEvalCurrentState(false);
-                }, DUMP_REPEAT_DETECTION_TIMEOUT);
+                }, "", DUMP_REPEAT_DETECTION_TIMEOUT);
             result += "finished start repeated sensor\n";
         }
     }
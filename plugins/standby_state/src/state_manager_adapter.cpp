@@ -71,6 +71,7 @@ bool StateManagerAdapter::Init()
     if (curStatePtr_->BeginState() != ERR_OK) {
         return false;
     }
+    StandbyServiceImpl->PublishStandbyState(curStatePtr_->GetCurState(), curStatePtr_->GetCurInnerPhase());
     SendNotification(preStatePtr_->GetCurState(), true);
     STANDBYSERVICE_LOGI("state manager plugin initialization succeed");
     return true;
@@ -103,6 +104,12 @@ void StateManagerAdapter::HandleEvent(const StandbyMessage& message)
     }
 }
 
+StandbyEventMask StateManagerAdapter::GetEventInterest() const
+{
+    return GetEventMask(StandbyMessageType::COMMON_EVENT) |
+        GetEventMask(StandbyMessageType::RES_CTRL_CONDITION_CHANGED);
+}
+
 void StateManagerAdapter::HandleCommonEvent(const StandbyMessage& message)
 {
 #ifndef STANDBY_REALTIME_TIMER_ENABLE
@@ -314,6 +321,8 @@ ErrCode StateManagerAdapter::TransitToStateInner(uint32_t nextState)
     preStatePtr_ = curStatePtr_;
     curStatePtr_ = indexToState_[nextState];
     curStatePtr_->BeginState();
+    StandbyServiceImpl::GetInstance()->PublishStandbyState(curStatePtr_->GetCurState(),
+        curStatePtr_->GetCurInnerPhase());
 
     RecordStateTransition();
     SendNotification(preStatePtr_->GetCurState(), true);
@@ -341,9 +350,9 @@ void StateManagerAdapter::StopEvalution()
 
 void StateManagerAdapter::OnScreenOffHalfHour(bool scrOffHalfHourCtrl, bool repeated)
 {
-    handler_->PostSyncTask([this, scrOffHalfHourCtrl, repeated]() {
+    StandbyServiceImpl::GetInstance()->PostLaneSyncTask(TaskLane::CRITICAL, [this, scrOffHalfHourCtrl, repeated]() {
         OnScreenOffHalfHourInner(scrOffHalfHourCtrl, repeated);
-        }, AppExecFwk::EventQueue::Priority::HIGH);
+        });
 }
 
 void StateManagerAdapter::OnScreenOffHalfHourInner(bool scrOffHalfHourCtrl, bool repeated)
@@ -444,10 +453,10 @@ void StateManagerAdapter::DumpActivateMotion(const std::vector<std::string>& arg
 {
     if (argsInStr[DUMP_SECOND_PARAM] == "--motion") {
         curStatePtr_->StartTransitNextState(curStatePtr_);
-        handler_->PostTask([this]() {
+        StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [this]() {
             STANDBYSERVICE_LOGD("after 3000ms, stop sensor");
             this->EndEvalCurrentState(false);
-            }, MOTION_DETECTION_TIMEOUT);
+            }, "", MOTION_DETECTION_TIMEOUT);
         result += "finished start periodly sensor\n";
     } else if (argsInStr[DUMP_SECOND_PARAM] == "--blocked") {
         BlockCurrentState();
@@ -19,13 +19,14 @@
 #include "standby_config_manager.h"
 #include "iconstraint_manager_adapter.h"
 #include "istate_manager_adapter.h"
+#include "standby_service_impl.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
 ErrCode WorkingState::BeginState()
 {
     curPhase_ = 0;
-    handler_->PostTask([working = shared_from_this()]() {
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [working = shared_from_this()]() {
         working->checkScreenStatus();
         }, TRANSIT_NEXT_STATE_CONDITION_TASK);
     return ERR_OK;
@@ -59,7 +60,7 @@ ErrCode WorkingState::EndState()
         STANDBYSERVICE_LOGE("state manager adapter is nullptr");
         return ERR_STATE_MANAGER_IS_NULLPTR;
     }
-    handler_->RemoveTask(TRANSIT_NEXT_STATE_CONDITION_TASK);
+    StandbyServiceImpl::GetInstance()->RemoveLaneTask(TRANSIT_NEXT_STATE_CONDITION_TASK);
     return ERR_OK;
 }
 
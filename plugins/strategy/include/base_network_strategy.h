@@ -15,7 +15,11 @@
 #ifndef DEVICE_STANDBY_EXT_BASE_NETWPRK_STRATEGY_H
 #define DEVICE_STANDBY_EXT_BASE_NETWPRK_STRATEGY_H
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "ibase_strategy.h"
+#include "exemption_index.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
@@ -31,6 +35,11 @@ public:
      */
     void HandleEvent(const StandbyMessage& message) override;
 
+    /**
+     * @brief messages handled by BaseNetworkStrategy.
+     */
+    StandbyEventMask GetEventInterest() const override;
+
     /**
      * @brief BaseNetworkStrategy OnCreated.
      *
@@ -59,9 +68,11 @@ protected:
     void ResetFirewallAllowList();
 
     /**
-     * @brief get all apps, system apps defaultly not be restricted.
+     * @brief add uids to or remove them from the trustlist of net policy.
+     *
+     * @return true if the trustlist of net policy reflects the change.
      */
-    virtual void SetFirewallAllowedList(const std::vector<uint32_t>& uids, bool isAdded) = 0;
+    virtual bool SetFirewallAllowedList(const std::vector<uint32_t>& uids, bool isAdded) = 0;
 
     /**
      * @brief set net limited mode, if netLimited is true, start net limited mode, else stop net limited mode.
@@ -103,22 +114,30 @@ protected:
     virtual ErrCode InitNetLimitedAppInfo();
 
     /**
-     * @brief update allow uid and send to  Firewall.
+     * @brief update allow uid and send the diff against the trustlist pushed last time to Firewall.
      */
     virtual void SetNetAllowApps(bool isAllow);
 
+    /**
+     * @brief queue change of trustlist, changes within a short window are sent in one call per direction.
+     */
+    void QueueTrustlistChange(const std::vector<uint32_t>& uids, bool isAdded);
+
+    /**
+     * @brief send the net diff between queued changes and the trustlist pushed last time.
+     */
+    void FlushTrustlistChanges();
+
 protected:
     void ResetFirewallStatus(const StandbyMessage& message);
+    // net policy loses the trustlist when it restarts, the shadow is dropped and the trustlist pushed again
+    void HandleNetPolicyStatusChanged(bool isAdded);
 
     ErrCode EnableNetworkFirewallInner();
     ErrCode DisableNetworkFirewallInner();
-    ErrCode GetAllRunningAppInfo();
 
-    ErrCode GetForegroundApplications();
-    // get backgroundtask, including continuous task and transient, defaultly not be constricted.
-    ErrCode GetBackgroundTaskApp();
-    // get running work scheduler task and add work_scheduler flag to relative apps.
-    ErrCode GetWorkSchedulerTask();
+    // flag of app state in index, continuous task is exempted in night only if its type is configured
+    uint8_t GetAppStateFlag(const ExemptionIndexEntry& entry);
     void AddExemptionFlagByUid(int32_t uid, uint8_t flag);
     // get exemption app and restrict list from standby service
     ErrCode GetExemptionConfig();
@@ -129,6 +148,7 @@ protected:
     void GetAndCreateAppInfo(uint32_t uid, const std::string& bundleName);
     bool GetExemptedFlag(uint8_t appNoExemptionFlag, uint8_t appExemptionFlag);
     std::string UidsToString(const std::vector<uint32_t>& uids);
+    void SendTrustlistDiff(const std::vector<uint32_t>& uids, bool isAdded);
     bool IsFlagExempted(uint8_t flag);
 protected:
     static bool isFirewallEnabled_;
@@ -137,6 +157,14 @@ protected:
     static std::unordered_map<std::int32_t, NetLimtedAppInfo> netLimitedAppInfo_;
     uint32_t nightExemptionTaskType_ {0};
     uint32_t condition_ {0};
+    // shadow of the trustlist pushed by the strategy, unknown until it is reset once
+    std::unordered_set<uint32_t> trustlistShadow_ {};
+    bool isTrustlistKnown_ {false};
+    std::unordered_map<uint32_t, bool> pendingTrustlist_ {};
+    bool isTrustlistSyncPosted_ {false};
+    uint64_t trustlistChangedCount_ {0};
+    uint64_t trustlistSentCount_ {0};
+    uint64_t trustlistCallCount_ {0};
     const static std::int32_t NETMANAGER_SUCCESS = 0;
     const static std::int32_t NETMANAGER_ERR_STATUS_EXIST = 2100209;
 };
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_STRATEGY_INCLUDE_EXEMPTION_INDEX_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_STRATEGY_INCLUDE_EXEMPTION_INDEX_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include "ibase_strategy.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+// state of an uid shared by strategies, exemption and restriction flag depend on strategy and are not included
+struct ExemptionIndexEntry {
+    // bundle name of app installed for all users, empty for native process or app of special user
+    std::string bundleName_ {""};
+    std::string processName_ {""};
+    std::set<int32_t> pids_ {};
+    // bit of the type id of continuous task applied by the app
+    uint32_t continuousTaskTypes_ {0};
+    uint8_t appExemptionFlag_ {0};
+    bool isAppInfoKnown_ {false};
+};
+
+/**
+ * @brief per-uid app state queried once per state transition and shared by network and running lock strategy.
+ *
+ * The index is invalidated when state or phase transits or the resource control condition changes, the first
+ * strategy handling the message populates it and the others reuse it. Process and background task messages keep
+ * the populated index up to date, foreground apps are only refreshed by the next population.
+ */
+class ExemptionIndex {
+DECLARE_DELAYED_SINGLETON(ExemptionIndex);
+public:
+    static std::shared_ptr<ExemptionIndex> GetInstance();
+
+    /**
+     * @brief query app state from other services if the index is invalidated.
+     *
+     * @return ERR_OK if the index is valid.
+     */
+    ErrCode Populate();
+
+    void Invalidate();
+
+    /**
+     * @brief invalidate or update the index by message, invoked before message is delivered to strategies.
+     */
+    void HandleEvent(const StandbyMessage& message);
+
+    /**
+     * @brief visit all entries, func must not call back into the index.
+     */
+    void ForEachEntry(const std::function<void(int32_t, const ExemptionIndexEntry&)>& func);
+
+    // only uid unknown to the index costs an ipc
+    bool IsSystemApp(int32_t uid);
+
+    void ShellDump(std::string& result);
+
+private:
+    // get all apps, system apps defaultly not be restricted.
+    ErrCode GetAllAppInfos();
+    ErrCode GetAllRunningAppInfo();
+    ErrCode GetForegroundApplications();
+    // get background task, including continuous task and transient.
+    ErrCode GetBackgroundTaskApp();
+    // get running work scheduler task and add work_scheduler flag to relative apps.
+    ErrCode GetWorkSchedulerTask();
+
+    void HandleProcessStatusChanged(const StandbyMessage& message);
+    void UpdateBgTaskAppStatus(const StandbyMessage& message);
+    void ResetBgTaskStatus(const StandbyMessage& message);
+
+private:
+    std::mutex indexMutex_ {};
+    bool isPopulated_ {false};
+    std::unordered_map<int32_t, ExemptionIndexEntry> entries_ {};
+    uint64_t populateCount_ {0};
+    uint64_t reuseCount_ {0};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_STRATEGY_INCLUDE_EXEMPTION_INDEX_H
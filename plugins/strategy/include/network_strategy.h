@@ -22,12 +22,13 @@ namespace DevStandbyMgr {
 class NetworkStrategy : public BaseNetworkStrategy {
 public:
     void HandleEvent(const StandbyMessage& message) override;
+    StandbyEventMask GetEventInterest() const override;
     ErrCode OnCreated() override;
     ErrCode OnDestroy() override;
     void ShellDump(const std::vector<std::string>& argsInStr, std::string& result) override;
 
 protected:
-    virtual void SetFirewallAllowedList(const std::vector<uint32_t>& uids, bool isAdded) override;
+    virtual bool SetFirewallAllowedList(const std::vector<uint32_t>& uids, bool isAdded) override;
     void UpdateDeviceIdleIptable(bool enableFirewall);
     void StartNetLimit(const StandbyMessage& message);
     void StopNetLimit(const StandbyMessage& message);
@@ -16,7 +16,9 @@
 #define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_STRATEGY_INCLUDE_RUNNINGLOCK_STRATEGY_H
 #include "ibase_strategy.h"
 
+#include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <set>
 #include <string>
 
@@ -36,6 +38,12 @@ struct ProxiedProcInfo {
     uint8_t appExemptionFlag_ {0};
 };
 
+// resolved system app, exemption and restriction flag of an app
+struct AppExemptionCache {
+    std::string name_ {""};
+    uint8_t appExemptionFlag_ {0};
+};
+
 class RunningLockStrategy : public IBaseStrategy {
 public:
     /**
@@ -43,6 +51,11 @@ public:
      */
     void HandleEvent(const StandbyMessage& message) override;
 
+    /**
+     * @brief messages handled by RunningLockStrategy.
+     */
+    StandbyEventMask GetEventInterest() const override;
+
     /**
      * @brief RunningLockStrategy OnCreated.
      *
@@ -72,6 +85,10 @@ protected:
     void SetProxiedAppList(std::vector<std::pair<int32_t, int32_t>>& proxiedAppList,
         const ProxiedProcInfo& info);
     void ProxyRunningLockList(bool isProxied, const std::vector<std::pair<int32_t, int32_t>>& proxiedAppList);
+    // queue proxy of processes, queued operations are sent in one call per direction when flushed
+    void QueueProxyRunningLock(bool isProxied, const std::vector<std::pair<int32_t, int32_t>>& proxiedAppList);
+    // flushed synchronously before proxy status of all apps changes
+    void FlushProxyRunningLocks();
 private:
     // update exemtion list when received exemtion list changed event
     ErrCode UpdateExemptionList(const StandbyMessage& message);
@@ -85,16 +102,8 @@ private:
     ErrCode UpdateBgTaskAppStatus(const StandbyMessage& message);
     void ResetProxyStatus(const StandbyMessage& message);
 
-    // application in exemption list or with bgtask will not be proxied.
+    // application in exemption list or with bgtask will not be proxied, app state is read from exemption index.
     ErrCode InitProxiedAppInfo();
-    // get all apps, system apps defaultly not be restricted.
-    ErrCode GetAllAppInfos();
-    ErrCode GetAllRunningAppInfo();
-    ErrCode GetForegroundApplications();
-    // get running work scheduler task and add work_scheduler flag to relative apps.
-    ErrCode GetWorkSchedulerTask();
-    // get background task, including continuous task and transient, defaultly not be constricted.
-    ErrCode GetBackgroundTaskApp();
     // get exemption app list from standby service
     ErrCode GetExemptionConfig();
 
@@ -103,6 +112,11 @@ private:
 
     void GetAndCreateAppInfo(uint32_t uid, uint32_t pid, const std::string& bundleName);
     ErrCode GetExemptionConfigForApp(ProxiedProcInfo& appInfo, const std::string& bundleName);
+    // resolve the flags of app from exemptionCache_, only app unknown to the cache costs an ipc
+    uint8_t ResolveExemptionFlag(int32_t uid, const std::string& bundleName);
+    // apply an allow list change of bundleName to the cache, returns whether it is still exempted
+    bool UpdateExemptionCache(const std::string& bundleName, bool added);
+    bool IsNameInAllowList(const std::string& bundleName);
 
     void DumpShowDetailInfo(const std::vector<std::string>& argsInStr, std::string& result);
 protected:
@@ -112,7 +126,17 @@ private:
     // proxyed app and native process info
     std::unordered_map<std::string, ProxiedProcInfo> proxiedAppInfo_;
 
-    std::unordered_map<std::int32_t, std::string> uidBundleNmeMap_;
+    // built when proxy starts and maintained by allow list changes, cleared with proxy record
+    std::unordered_map<std::int32_t, AppExemptionCache> exemptionCache_;
+    std::unordered_set<std::string> allowNameSet_;
+    std::unordered_set<std::string> restrictNameSet_;
+
+    // pending proxy operation of (pid, uid), true for proxy
+    std::map<std::pair<int32_t, int32_t>, bool> pendingProxyOps_;
+    bool isProxyFlushPosted_ {false};
+    uint64_t queuedProxyOpCount_ {0};
+    uint64_t cancelledProxyOpCount_ {0};
+    uint64_t proxyCallCount_ {0};
 };
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
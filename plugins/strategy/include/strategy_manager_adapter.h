@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_STRATEGY_INCLUDE_STRATEGY_MANAGER_ADAPTER_H
 #define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_STRATEGY_INCLUDE_STRATEGY_MANAGER_ADAPTER_H
 
+#include <array>
 #include <vector>
 
 #include "istrategy_manager_adapter.h"
@@ -30,9 +31,20 @@ public:
     bool UnInit() override;
     void HandleEvent(const StandbyMessage& messageType) override;
     void ShellDump(const std::vector<std::string>& argsInStr, std::string& result) override;
+    StandbyEventMask GetEventInterest() const override;
 
 protected:
     void RegisterPolicy(const std::vector<std::string>& strategies) override;
+
+private:
+    void BuildEventRoutes();
+
+private:
+    // strategies interested in each message type, indexed by eventId_
+    std::array<std::vector<std::shared_ptr<IBaseStrategy>>, MAX_MASKED_EVENT_ID> eventRoutes_ {};
+    StandbyEventMask eventInterest_ {0};
+    uint64_t deliveredCount_ {0};
+    uint64_t skippedCount_ {0};
 };
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
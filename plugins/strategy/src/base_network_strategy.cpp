@@ -15,14 +15,8 @@
 #include "base_network_strategy.h"
 #include <algorithm>
 #include "system_ability_definition.h"
-#ifdef STANDBY_RSS_WORK_SCHEDULER_ENABLE
-#include "workscheduler_srv_client.h"
-#endif
 
 #include "standby_service_log.h"
-#ifdef ENABLE_BACKGROUND_TASK_MGR
-#include "background_task_helper.h"
-#endif
 #ifdef STANDBY_COMMUNICATION_NETMANAGER_BASE_ENABLE
 #include "net_policy_client.h"
 #endif
@@ -35,6 +29,7 @@
 #include "time_provider.h"
 #include "standby_service_impl.h"
 #include "common_constant.h"
+#include "exemption_index.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
@@ -45,6 +40,9 @@ const std::map<std::string, uint8_t> BGTASK_EXEMPTION_FLAG_MAP {
     {WORK_SCHEDULER, ExemptionTypeFlag::WORK_SCHEDULER},
 };
 const std::string CONDITIONAL_RESTRICT_NET_APP_TAG = "conditional_restrict_net_app";
+const std::string SYNC_TRUSTLIST_TASK = "SyncNetTrustlistTask";
+const std::string TAG_TRUSTLIST_SYNC_DELAY = "trustlist_sync_delay";
+const int32_t TRUSTLIST_SYNC_DELAY = 50;
 }
 
 bool BaseNetworkStrategy::isFirewallEnabled_ = false;
@@ -74,6 +72,14 @@ void BaseNetworkStrategy::HandleEvent(const StandbyMessage& message)
     }
 }
 
+StandbyEventMask BaseNetworkStrategy::GetEventInterest() const
+{
+    return GetEventMask(StandbyMessageType::ALLOW_LIST_CHANGED) |
+        GetEventMask(StandbyMessageType::BG_TASK_STATUS_CHANGE) |
+        GetEventMask(StandbyMessageType::PROCESS_STATE_CHANGED) |
+        GetEventMask(StandbyMessageType::SYS_ABILITY_STATUS_CHANGED);
+}
+
 ErrCode BaseNetworkStrategy::OnCreated()
 {
     // when initialized, stop net limit mode in case of unexpected process restart
@@ -91,10 +97,12 @@ ErrCode BaseNetworkStrategy::OnDestroy()
 
 ErrCode BaseNetworkStrategy::UpdateExemptionList(const StandbyMessage& message)
 {
-    if (!message.want_.has_value()) {
+    AllowListChangedPayload decoded;
+    const AllowListChangedPayload* payload = message.GetPayload(decoded);
+    if (payload == nullptr) {
         return ERR_STANDBY_OBJECT_NULL;
     }
-    uint32_t allowType = static_cast<uint32_t>(message.want_->GetIntParam("allowType", 0));
+    uint32_t allowType = payload->allowType_;
     if ((allowType & AllowType::NETWORK) == 0) {
         STANDBYSERVICE_LOGD("allowType is not network, currentType is %{public}d", allowType);
         return ERR_STANDBY_STRATEGY_NOT_MATCH;
@@ -103,23 +111,26 @@ ErrCode BaseNetworkStrategy::UpdateExemptionList(const StandbyMessage& message)
         STANDBYSERVICE_LOGD("current state is not sleep or maintenance, ignore exemption");
         return ERR_STANDBY_CURRENT_STATE_NOT_MATCH;
     }
-    // start update exemption flag
-    std::string processName = message.want_->GetStringParam("name");
-    bool added = message.want_->GetBoolParam("added", false);
-    int32_t uid = message.want_->GetIntParam("uid", -1);
-    STANDBYSERVICE_LOGI("updatee exemption list, %{public}s apply exemption, added is %{public}d",
-        processName.c_str(), added);
-    if (added) {
-        AddExemptionFlag(uid, processName, ExemptionTypeFlag::EXEMPTION);
-    } else {
-        RemoveExemptionFlag(uid, ExemptionTypeFlag::EXEMPTION);
+    // start update exemption flag, the message carries the net diff of allow list
+    for (const auto& change : payload->changes_) {
+        if ((change.allowType_ & AllowType::NETWORK) == 0) {
+            continue;
+        }
+        STANDBYSERVICE_LOGI("updatee exemption list, %{public}s apply exemption, added is %{public}d",
+            change.name_.c_str(), static_cast<int32_t>(change.added_));
+        if (change.added_) {
+            AddExemptionFlag(change.uid_, change.name_, ExemptionTypeFlag::EXEMPTION);
+        } else {
+            RemoveExemptionFlag(change.uid_, ExemptionTypeFlag::EXEMPTION);
+        }
     }
     return ERR_OK;
 }
 
 ErrCode BaseNetworkStrategy::UpdateFirewallAllowList()
 {
-    ResetFirewallAllowList();
+    // keep the trustlist, it is synchronized by diff after app info is rebuilt
+    HandleDeviceIdlePolicy(false);
     netLimitedAppInfo_.clear();
     if (InitNetLimitedAppInfo() != ERR_OK) {
         return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
@@ -159,116 +170,38 @@ ErrCode BaseNetworkStrategy::EnableNetworkFirewallInner()
     return ERR_OK;
 }
 
-// get app info, add exemption according to the status of app.
+// get app info from the shared exemption index, add exemption according to the status of app.
 ErrCode BaseNetworkStrategy::InitNetLimitedAppInfo()
 {
-    if (GetAllRunningAppInfo() != ERR_OK) {
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    std::vector<AppExecFwk::ApplicationInfo> applicationInfos {};
-    if (!BundleManagerHelper::GetInstance()->GetApplicationInfos(
-        AppExecFwk::ApplicationFlag::GET_BASIC_APPLICATION_INFO,
-        AppExecFwk::Constants::ALL_USERID, applicationInfos)) {
-        STANDBYSERVICE_LOGW("failed to get all applicationInfos");
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    if (!BundleManagerHelper::GetInstance()->GetApplicationInfos(
-        AppExecFwk::ApplicationFlag::GET_BASIC_APPLICATION_INFO,
-        UserSpace::SPECIAL_USERID, applicationInfos)) {
-        STANDBYSERVICE_LOGW("failed to get special applicationInfos");
-    }
-    STANDBYSERVICE_LOGI("succeed GetApplicationInfos, size is %{public}d",
-        static_cast<int32_t>(applicationInfos.size()));
-    for (const auto& info : applicationInfos) {
-        if (netLimitedAppInfo_.find(info.uid) == netLimitedAppInfo_.end()) {
-            continue;
-        }
-        if (info.isSystemApp) {
-            netLimitedAppInfo_[info.uid].appExemptionFlag_ |= ExemptionTypeFlag::UNRESTRICTED;
-        }
-    }
-
-    if (GetForegroundApplications() !=ERR_OK || GetBackgroundTaskApp() != ERR_OK ||
-        GetWorkSchedulerTask() != ERR_OK || GetExemptionConfig() != ERR_OK) {
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    return ERR_OK;
-}
-
-ErrCode BaseNetworkStrategy::GetAllRunningAppInfo()
-{
-    std::vector<AppExecFwk::RunningProcessInfo> allAppProcessInfos {};
-    if (!AppMgrHelper::GetInstance()->GetAllRunningProcesses(allAppProcessInfos)) {
-        STANDBYSERVICE_LOGE("connect to app manager service failed");
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    STANDBYSERVICE_LOGI("current running processes size %{public}d", static_cast<int32_t>(allAppProcessInfos.size()));
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto &info : allAppProcessInfos) {
-        netLimitedAppInfo_.emplace(info.uid_, NetLimtedAppInfo {info.processName_});
-    }
-    return ERR_OK;
-}
-
-ErrCode BaseNetworkStrategy::GetForegroundApplications()
-{
-    std::vector<AppExecFwk::AppStateData> fgApps {};
-    if (!AppMgrHelper::GetInstance()->GetForegroundApplications(fgApps)) {
-        STANDBYSERVICE_LOGW("get foreground app failed");
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    for (const auto& appInfo : fgApps) {
-        AddExemptionFlagByUid(appInfo.uid, ExemptionTypeFlag::FOREGROUND_APP);
-    }
-    return ERR_OK;
-}
-
-ErrCode BaseNetworkStrategy::GetBackgroundTaskApp()
-{
-    #ifdef ENABLE_BACKGROUND_TASK_MGR
-    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> continuousTaskList;
-    if (!BackgroundTaskHelper::GetInstance()->GetContinuousTaskApps(continuousTaskList)) {
-        STANDBYSERVICE_LOGW("get continuous task app failed");
+    auto exemptionIndex = ExemptionIndex::GetInstance();
+    if (exemptionIndex->Populate() != ERR_OK) {
         return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
     }
-    STANDBYSERVICE_LOGD("succeed GetContinuousTaskApps, size is %{public}d",
-        static_cast<int32_t>(continuousTaskList.size()));
-    std::vector<std::shared_ptr<TransientTaskAppInfo>> transientTaskList;
-    if (!BackgroundTaskHelper::GetInstance()->GetTransientTaskApps(transientTaskList)) {
-        STANDBYSERVICE_LOGW("get transient task app failed");
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    STANDBYSERVICE_LOGD("succeed GetTransientTaskApps, size is %{public}d",
-        static_cast<int32_t>(transientTaskList.size()));
     condition_ = TimeProvider::GetCondition();
-    for (const auto& task : continuousTaskList) {
-        if (auto infoIter = netLimitedAppInfo_.find(task->GetCreatorUid()); infoIter == netLimitedAppInfo_.end()) {
-            continue;
-        } else if (condition_ == ConditionType::DAY_STANDBY ||
-            (nightExemptionTaskType_ & (1<< task->GetTypeId())) != 0) {
-            infoIter->second.appExemptionFlag_ |= ExemptionTypeFlag::CONTINUOUS_TASK;
-        }
-    }
-    for (const auto& task : transientTaskList) {
-        AddExemptionFlagByUid(task->GetUid(), ExemptionTypeFlag::TRANSIENT_TASK);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exemptionIndex->ForEachEntry([this](int32_t uid, const ExemptionIndexEntry& entry) {
+            // only running process is restricted
+            if (entry.pids_.empty()) {
+                return;
+            }
+            netLimitedAppInfo_.emplace(uid, NetLimtedAppInfo {entry.processName_});
+            AddExemptionFlagByUid(uid, GetAppStateFlag(entry));
+        });
     }
-    #endif
-    return ERR_OK;
+    STANDBYSERVICE_LOGI("net limited app info size is %{public}d", static_cast<int32_t>(netLimitedAppInfo_.size()));
+    return GetExemptionConfig();
 }
 
-ErrCode BaseNetworkStrategy::GetWorkSchedulerTask()
+uint8_t BaseNetworkStrategy::GetAppStateFlag(const ExemptionIndexEntry& entry)
 {
-    #ifdef STANDBY_RSS_WORK_SCHEDULER_ENABLE
-    std::list<std::shared_ptr<WorkScheduler::WorkInfo>> workInfos;
-    if (WorkScheduler::WorkSchedulerSrvClient::GetInstance().GetAllRunningWorks(workInfos) != ERR_OK) {
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    STANDBYSERVICE_LOGD("GetWorkSchedulerTask succeed, size is %{public}d", static_cast<int32_t>(workInfos.size()));
-    for (const auto& task : workInfos) {
-        AddExemptionFlagByUid(task->GetUid(), ExemptionTypeFlag::WORK_SCHEDULER);
+    uint8_t flag = entry.appExemptionFlag_ & (~ExemptionTypeFlag::CONTINUOUS_TASK);
+    // in night, only continuous task of configured type is exempted
+    if ((entry.appExemptionFlag_ & ExemptionTypeFlag::CONTINUOUS_TASK) != 0 &&
+        (condition_ == ConditionType::DAY_STANDBY || (nightExemptionTaskType_ & entry.continuousTaskTypes_) != 0)) {
+        flag |= ExemptionTypeFlag::CONTINUOUS_TASK;
     }
-    #endif
-    return ERR_OK;
+    return flag;
 }
 
 void BaseNetworkStrategy::AddExemptionFlagByUid(int32_t uid, uint8_t flag)
@@ -305,11 +238,11 @@ ErrCode BaseNetworkStrategy::GetExemptionConfig()
         value.appExemptionFlag_ |= ExemptionTypeFlag::RESTRICTED;
     }
     // if app in conditional restricted list and not exempted, add retricted flag
-    std::vector<std::string> conditionalRestrictNameList =
+    auto conditionalRestrictNameList =
         StandbyConfigManager::GetInstance()->GetStandbyListPara(CONDITIONAL_RESTRICT_NET_APP_TAG);
     for (auto& [key, value] : netLimitedAppInfo_) {
-        auto it = std::find(conditionalRestrictNameList.begin(), conditionalRestrictNameList.end(), value.name_);
-        if (it == conditionalRestrictNameList.end()) {
+        auto it = std::find(conditionalRestrictNameList->begin(), conditionalRestrictNameList->end(), value.name_);
+        if (it == conditionalRestrictNameList->end()) {
             continue;
         }
         if ((value.appExemptionFlag_ & (~ExemptionTypeFlag::UNRESTRICTED)) == 0) {
@@ -342,10 +275,10 @@ ErrCode BaseNetworkStrategy::GetExemptionConfigForApp(NetLimtedAppInfo& appInfo,
     }
 
     // if app in conditional restricted list and not exempted, add retricted flag
-    std::vector<std::string> conditionalRestrictNameList =
+    auto conditionalRestrictNameList =
         StandbyConfigManager::GetInstance()->GetStandbyListPara(CONDITIONAL_RESTRICT_NET_APP_TAG);
-    auto it = std::find(conditionalRestrictNameList.begin(), conditionalRestrictNameList.end(), bundleName);
-    if (it != conditionalRestrictNameList.end()) {
+    auto it = std::find(conditionalRestrictNameList->begin(), conditionalRestrictNameList->end(), bundleName);
+    if (it != conditionalRestrictNameList->end()) {
         if ((appInfo.appExemptionFlag_ & (~ExemptionTypeFlag::UNRESTRICTED)) == 0) {
             appInfo.appExemptionFlag_ |= ExemptionTypeFlag::RESTRICTED;
         }
@@ -355,18 +288,88 @@ ErrCode BaseNetworkStrategy::GetExemptionConfigForApp(NetLimtedAppInfo& appInfo,
 
 void BaseNetworkStrategy::SetNetAllowApps(bool isAllow)
 {
-    std::vector<uint32_t> uids;
+    // recalculate the whole trustlist, queued changes are covered by it
+    pendingTrustlist_.clear();
     for (const auto& [key, value] : netLimitedAppInfo_) {
-        if (!IsFlagExempted(value.appExemptionFlag_)) {
+        if (!isAllow || !IsFlagExempted(value.appExemptionFlag_)) {
             continue;
         }
-        uids.emplace_back(key);
+        pendingTrustlist_[key] = true;
         STANDBYSERVICE_LOGD("uid: %{public}d, name: %{public}s, isAllow: %{public}d",
             key, value.name_.c_str(), isAllow);
     }
+    // uid pushed before but not exempted now is removed
+    for (const auto& uid : trustlistShadow_) {
+        pendingTrustlist_.emplace(uid, false);
+    }
+    trustlistChangedCount_ += pendingTrustlist_.size();
     STANDBYSERVICE_LOGD("all application size: %{public}d, network allow: %{public}d",
-        static_cast<int32_t>(netLimitedAppInfo_.size()), static_cast<int32_t>(uids.size()));
-    SetFirewallAllowedList(uids, isAllow);
+        static_cast<int32_t>(netLimitedAppInfo_.size()), static_cast<int32_t>(pendingTrustlist_.size()));
+    FlushTrustlistChanges();
+}
+
+void BaseNetworkStrategy::QueueTrustlistChange(const std::vector<uint32_t>& uids, bool isAdded)
+{
+    for (const auto& uid : uids) {
+        pendingTrustlist_[uid] = isAdded;
+    }
+    trustlistChangedCount_ += uids.size();
+    if (isTrustlistSyncPosted_) {
+        return;
+    }
+    auto& handler = StandbyServiceImpl::GetInstance()->GetHandler();
+    if (handler == nullptr) {
+        FlushTrustlistChanges();
+        return;
+    }
+    int32_t syncDelay = StandbyConfigManager::GetInstance()->GetStandbyParam(TAG_TRUSTLIST_SYNC_DELAY);
+    syncDelay = (syncDelay <= 0) ? TRUSTLIST_SYNC_DELAY : syncDelay;
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::STRATEGY, [this]() { this->FlushTrustlistChanges(); },
+        SYNC_TRUSTLIST_TASK, syncDelay);
+    isTrustlistSyncPosted_ = true;
+}
+
+void BaseNetworkStrategy::FlushTrustlistChanges()
+{
+    isTrustlistSyncPosted_ = false;
+    if (isIdleMaintence_) {
+        // firewall is disabled in maintenance, the trustlist is recalculated when maintenance exits
+        return;
+    }
+    std::vector<uint32_t> addedUids;
+    std::vector<uint32_t> removedUids;
+    for (const auto& [uid, isAdded] : pendingTrustlist_) {
+        bool isPushed = trustlistShadow_.find(uid) != trustlistShadow_.end();
+        if (isAdded && !isPushed) {
+            addedUids.emplace_back(uid);
+        } else if (!isAdded && isPushed) {
+            removedUids.emplace_back(uid);
+        }
+    }
+    pendingTrustlist_.clear();
+    SendTrustlistDiff(addedUids, true);
+    SendTrustlistDiff(removedUids, false);
+}
+
+void BaseNetworkStrategy::SendTrustlistDiff(const std::vector<uint32_t>& uids, bool isAdded)
+{
+    if (uids.empty()) {
+        return;
+    }
+    ++trustlistCallCount_;
+    if (!SetFirewallAllowedList(uids, isAdded)) {
+        // the call may have been partially applied, read the trustlist back when it is reset
+        isTrustlistKnown_ = false;
+        return;
+    }
+    trustlistSentCount_ += uids.size();
+    for (const auto& uid : uids) {
+        if (isAdded) {
+            trustlistShadow_.emplace(uid);
+        } else {
+            trustlistShadow_.erase(uid);
+        }
+    }
 }
 
 ErrCode BaseNetworkStrategy::DisableNetworkFirewall(const StandbyMessage& message)
@@ -429,13 +432,15 @@ ErrCode BaseNetworkStrategy::UpdateBgTaskAppStatus(const StandbyMessage& message
         STANDBYSERVICE_LOGD("current state is not sleep or maintenance, ignore exemption");
         return ERR_STANDBY_CURRENT_STATE_NOT_MATCH;
     }
-    if (!message.want_.has_value()) {
+    BgTaskStatusPayload decoded;
+    const BgTaskStatusPayload* payload = message.GetPayload(decoded);
+    if (payload == nullptr) {
         return ERR_STANDBY_OBJECT_NULL;
     }
-    std::string type = message.want_->GetStringParam(BG_TASK_TYPE);
-    bool started = message.want_->GetBoolParam(BG_TASK_STATUS, false);
-    int32_t uid = message.want_->GetIntParam(BG_TASK_UID, 0);
-    std::string bundleName = message.want_->GetStringParam(BG_TASK_BUNDLE_NAME);
+    const std::string& type = payload->type_;
+    bool started = payload->started_;
+    int32_t uid = payload->uid_;
+    std::string bundleName = payload->bundleName_;
     if (BGTASK_EXEMPTION_FLAG_MAP.find(type) == BGTASK_EXEMPTION_FLAG_MAP.end()) {
         return ERR_STANDBY_KEY_INFO_NOT_MATCH;
     }
@@ -448,7 +453,7 @@ ErrCode BaseNetworkStrategy::UpdateBgTaskAppStatus(const StandbyMessage& message
             return ERR_STANDBY_KEY_INFO_NOT_MATCH;
         }
         if (condition_ == ConditionType::NIGHT_STANDBY && type == CONTINUOUS_TASK) {
-            int32_t typeId = message.want_->GetIntParam(BG_TASK_TYPE_ID, -1);
+            int32_t typeId = payload->typeId_;
             if (typeId < 0 || (nightExemptionTaskType_ & (1 << typeId)) == 0) {
                 STANDBYSERVICE_LOGI("uid %{public}d continuous task typeid %{public}d not exempted in night",
                     uid, typeId);
@@ -473,12 +478,14 @@ void BaseNetworkStrategy::HandleProcessStatusChanged(const StandbyMessage& messa
         STANDBYSERVICE_LOGD("current state is not sleep or maintenance, ignore state of process");
         return;
     }
-    if (!message.want_.has_value()) {
+    ProcessStateChangedPayload decoded;
+    const ProcessStateChangedPayload* payload = message.GetPayload(decoded);
+    if (payload == nullptr) {
         return;
     }
-    int32_t uid = message.want_->GetIntParam("uid", -1);
-    std::string bundleName = message.want_->GetStringParam("name");
-    bool isCreated = message.want_->GetBoolParam("isCreated", false);
+    int32_t uid = payload->uid_;
+    const std::string& bundleName = payload->name_;
+    bool isCreated = payload->isCreated_;
     STANDBYSERVICE_LOGI("Process Status Changed uid: %{public}d, bundleName: %{public}s, isCreated: %{public}d",
         uid, bundleName.c_str(), isCreated);
     condition_ = TimeProvider::GetCondition();
@@ -488,7 +495,7 @@ void BaseNetworkStrategy::HandleProcessStatusChanged(const StandbyMessage& messa
         if (!IsFlagExempted(iter->second.appExemptionFlag_)) {
             return;
         }
-        SetFirewallAllowedList({uid}, isCreated);
+        QueueTrustlistChange({uid}, isCreated);
     } else {
         bool isRunning {false};
         if (AppMgrHelper::GetInstance()->GetAppRunningStateByBundleName(bundleName, isRunning) && !isRunning) {
@@ -503,7 +510,7 @@ void BaseNetworkStrategy::HandleProcessStatusChanged(const StandbyMessage& messa
                 STANDBYSERVICE_LOGI("uid: %{public}d flag: %{public}d is not exempted", uid, appFlag);
                 return;
             }
-            SetFirewallAllowedList({uid}, isCreated);
+            QueueTrustlistChange({uid}, isCreated);
         }
     }
 }
@@ -535,14 +542,14 @@ void BaseNetworkStrategy::AddExemptionFlag(uint32_t uid, const std::string& bund
     }
     auto lastAppExemptionFlag = iter->second.appExemptionFlag_;
     iter->second.appExemptionFlag_ |= flag;
-    std::vector<std::string> conditionalRestrictNameList =
+    auto conditionalRestrictNameList =
         StandbyConfigManager::GetInstance()->GetStandbyListPara(CONDITIONAL_RESTRICT_NET_APP_TAG);
-    auto it = std::find(conditionalRestrictNameList.begin(), conditionalRestrictNameList.end(), bundleName);
-    if (it != conditionalRestrictNameList.end()) {
+    auto it = std::find(conditionalRestrictNameList->begin(), conditionalRestrictNameList->end(), bundleName);
+    if (it != conditionalRestrictNameList->end()) {
         iter->second.appExemptionFlag_ &= (~ExemptionTypeFlag::RESTRICTED);
     }
     if (GetExemptedFlag(lastAppExemptionFlag, iter->second.appExemptionFlag_)) {
-        SetFirewallAllowedList({iter->first}, true);
+        QueueTrustlistChange({iter->first}, true);
     }
     iter->second.appExemptionFlag_ |= flag;
 }
@@ -560,16 +567,16 @@ void BaseNetworkStrategy::RemoveExemptionFlag(uint32_t uid, uint8_t flag)
     STANDBYSERVICE_LOGD("RemoveExemptionFlag uid is flag is %{public}d, flag is %{public}d", uid, flag);
     auto lastAppExemptionFlag = iter->second.appExemptionFlag_;
     iter->second.appExemptionFlag_ &= (~flag);
-    std::vector<std::string> conditionalRestrictNameList =
+    auto conditionalRestrictNameList =
         StandbyConfigManager::GetInstance()->GetStandbyListPara(CONDITIONAL_RESTRICT_NET_APP_TAG);
-    auto it = std::find(conditionalRestrictNameList.begin(), conditionalRestrictNameList.end(), iter->second.name_);
-    if (it != conditionalRestrictNameList.end()) {
+    auto it = std::find(conditionalRestrictNameList->begin(), conditionalRestrictNameList->end(), iter->second.name_);
+    if (it != conditionalRestrictNameList->end()) {
         if ((iter->second.appExemptionFlag_ & (~ExemptionTypeFlag::UNRESTRICTED)) == 0) {
             iter->second.appExemptionFlag_ |= ExemptionTypeFlag::RESTRICTED;
         }
     }
     if (GetExemptedFlag(iter->second.appExemptionFlag_, lastAppExemptionFlag)) {
-        SetFirewallAllowedList({iter->first}, false);
+        QueueTrustlistChange({iter->first}, false);
     }
 }
 
@@ -589,10 +596,18 @@ bool BaseNetworkStrategy::GetExemptedFlag(uint8_t appNoExemptionFlag, uint8_t ap
 
 void BaseNetworkStrategy::ResetFirewallAllowList()
 {
+    pendingTrustlist_.clear();
+    if (isTrustlistSyncPosted_) {
+        StandbyServiceImpl::GetInstance()->RemoveLaneTask(SYNC_TRUSTLIST_TASK);
+        isTrustlistSyncPosted_ = false;
+    }
     #ifdef STANDBY_COMMUNICATION_NETMANAGER_BASE_ENABLE
     STANDBYSERVICE_LOGI("start reset firewall allow list");
     std::vector<uint32_t> uids;
-    if (DelayedSingleton<NetManagerStandard::NetPolicyClient>::GetInstance()->
+    if (isTrustlistKnown_) {
+        // the shadow holds every uid pushed by the strategy, no need to read the trustlist back
+        uids.assign(trustlistShadow_.begin(), trustlistShadow_.end());
+    } else if (DelayedSingleton<NetManagerStandard::NetPolicyClient>::GetInstance()->
         GetDeviceIdleTrustlist(uids) != NETMANAGER_SUCCESS) {
         STANDBYSERVICE_LOGE("get deviceIdle netLimited list is failed");
         return;
@@ -602,10 +617,14 @@ void BaseNetworkStrategy::ResetFirewallAllowList()
         STANDBYSERVICE_LOGE("handle device idle policy netLimited is false");
         return;
     }
-    if (DelayedSingleton<NetManagerStandard::NetPolicyClient>::GetInstance()->
+    if (!uids.empty() && DelayedSingleton<NetManagerStandard::NetPolicyClient>::GetInstance()->
         SetDeviceIdleTrustlist(uids, false) != NETMANAGER_SUCCESS) {
         STANDBYSERVICE_LOGE("SetFirewallAllowedList failed");
+        isTrustlistKnown_ = false;
+        return;
     }
+    trustlistShadow_.clear();
+    isTrustlistKnown_ = true;
     #endif
 }
 
@@ -624,8 +643,8 @@ ErrCode BaseNetworkStrategy::SetFirewallStatus(bool enableFirewall)
     } else {
         int32_t ret = HandleDeviceIdlePolicy(enableFirewall);
         if (ret == NETMANAGER_SUCCESS || (!enableFirewall && ret == NETMANAGER_ERR_STATUS_EXIST)) {
+            // trustlist is kept while firewall is disabled in maintenance, and synchronized by diff when exits
             STANDBYSERVICE_LOGI("Succeed to disable powersaving firewall");
-            SetNetAllowApps(enableFirewall);
             return ERR_OK;
         } else {
             STANDBYSERVICE_LOGE("Failed to disable powersaving firewall");
@@ -644,8 +663,7 @@ void BaseNetworkStrategy::GetAndCreateAppInfo(uint32_t uid, const std::string& b
     std::lock_guard<std::mutex> lock(mutex_);
     std::tie(iter, std::ignore) = netLimitedAppInfo_.emplace(uid, NetLimtedAppInfo {bundleName});
 
-    bool isSystemApp {false};
-    if (BundleManagerHelper::GetInstance()->CheckIsSystemAppByUid(uid, isSystemApp) && isSystemApp) {
+    if (ExemptionIndex::GetInstance()->IsSystemApp(uid)) {
         iter->second.appExemptionFlag_ |= ExemptionTypeFlag::UNRESTRICTED;
     }
     GetExemptionConfigForApp(iter->second, bundleName);
@@ -654,18 +672,19 @@ void BaseNetworkStrategy::GetAndCreateAppInfo(uint32_t uid, const std::string& b
 // when bgtask or work_scheduler service crash, reset relative flag
 void BaseNetworkStrategy::ResetFirewallStatus(const StandbyMessage& message)
 {
-    if (!isFirewallEnabled_ || isIdleMaintence_) {
-        return;
-    }
     if (!message.want_.has_value()) {
         STANDBYSERVICE_LOGW("ResetFirewallStatus message.want_ is null");
         return;
     }
     bool isAdded = message.want_->GetBoolParam(SA_STATUS, false);
-    if (isAdded) {
+    int32_t saId = message.want_->GetIntParam(SA_ID, 0);
+    if (saId == COMM_NET_POLICY_MANAGER_SYS_ABILITY_ID) {
+        HandleNetPolicyStatusChanged(isAdded);
+        return;
+    }
+    if (!isFirewallEnabled_ || isIdleMaintence_ || isAdded) {
         return;
     }
-    int32_t saId = message.want_->GetIntParam(SA_ID, 0);
     if (saId != WORK_SCHEDULE_SERVICE_ID && saId != BACKGROUND_TASK_MANAGER_SERVICE_ID) {
         return;
     }
@@ -679,6 +698,24 @@ void BaseNetworkStrategy::ResetFirewallStatus(const StandbyMessage& message)
     return;
 }
 
+void BaseNetworkStrategy::HandleNetPolicyStatusChanged(bool isAdded)
+{
+    if (!isAdded) {
+        STANDBYSERVICE_LOGI("net policy service is removed, drop the trustlist shadow");
+        trustlistShadow_.clear();
+        isTrustlistKnown_ = false;
+        return;
+    }
+    if (!isFirewallEnabled_ || isIdleMaintence_) {
+        return;
+    }
+    STANDBYSERVICE_LOGI("net policy service is restarted, enable firewall again");
+    trustlistShadow_.clear();
+    if (SetFirewallStatus(true) != ERR_OK) {
+        STANDBYSERVICE_LOGE("failed to enable firewall after net policy service restarts");
+    }
+}
+
 std::string BaseNetworkStrategy::UidsToString(const std::vector<uint32_t>& uids)
 {
     std::string str = "[";
@@ -696,6 +733,10 @@ void BaseNetworkStrategy::ShellDump(const std::vector<std::string>& argsInStr, s
 {
     result.append("Network Strategy:\n").append("isFirewallEnabled: " + std::to_string(isFirewallEnabled_))
         .append(" isIdleMaintence: " + std::to_string(isIdleMaintence_)).append("\n");
+    result.append("trustlist size: " + std::to_string(trustlistShadow_.size()))
+        .append(" uids changed: " + std::to_string(trustlistChangedCount_))
+        .append(" uids sent: " + std::to_string(trustlistSentCount_))
+        .append(" calls: " + std::to_string(trustlistCallCount_)).append("\n");
     result.append("limited app info: \n");
     for (const auto& [key, value] : netLimitedAppInfo_) {
         result.append("uid: ").append(std::to_string(key)).append(" name: ").append(value.name_).append(" uid: ")
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exemption_index.h"
+
+#include "system_ability_definition.h"
+#ifdef STANDBY_RSS_WORK_SCHEDULER_ENABLE
+#include "workscheduler_srv_client.h"
+#endif
+
+#include "standby_service_log.h"
+#ifdef ENABLE_BACKGROUND_TASK_MGR
+#include "background_task_helper.h"
+#endif
+#include "app_mgr_helper.h"
+#include "bundle_manager_helper.h"
+#include "common_constant.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+const std::map<std::string, uint8_t> BGTASK_EXEMPTION_FLAG_MAP {
+    {CONTINUOUS_TASK, ExemptionTypeFlag::CONTINUOUS_TASK},
+    {TRANSIENT_TASK, ExemptionTypeFlag::TRANSIENT_TASK},
+    {WORK_SCHEDULER, ExemptionTypeFlag::WORK_SCHEDULER},
+};
+constexpr int32_t MAX_CONTINUOUS_TASK_TYPE_ID = 32;
+
+uint32_t GetContinuousTaskTypeBit(int32_t typeId)
+{
+    if (typeId < 0 || typeId >= MAX_CONTINUOUS_TASK_TYPE_ID) {
+        return 0;
+    }
+    return 1u << static_cast<uint32_t>(typeId);
+}
+}
+
+ExemptionIndex::ExemptionIndex() {}
+
+ExemptionIndex::~ExemptionIndex() {}
+
+std::shared_ptr<ExemptionIndex> ExemptionIndex::GetInstance()
+{
+    return DelayedSingleton<ExemptionIndex>::GetInstance();
+}
+
+ErrCode ExemptionIndex::Populate()
+{
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    if (isPopulated_) {
+        ++reuseCount_;
+        return ERR_OK;
+    }
+    entries_.clear();
+    if (GetAllAppInfos() != ERR_OK || GetAllRunningAppInfo() != ERR_OK || GetForegroundApplications() != ERR_OK ||
+        GetBackgroundTaskApp() != ERR_OK || GetWorkSchedulerTask() != ERR_OK) {
+        STANDBYSERVICE_LOGW("failed to populate exemption index");
+        entries_.clear();
+        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
+    }
+    isPopulated_ = true;
+    ++populateCount_;
+    STANDBYSERVICE_LOGI("exemption index is populated, size is %{public}d", static_cast<int32_t>(entries_.size()));
+    return ERR_OK;
+}
+
+void ExemptionIndex::Invalidate()
+{
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    isPopulated_ = false;
+    entries_.clear();
+}
+
+ErrCode ExemptionIndex::GetAllAppInfos()
+{
+    std::vector<AppExecFwk::ApplicationInfo> applicationInfos {};
+    if (!BundleManagerHelper::GetInstance()->GetApplicationInfos(
+        AppExecFwk::ApplicationFlag::GET_BASIC_APPLICATION_INFO,
+        AppExecFwk::Constants::ALL_USERID, applicationInfos)) {
+        STANDBYSERVICE_LOGW("failed to get all applicationInfos");
+        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
+    }
+    for (const auto& info : applicationInfos) {
+        auto& entry = entries_[info.uid];
+        entry.bundleName_ = info.name;
+        entry.isAppInfoKnown_ = true;
+        if (info.isSystemApp) {
+            entry.appExemptionFlag_ |= ExemptionTypeFlag::UNRESTRICTED;
+        }
+    }
+    std::vector<AppExecFwk::ApplicationInfo> specialApplicationInfos {};
+    if (!BundleManagerHelper::GetInstance()->GetApplicationInfos(
+        AppExecFwk::ApplicationFlag::GET_BASIC_APPLICATION_INFO,
+        UserSpace::SPECIAL_USERID, specialApplicationInfos)) {
+        STANDBYSERVICE_LOGW("failed to get special applicationInfos");
+    }
+    for (const auto& info : specialApplicationInfos) {
+        auto& entry = entries_[info.uid];
+        entry.isAppInfoKnown_ = true;
+        if (info.isSystemApp) {
+            entry.appExemptionFlag_ |= ExemptionTypeFlag::UNRESTRICTED;
+        }
+    }
+    STANDBYSERVICE_LOGI("succeed GetApplicationInfos, size is %{public}d",
+        static_cast<int32_t>(applicationInfos.size() + specialApplicationInfos.size()));
+    return ERR_OK;
+}
+
+ErrCode ExemptionIndex::GetAllRunningAppInfo()
+{
+    std::vector<AppExecFwk::RunningProcessInfo> allAppProcessInfos {};
+    if (!AppMgrHelper::GetInstance()->GetAllRunningProcesses(allAppProcessInfos)) {
+        STANDBYSERVICE_LOGE("connect to app manager service failed");
+        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
+    }
+    STANDBYSERVICE_LOGI("current running processes size %{public}d", static_cast<int32_t>(allAppProcessInfos.size()));
+    for (const auto& info : allAppProcessInfos) {
+        auto& entry = entries_[info.uid_];
+        if (entry.processName_.empty()) {
+            entry.processName_ = info.processName_;
+        }
+        entry.pids_.emplace(info.pid_);
+    }
+    return ERR_OK;
+}
+
+ErrCode ExemptionIndex::GetForegroundApplications()
+{
+    std::vector<AppExecFwk::AppStateData> fgApps {};
+    if (!AppMgrHelper::GetInstance()->GetForegroundApplications(fgApps)) {
+        STANDBYSERVICE_LOGW("get foreground app failed");
+        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
+    }
+    for (const auto& appInfo : fgApps) {
+        entries_[appInfo.uid].appExemptionFlag_ |= ExemptionTypeFlag::FOREGROUND_APP;
+    }
+    return ERR_OK;
+}
+
+ErrCode ExemptionIndex::GetBackgroundTaskApp()
+{
+    #ifdef ENABLE_BACKGROUND_TASK_MGR
+    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> continuousTaskList;
+    if (!BackgroundTaskHelper::GetInstance()->GetContinuousTaskApps(continuousTaskList)) {
+        STANDBYSERVICE_LOGW("get continuous task app failed");
+        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
+    }
+    STANDBYSERVICE_LOGD("succeed GetContinuousTaskApps, size is %{public}d",
+        static_cast<int32_t>(continuousTaskList.size()));
+    std::vector<std::shared_ptr<TransientTaskAppInfo>> transientTaskList;
+    if (!BackgroundTaskHelper::GetInstance()->GetTransientTaskApps(transientTaskList)) {
+        STANDBYSERVICE_LOGW("get transient task app failed");
+        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
+    }
+    STANDBYSERVICE_LOGD("succeed GetTransientTaskApps, size is %{public}d",
+        static_cast<int32_t>(transientTaskList.size()));
+    for (const auto& task : continuousTaskList) {
+        auto& entry = entries_[task->GetCreatorUid()];
+        entry.appExemptionFlag_ |= ExemptionTypeFlag::CONTINUOUS_TASK;
+        entry.continuousTaskTypes_ |= GetContinuousTaskTypeBit(task->GetTypeId());
+    }
+    for (const auto& task : transientTaskList) {
+        entries_[task->GetUid()].appExemptionFlag_ |= ExemptionTypeFlag::TRANSIENT_TASK;
+    }
+    #endif
+    return ERR_OK;
+}
+
+ErrCode ExemptionIndex::GetWorkSchedulerTask()
+{
+    #ifdef STANDBY_RSS_WORK_SCHEDULER_ENABLE
+    std::list<std::shared_ptr<WorkScheduler::WorkInfo>> workInfos;
+    if (WorkScheduler::WorkSchedulerSrvClient::GetInstance().GetAllRunningWorks(workInfos) != ERR_OK) {
+        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
+    }
+    STANDBYSERVICE_LOGD("GetWorkSchedulerTask succeed, size is %{public}d", static_cast<int32_t>(workInfos.size()));
+    for (const auto& task : workInfos) {
+        entries_[task->GetUid()].appExemptionFlag_ |= ExemptionTypeFlag::WORK_SCHEDULER;
+    }
+    #endif
+    return ERR_OK;
+}
+
+void ExemptionIndex::HandleEvent(const StandbyMessage& message)
+{
+    switch (message.eventId_) {
+        case StandbyMessageType::PHASE_TRANSIT:
+        case StandbyMessageType::STATE_TRANSIT:
+        // strategies restart proxy on day and night switch, the foreground apps must be queried again
+        case StandbyMessageType::RES_CTRL_CONDITION_CHANGED:
+            Invalidate();
+            break;
+        case StandbyMessageType::PROCESS_STATE_CHANGED:
+            HandleProcessStatusChanged(message);
+            break;
+        case StandbyMessageType::BG_TASK_STATUS_CHANGE:
+            UpdateBgTaskAppStatus(message);
+            break;
+        case StandbyMessageType::SYS_ABILITY_STATUS_CHANGED:
+            ResetBgTaskStatus(message);
+            break;
+        default:
+            break;
+    }
+}
+
+void ExemptionIndex::HandleProcessStatusChanged(const StandbyMessage& message)
+{
+    ProcessStateChangedPayload decoded;
+    const ProcessStateChangedPayload* payload = message.GetPayload(decoded);
+    if (payload == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    if (!isPopulated_) {
+        return;
+    }
+    if (payload->isCreated_) {
+        auto& entry = entries_[payload->uid_];
+        if (entry.processName_.empty()) {
+            entry.processName_ = payload->name_;
+        }
+        entry.pids_.emplace(payload->pid_);
+        return;
+    }
+    if (auto iter = entries_.find(payload->uid_); iter != entries_.end()) {
+        iter->second.pids_.erase(payload->pid_);
+    }
+}
+
+void ExemptionIndex::UpdateBgTaskAppStatus(const StandbyMessage& message)
+{
+    BgTaskStatusPayload decoded;
+    const BgTaskStatusPayload* payload = message.GetPayload(decoded);
+    if (payload == nullptr) {
+        return;
+    }
+    auto flagIter = BGTASK_EXEMPTION_FLAG_MAP.find(payload->type_);
+    if (flagIter == BGTASK_EXEMPTION_FLAG_MAP.end()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    if (!isPopulated_) {
+        return;
+    }
+    auto& entry = entries_[payload->uid_];
+    if (payload->started_) {
+        entry.appExemptionFlag_ |= flagIter->second;
+        if (flagIter->second == ExemptionTypeFlag::CONTINUOUS_TASK) {
+            entry.continuousTaskTypes_ |= GetContinuousTaskTypeBit(payload->typeId_);
+        }
+    } else {
+        entry.appExemptionFlag_ &= ~flagIter->second;
+        if (flagIter->second == ExemptionTypeFlag::CONTINUOUS_TASK) {
+            entry.continuousTaskTypes_ = 0;
+        }
+    }
+}
+
+// when bgtask or work_scheduler service crash, reset relative flag
+void ExemptionIndex::ResetBgTaskStatus(const StandbyMessage& message)
+{
+    if (!message.want_.has_value() || message.want_->GetBoolParam(SA_STATUS, false)) {
+        return;
+    }
+    int32_t saId = message.want_->GetIntParam(SA_ID, 0);
+    if (saId != WORK_SCHEDULE_SERVICE_ID && saId != BACKGROUND_TASK_MANAGER_SERVICE_ID) {
+        return;
+    }
+    const uint8_t bgTaskFlag = (ExemptionTypeFlag::TRANSIENT_TASK | ExemptionTypeFlag::WORK_SCHEDULER);
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    for (auto& [uid, entry] : entries_) {
+        entry.appExemptionFlag_ &= ~bgTaskFlag;
+    }
+}
+
+void ExemptionIndex::ForEachEntry(const std::function<void(int32_t, const ExemptionIndexEntry&)>& func)
+{
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    for (const auto& [uid, entry] : entries_) {
+        func(uid, entry);
+    }
+}
+
+bool ExemptionIndex::IsSystemApp(int32_t uid)
+{
+    {
+        std::lock_guard<std::mutex> lock(indexMutex_);
+        if (auto iter = entries_.find(uid); iter != entries_.end() && iter->second.isAppInfoKnown_) {
+            return (iter->second.appExemptionFlag_ & ExemptionTypeFlag::UNRESTRICTED) != 0;
+        }
+    }
+    // app installed after the index is populated
+    bool isSystemApp {false};
+    if (!BundleManagerHelper::GetInstance()->CheckIsSystemAppByUid(uid, isSystemApp)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    if (!isPopulated_) {
+        return isSystemApp;
+    }
+    auto& entry = entries_[uid];
+    entry.isAppInfoKnown_ = true;
+    if (isSystemApp) {
+        entry.appExemptionFlag_ |= ExemptionTypeFlag::UNRESTRICTED;
+    }
+    return isSystemApp;
+}
+
+void ExemptionIndex::ShellDump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    result.append("exemption index populated: ").append(isPopulated_ ? "true" : "false")
+        .append(", size: " + std::to_string(entries_.size()))
+        .append(", populate count: " + std::to_string(populateCount_))
+        .append(", reuse count: " + std::to_string(reuseCount_)).append("\n");
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
@@ -69,6 +69,15 @@ void NetworkStrategy::HandleEvent(const StandbyMessage& message)
     }
 }
 
+StandbyEventMask NetworkStrategy::GetEventInterest() const
+{
+    return GetEventMask(StandbyMessageType::ALLOW_LIST_CHANGED) |
+        GetEventMask(StandbyMessageType::RES_CTRL_CONDITION_CHANGED) |
+        GetEventMask(StandbyMessageType::PHASE_TRANSIT) | GetEventMask(StandbyMessageType::STATE_TRANSIT) |
+        GetEventMask(StandbyMessageType::BG_TASK_STATUS_CHANGE) |
+        GetEventMask(StandbyMessageType::PROCESS_STATE_CHANGED);
+}
+
 void NetworkStrategy::UpdateAllowedList(const StandbyMessage& message)
 {
     STANDBYSERVICE_LOGD("enter NetworkStrategy UpdateAllowedList, eventId is %{public}d", message.eventId_);
@@ -108,25 +117,26 @@ void NetworkStrategy::StopNetLimit(const StandbyMessage& message)
     DisableNetworkFirewall(message);
 }
 
-void NetworkStrategy::SetFirewallAllowedList(const std::vector<uint32_t>& uids, bool isAdded)
+bool NetworkStrategy::SetFirewallAllowedList(const std::vector<uint32_t>& uids, bool isAdded)
 {
     if (uids.empty()) {
         STANDBYSERVICE_LOGD("allow list is empty");
-        return;
+        return true;
     }
     STANDBYSERVICE_LOGI("SetFireWallAllowedList, uids: %{public}s, isAdded: %{public}d",
         UidsToString(uids).c_str(), isAdded);
     if (!isAdded && isIdleMaintence_) {
         STANDBYSERVICE_LOGI("current is idle maintenance, do not need remove allow list");
-        return;
+        return false;
     }
     #ifdef STANDBY_COMMUNICATION_NETMANAGER_BASE_ENABLE
     if (auto ret = DelayedSingleton<NetManagerStandard::NetPolicyClient>::GetInstance()->
         SetDeviceIdleTrustlist(uids, isAdded); ret != 0) {
         STANDBYSERVICE_LOGW("failed to SetFireWallAllowedList, err code is %{public}d", ret);
-        return;
+        return false;
     }
     #endif
+    return true;
 }
 
 void NetworkStrategy::ShellDump(const std::vector<std::string>& argsInStr, std::string& result)
@@ -20,22 +20,18 @@
 #include "system_ability_definition.h"
 
 #include "ability_manager_helper.h"
-#ifdef ENABLE_BACKGROUND_TASK_MGR
-#include "background_task_helper.h"
-#endif
 #include "app_mgr_helper.h"
 #include "standby_service.h"
 #ifdef STANDBY_POWER_MANAGER_ENABLE
 #include "power_mgr_client.h"
 #endif
-#ifdef STANDBY_RSS_WORK_SCHEDULER_ENABLE
-#include "workscheduler_srv_client.h"
-#endif
 #include "allow_type.h"
 #include "standby_state.h"
 #include "bundle_manager_helper.h"
+#include "standby_config_manager.h"
 #include "standby_service_impl.h"
 #include "common_constant.h"
+#include "exemption_index.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
@@ -45,6 +41,8 @@ const std::map<std::string, uint8_t> BGTASK_EXEMPTION_FLAG_MAP {
     {TRANSIENT_TASK, ExemptionTypeFlag::TRANSIENT_TASK},
     {WORK_SCHEDULER, ExemptionTypeFlag::WORK_SCHEDULER},
 };
+const std::string FLUSH_RUNNING_LOCK_PROXY_TASK = "FlushRunningLockProxyTask";
+const std::string TAG_RUNNING_LOCK_PROXY_DELAY = "running_lock_proxy_delay";
 }
 
 void RunningLockStrategy::HandleEvent(const StandbyMessage& message)
@@ -78,6 +76,16 @@ void RunningLockStrategy::HandleEvent(const StandbyMessage& message)
     }
 }
 
+StandbyEventMask RunningLockStrategy::GetEventInterest() const
+{
+    return GetEventMask(StandbyMessageType::ALLOW_LIST_CHANGED) |
+        GetEventMask(StandbyMessageType::RES_CTRL_CONDITION_CHANGED) |
+        GetEventMask(StandbyMessageType::PHASE_TRANSIT) | GetEventMask(StandbyMessageType::STATE_TRANSIT) |
+        GetEventMask(StandbyMessageType::BG_TASK_STATUS_CHANGE) |
+        GetEventMask(StandbyMessageType::PROCESS_STATE_CHANGED) |
+        GetEventMask(StandbyMessageType::SYS_ABILITY_STATUS_CHANGED);
+}
+
 ErrCode RunningLockStrategy::OnCreated()
 {
     #ifdef STANDBY_POWER_MANAGER_ENABLE
@@ -88,6 +96,7 @@ ErrCode RunningLockStrategy::OnCreated()
 
 ErrCode RunningLockStrategy::OnDestroy()
 {
+    FlushProxyRunningLocks();
     if (isProxied_ && !isIdleMaintence_) {
         ProxyAppAndProcess(false);
     }
@@ -98,10 +107,12 @@ ErrCode RunningLockStrategy::OnDestroy()
 
 ErrCode RunningLockStrategy::UpdateExemptionList(const StandbyMessage& message)
 {
-    if (!message.want_.has_value()) {
+    AllowListChangedPayload decoded;
+    const AllowListChangedPayload* payload = message.GetPayload(decoded);
+    if (payload == nullptr) {
         return ERR_STANDBY_OBJECT_NULL;
     }
-    uint32_t allowType = static_cast<uint32_t>(message.want_->GetIntParam("allowType", 0));
+    uint32_t allowType = payload->allowType_;
     if ((allowType & AllowType::RUNNING_LOCK) == 0) {
         STANDBYSERVICE_LOGD("allowType is not running lock, currentType is %{public}d", allowType);
         return ERR_STANDBY_STRATEGY_NOT_MATCH;
@@ -111,16 +122,19 @@ ErrCode RunningLockStrategy::UpdateExemptionList(const StandbyMessage& message)
         return ERR_STANDBY_CURRENT_STATE_NOT_MATCH;
     }
 
-    // according to message, add flag or remove flag
+    // according to message, add flag or remove flag, the message carries the net diff of allow list
     STANDBYSERVICE_LOGI("RunningLockStrategy start update allow list");
-    std::string processName = message.want_->GetStringParam("name");
-    bool added = message.want_->GetBoolParam("added", false);
-    int32_t uid = message.want_->GetIntParam("uid", -1);
-    STANDBYSERVICE_LOGD("%{public}s apply allow, added is %{public}d", processName.c_str(), added);
-    if (added) {
-        AddExemptionFlag(uid, processName, ExemptionTypeFlag::EXEMPTION);
-    } else {
-        RemoveExemptionFlag(uid, processName, ExemptionTypeFlag::EXEMPTION);
+    for (const auto& change : payload->changes_) {
+        if ((change.allowType_ & AllowType::RUNNING_LOCK) == 0) {
+            continue;
+        }
+        STANDBYSERVICE_LOGD("%{public}s apply allow, added is %{public}d", change.name_.c_str(),
+            static_cast<int32_t>(change.added_));
+        if (UpdateExemptionCache(change.name_, change.added_)) {
+            AddExemptionFlag(change.uid_, change.name_, ExemptionTypeFlag::EXEMPTION);
+        } else {
+            RemoveExemptionFlag(change.uid_, change.name_, ExemptionTypeFlag::EXEMPTION);
+        }
     }
     return ERR_OK;
 }
@@ -172,153 +186,27 @@ ErrCode RunningLockStrategy::StartProxyInner()
 
 ErrCode RunningLockStrategy::InitProxiedAppInfo()
 {
-    if (GetAllAppInfos() != ERR_OK || GetAllRunningAppInfo() != ERR_OK) {
+    auto exemptionIndex = ExemptionIndex::GetInstance();
+    if (exemptionIndex->Populate() != ERR_OK) {
         STANDBYSERVICE_LOGW("failed to get all app info");
         return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
     }
-    if (GetForegroundApplications() !=ERR_OK || GetBackgroundTaskApp() != ERR_OK ||
-        GetWorkSchedulerTask() != ERR_OK || GetExemptionConfig() != ERR_OK) {
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    uidBundleNmeMap_.clear();
-    return ERR_OK;
-}
-
-ErrCode RunningLockStrategy::GetAllAppInfos()
-{
-    // get all app and set UNRESTRICTED flag to system app.
-    std::vector<AppExecFwk::ApplicationInfo> applicationInfos {};
-    if (!BundleManagerHelper::GetInstance()->GetApplicationInfos(
-        AppExecFwk::ApplicationFlag::GET_BASIC_APPLICATION_INFO,
-        AppExecFwk::Constants::ALL_USERID, applicationInfos)) {
-        STANDBYSERVICE_LOGW("failed to get all applicationInfos");
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    STANDBYSERVICE_LOGI("succeed GetApplicationInfos, size is %{public}d",
-        static_cast<int32_t>(applicationInfos.size()));
-    for (const auto& info : applicationInfos) {
-        uidBundleNmeMap_.emplace(info.uid, info.name);
-        std::string key = std::to_string(info.uid) + "_" + info.name;
-        proxiedAppInfo_.emplace(key, ProxiedProcInfo {info.name, info.uid});
-        // system app have exemption
-        if (info.isSystemApp) {
-            proxiedAppInfo_[key].appExemptionFlag_ |= ExemptionTypeFlag::UNRESTRICTED;
-        }
-    }
-    return ERR_OK;
-}
-
-ErrCode RunningLockStrategy::GetAllRunningAppInfo()
-{
-    std::vector<AppExecFwk::RunningProcessInfo> allAppProcessInfos {};
-    if (!AppMgrHelper::GetInstance()->GetAllRunningProcesses(allAppProcessInfos)) {
-        STANDBYSERVICE_LOGE("connect to app manager service failed");
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    // get all running proc of app, add them to proxiedAppInfo_.
-    STANDBYSERVICE_LOGI("current running processes size %{public}d", static_cast<int32_t>(allAppProcessInfos.size()));
-    std::set<int> runningUids {};
-    for (const auto& info : allAppProcessInfos) {
-        if (uidBundleNmeMap_.find(info.uid_) == uidBundleNmeMap_.end()) {
-            continue;
-        }
-        runningUids.emplace(info.uid_);
-        std::string key = std::to_string(info.uid_) + "_" + uidBundleNmeMap_[info.uid_];
-        auto iter = proxiedAppInfo_.find(key);
-        if (iter == proxiedAppInfo_.end()) {
-            std::tie(iter, std::ignore) = proxiedAppInfo_.emplace(key,
-                ProxiedProcInfo {info.processName_, info.uid_});
-        }
-        iter->second.pids_.emplace(info.pid_);
-    }
-    // if app is not running, delete its info from proxiedAppInfo_.
-    for (auto appInfoIter = proxiedAppInfo_.begin(); appInfoIter != proxiedAppInfo_.end();) {
-        if (runningUids.find(appInfoIter->second.uid_) == runningUids.end()) {
-            appInfoIter = proxiedAppInfo_.erase(appInfoIter);
-        } else {
-            ++appInfoIter;
-        }
-    }
-    return ERR_OK;
-}
-
-ErrCode RunningLockStrategy::GetWorkSchedulerTask()
-{
-    #ifdef STANDBY_RSS_WORK_SCHEDULER_ENABLE
-    std::list<std::shared_ptr<WorkScheduler::WorkInfo>> workInfos;
-    if (WorkScheduler::WorkSchedulerSrvClient::GetInstance().GetAllRunningWorks(workInfos) != ERR_OK) {
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-
-    STANDBYSERVICE_LOGD("GetWorkSchedulerTask succeed, size is %{public}d", static_cast<int32_t>(workInfos.size()));
-    for (const auto& task : workInfos) {
-        std::string key = std::to_string(task->GetUid()) + "_" + task->GetBundleName();
-        if (auto iter = proxiedAppInfo_.find(key); iter != proxiedAppInfo_.end()) {
-            iter->second.appExemptionFlag_ |= ExemptionTypeFlag::WORK_SCHEDULER;
-        }
-    }
-    #endif
-    return ERR_OK;
-}
-
-ErrCode RunningLockStrategy::GetForegroundApplications()
-{
-    std::vector<AppExecFwk::AppStateData> fgApps {};
-    if (!AppMgrHelper::GetInstance()->GetForegroundApplications(fgApps)) {
-        STANDBYSERVICE_LOGW("get foreground app failed");
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    // add foreground flag to app
-    for (const auto& appInfo : fgApps) {
-        std::string key = std::to_string(appInfo.uid) + "_" + appInfo.bundleName;
-        if (auto iter = proxiedAppInfo_.find(key); iter != proxiedAppInfo_.end()) {
-            iter->second.appExemptionFlag_ |= ExemptionTypeFlag::FOREGROUND_APP;
-        }
-    }
-    return ERR_OK;
-}
-
-ErrCode RunningLockStrategy::GetBackgroundTaskApp()
-{
-    #ifdef ENABLE_BACKGROUND_TASK_MGR
-    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> continuousTaskList;
-    if (!BackgroundTaskHelper::GetInstance()->GetContinuousTaskApps(continuousTaskList)) {
-        STANDBYSERVICE_LOGE("get continuous task app failed");
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    STANDBYSERVICE_LOGD("succeed GetContinuousTaskApps, size is %{public}d",
-        static_cast<int32_t>(continuousTaskList.size()));
-    std::vector<std::shared_ptr<TransientTaskAppInfo>> transientTaskList;
-    if (!BackgroundTaskHelper::GetInstance()->GetTransientTaskApps(transientTaskList)) {
-        STANDBYSERVICE_LOGE("get transient task app failed");
-        return ERR_STRATEGY_DEPENDS_SA_NOT_AVAILABLE;
-    }
-    // add continuous exemption flag for app with continuous task
-    STANDBYSERVICE_LOGD("succeed GetTransientTaskApps, size is %{public}d",
-        static_cast<int32_t>(transientTaskList.size()));
-    for (const auto& task : continuousTaskList) {
-        auto iter = uidBundleNmeMap_.find(task->GetCreatorUid());
-        if (iter == uidBundleNmeMap_.end()) {
-            continue;
-        }
-        std::string key = std::to_string(task->GetCreatorUid()) + "_" + iter->second;
-        if (auto infoIter = proxiedAppInfo_.find(key); infoIter == proxiedAppInfo_.end()) {
-            continue;
-        } else {
-            infoIter->second.appExemptionFlag_ |= ExemptionTypeFlag::CONTINUOUS_TASK;
+    exemptionIndex->ForEachEntry([this](int32_t uid, const ExemptionIndexEntry& entry) {
+        if (entry.bundleName_.empty()) {
+            return;
         }
-    }
-    // add transient exemption flag for app with transient task
-    for (const auto& task : transientTaskList) {
-        std::string key = std::to_string(task->GetUid()) + "_" + task->GetPackageName();
-        if (auto iter = proxiedAppInfo_.find(key); iter == proxiedAppInfo_.end()) {
-            continue;
-        } else {
-            iter->second.appExemptionFlag_ |= ExemptionTypeFlag::TRANSIENT_TASK;
+        // system app have exemption
+        uint8_t systemAppFlag = entry.appExemptionFlag_ & ExemptionTypeFlag::UNRESTRICTED;
+        exemptionCache_.emplace(uid, AppExemptionCache {entry.bundleName_, systemAppFlag});
+        // only running app is proxied
+        if (entry.pids_.empty()) {
+            return;
         }
-    }
-    #endif
-    return ERR_OK;
+        std::string key = std::to_string(uid) + "_" + entry.bundleName_;
+        proxiedAppInfo_.emplace(key, ProxiedProcInfo {entry.bundleName_, uid, entry.pids_, entry.appExemptionFlag_});
+    });
+    STANDBYSERVICE_LOGI("running app size is %{public}d", static_cast<int32_t>(proxiedAppInfo_.size()));
+    return GetExemptionConfig();
 }
 
 ErrCode RunningLockStrategy::GetExemptionConfig()
@@ -327,12 +215,12 @@ ErrCode RunningLockStrategy::GetExemptionConfig()
     std::vector<AllowInfo> allowInfoList {};
     StandbyServiceImpl::GetInstance()->GetAllowListInner(AllowType::RUNNING_LOCK, allowInfoList,
         ReasonCodeEnum::REASON_APP_API);
-    std::set<std::string> allowNameList {};
+    allowNameSet_.clear();
     for (const auto& info : allowInfoList) {
-        allowNameList.emplace(info.GetName());
+        allowNameSet_.emplace(info.GetName());
     }
     for (auto& [key, value] : proxiedAppInfo_) {
-        if (allowNameList.find(value.name_) == allowNameList.end()) {
+        if (allowNameSet_.find(value.name_) == allowNameSet_.end()) {
             continue;
         }
         value.appExemptionFlag_ |= ExemptionTypeFlag::EXEMPTION;
@@ -344,12 +232,23 @@ ErrCode RunningLockStrategy::GetExemptionConfig()
         ReasonCodeEnum::REASON_APP_API, restrictBundleName);
     STANDBYSERVICE_LOGI("running lock restrict app list, size is %{public}d",
         static_cast<int32_t>(restrictBundleName.size()));
+    restrictNameSet_ = std::unordered_set<std::string>(restrictBundleName.begin(), restrictBundleName.end());
     for (auto& [key, value] : proxiedAppInfo_) {
         if (restrictBundleName.find(value.name_) == restrictBundleName.end()) {
             continue;
         }
         value.appExemptionFlag_ |= ExemptionTypeFlag::RESTRICTED;
     }
+
+    // resolve the flags of all apps once, process birth during proxy only looks up exemptionCache_
+    for (auto& [uid, cache] : exemptionCache_) {
+        if (allowNameSet_.find(cache.name_) != allowNameSet_.end()) {
+            cache.appExemptionFlag_ |= ExemptionTypeFlag::EXEMPTION;
+        }
+        if (restrictNameSet_.find(cache.name_) != restrictNameSet_.end()) {
+            cache.appExemptionFlag_ |= ExemptionTypeFlag::RESTRICTED;
+        }
+    }
     return ERR_OK;
 }
 
@@ -360,6 +259,8 @@ ErrCode RunningLockStrategy::InitNativeProcInfo()
 
 ErrCode RunningLockStrategy::ProxyAppAndProcess(bool isProxied)
 {
+    // apply queued changes before proxy status of all apps changes
+    FlushProxyRunningLocks();
     std::vector<std::pair<int32_t, int32_t>> proxiedAppList;
     for (const auto& [key, value] : proxiedAppInfo_) {
         if (ExemptionTypeFlag::IsExempted(value.appExemptionFlag_)) {
@@ -408,13 +309,15 @@ ErrCode RunningLockStrategy::StopProxyInner()
 
 ErrCode RunningLockStrategy::UpdateBgTaskAppStatus(const StandbyMessage& message)
 {
-    if (!message.want_.has_value()) {
+    BgTaskStatusPayload decoded;
+    const BgTaskStatusPayload* payload = message.GetPayload(decoded);
+    if (payload == nullptr) {
         return ERR_STANDBY_OBJECT_NULL;
     }
-    std::string type = message.want_->GetStringParam(BG_TASK_TYPE);
-    bool started = message.want_->GetBoolParam(BG_TASK_STATUS, false);
-    int32_t uid = message.want_->GetIntParam(BG_TASK_UID, 0);
-    std::string bundleName = message.want_->GetStringParam(BG_TASK_BUNDLE_NAME);
+    const std::string& type = payload->type_;
+    bool started = payload->started_;
+    int32_t uid = payload->uid_;
+    std::string bundleName = payload->bundleName_;
 
     STANDBYSERVICE_LOGD("received bgtask status changed, type: %{public}s, isstarted: %{public}d, uid: %{public}d",
         type.c_str(), started, uid);
@@ -474,7 +377,7 @@ void RunningLockStrategy::AddExemptionFlag(int32_t uid, const std::string& name,
             ExemptionTypeFlag::IsExempted(iter->second.appExemptionFlag_)) {
             std::vector<std::pair<int32_t, int32_t>> proxiedAppList;
             SetProxiedAppList(proxiedAppList, iter->second);
-            ProxyRunningLockList(false, proxiedAppList);
+            QueueProxyRunningLock(false, proxiedAppList);
         }
     }
 }
@@ -497,13 +400,15 @@ void RunningLockStrategy::RemoveExemptionFlag(int32_t uid, const std::string& na
 
     std::vector<std::pair<int32_t, int32_t>> proxiedAppList;
     SetProxiedAppList(proxiedAppList, iter->second);
-    ProxyRunningLockList(true, proxiedAppList);
+    QueueProxyRunningLock(true, proxiedAppList);
 }
 
 void RunningLockStrategy::ClearProxyRecord()
 {
     proxiedAppInfo_.clear();
-    uidBundleNmeMap_.clear();
+    exemptionCache_.clear();
+    allowNameSet_.clear();
+    restrictNameSet_.clear();
 }
 
 // when app is created, add app info to cache
@@ -518,36 +423,66 @@ void RunningLockStrategy::GetAndCreateAppInfo(uint32_t uid, uint32_t pid, const
 
     std::tie(iter, std::ignore) = proxiedAppInfo_.emplace(mapKey, ProxiedProcInfo {bundleName, uid});
     iter->second.pids_.emplace(pid);
-
-    bool isSystemApp {false};
-    if (BundleManagerHelper::GetInstance()->CheckIsSystemAppByUid(uid, isSystemApp) && isSystemApp) {
-        iter->second.appExemptionFlag_ |= ExemptionTypeFlag::UNRESTRICTED;
-    }
     GetExemptionConfigForApp(iter->second, bundleName);
 }
 
 ErrCode RunningLockStrategy::GetExemptionConfigForApp(ProxiedProcInfo& appInfo, const std::string& bundleName)
 {
-    // if app in exemption list, add exemption flag
-    std::vector<AllowInfo> allowInfoList {};
-    StandbyServiceImpl::GetInstance()->GetAllowListInner(AllowType::NETWORK, allowInfoList,
-        ReasonCodeEnum::REASON_APP_API);
-    std::set<std::string> allowNameList {};
-    for (const auto& info : allowInfoList) {
-        if (info.GetName() != bundleName) {
+    appInfo.appExemptionFlag_ |= ResolveExemptionFlag(appInfo.uid_, bundleName);
+    return ERR_OK;
+}
+
+uint8_t RunningLockStrategy::ResolveExemptionFlag(int32_t uid, const std::string& bundleName)
+{
+    auto iter = exemptionCache_.find(uid);
+    if (iter != exemptionCache_.end() && iter->second.name_ == bundleName) {
+        return iter->second.appExemptionFlag_;
+    }
+    // app installed after proxy started
+    uint8_t appExemptionFlag = 0;
+    if (ExemptionIndex::GetInstance()->IsSystemApp(uid)) {
+        appExemptionFlag |= ExemptionTypeFlag::UNRESTRICTED;
+    }
+    if (allowNameSet_.find(bundleName) != allowNameSet_.end()) {
+        appExemptionFlag |= ExemptionTypeFlag::EXEMPTION;
+    }
+    if (restrictNameSet_.find(bundleName) != restrictNameSet_.end()) {
+        appExemptionFlag |= ExemptionTypeFlag::RESTRICTED;
+    }
+    exemptionCache_[uid] = AppExemptionCache {bundleName, appExemptionFlag};
+    return appExemptionFlag;
+}
+
+bool RunningLockStrategy::UpdateExemptionCache(const std::string& bundleName, bool added)
+{
+    // the name stays exempted while another uid or reason code still allows it
+    bool isAllowed = added || IsNameInAllowList(bundleName);
+    if (isAllowed) {
+        allowNameSet_.emplace(bundleName);
+    } else {
+        allowNameSet_.erase(bundleName);
+    }
+    // the exemption is granted by name, so every uid of the name is updated
+    for (auto& [uid, cache] : exemptionCache_) {
+        if (cache.name_ != bundleName) {
             continue;
         }
-        appInfo.appExemptionFlag_ |= ExemptionTypeFlag::EXEMPTION;
+        if (isAllowed) {
+            cache.appExemptionFlag_ |= ExemptionTypeFlag::EXEMPTION;
+        } else {
+            cache.appExemptionFlag_ &= ~ExemptionTypeFlag::EXEMPTION;
+        }
     }
+    return isAllowed;
+}
 
-    // if app in restricted list, add retricted flag
-    std::set<std::string> restrictNameList {};
-    StandbyServiceImpl::GetInstance()->GetEligiableRestrictSet(AllowType::NETWORK, "NETWORK",
-        ReasonCodeEnum::REASON_APP_API, restrictNameList);
-    if (restrictNameList.find(bundleName) != restrictNameList.end()) {
-        appInfo.appExemptionFlag_ |= ExemptionTypeFlag::RESTRICTED;
-    }
-    return ERR_OK;
+bool RunningLockStrategy::IsNameInAllowList(const std::string& bundleName)
+{
+    std::vector<AllowInfo> allowInfoList {};
+    StandbyServiceImpl::GetInstance()->GetAllowListInner(AllowType::RUNNING_LOCK, allowInfoList,
+        ReasonCodeEnum::REASON_APP_API);
+    return std::any_of(allowInfoList.begin(), allowInfoList.end(),
+        [&bundleName](const AllowInfo& info) { return info.GetName() == bundleName; });
 }
 
 void RunningLockStrategy::SetProxiedAppList(std::vector<std::pair<int32_t, int32_t>>& proxiedAppList,
@@ -558,6 +493,60 @@ void RunningLockStrategy::SetProxiedAppList(std::vector<std::pair<int32_t, int32
     }
 }
 
+void RunningLockStrategy::QueueProxyRunningLock(bool isProxied,
+    const std::vector<std::pair<int32_t, int32_t>>& proxiedAppList)
+{
+    for (const auto& item : proxiedAppList) {
+        auto iter = pendingProxyOps_.find(item);
+        if (iter == pendingProxyOps_.end()) {
+            pendingProxyOps_.emplace(item, isProxied);
+        } else if (iter->second != isProxied) {
+            // opposing operations of a process cancel out
+            pendingProxyOps_.erase(iter);
+            ++cancelledProxyOpCount_;
+        }
+    }
+    queuedProxyOpCount_ += proxiedAppList.size();
+    if (isProxyFlushPosted_ || pendingProxyOps_.empty()) {
+        return;
+    }
+    auto& handler = StandbyServiceImpl::GetInstance()->GetHandler();
+    if (handler == nullptr) {
+        FlushProxyRunningLocks();
+        return;
+    }
+    // flushed in the next turn of event loop by default
+    int32_t flushDelay = StandbyConfigManager::GetInstance()->GetStandbyParam(TAG_RUNNING_LOCK_PROXY_DELAY);
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::STRATEGY, [this]() { this->FlushProxyRunningLocks(); },
+        FLUSH_RUNNING_LOCK_PROXY_TASK, std::max(flushDelay, 0));
+    isProxyFlushPosted_ = true;
+}
+
+void RunningLockStrategy::FlushProxyRunningLocks()
+{
+    if (isProxyFlushPosted_) {
+        StandbyServiceImpl::GetInstance()->RemoveLaneTask(FLUSH_RUNNING_LOCK_PROXY_TASK);
+        isProxyFlushPosted_ = false;
+    }
+    if (pendingProxyOps_.empty()) {
+        return;
+    }
+    std::vector<std::pair<int32_t, int32_t>> proxiedList;
+    std::vector<std::pair<int32_t, int32_t>> unproxiedList;
+    for (const auto& [item, isProxied] : pendingProxyOps_) {
+        if (isProxied) {
+            proxiedList.emplace_back(item);
+        } else {
+            unproxiedList.emplace_back(item);
+        }
+    }
+    pendingProxyOps_.clear();
+    STANDBYSERVICE_LOGD("flush running lock proxy, proxied size: %{public}d, unproxied size: %{public}d",
+        static_cast<int32_t>(proxiedList.size()), static_cast<int32_t>(unproxiedList.size()));
+    ProxyRunningLockList(true, proxiedList);
+    ProxyRunningLockList(false, unproxiedList);
+}
+
 void RunningLockStrategy::ProxyRunningLockList(bool isProxied,
     const std::vector<std::pair<int32_t, int32_t>>& proxiedAppList)
 {
@@ -569,6 +558,7 @@ void RunningLockStrategy::ProxyRunningLockList(bool isProxied,
         STANDBYSERVICE_LOGI("current is idle maintenance, can not proxy running lock");
         return;
     }
+    ++proxyCallCount_;
     #ifdef STANDBY_POWER_MANAGER_ENABLE
     if (!PowerMgr::PowerMgrClient::GetInstance().ProxyRunningLocks(isProxied, proxiedAppList)) {
         STANDBYSERVICE_LOGW("failed to ProxyRunningLockList");
@@ -582,20 +572,22 @@ void RunningLockStrategy::HandleProcessStatusChanged(const StandbyMessage& messa
         STANDBYSERVICE_LOGD("RunningLockStrategy is not in proxy, do not need process");
         return;
     }
-    if (!message.want_.has_value()) {
+    ProcessStateChangedPayload decoded;
+    const ProcessStateChangedPayload* payload = message.GetPayload(decoded);
+    if (payload == nullptr) {
         return;
     }
-    int32_t uid = message.want_->GetIntParam("uid", -1);
-    int32_t pid = message.want_->GetIntParam("pid", -1);
-    std::string bundleName = message.want_->GetStringParam("name");
-    bool isCreated = message.want_->GetBoolParam("isCreated", false);
+    int32_t uid = payload->uid_;
+    int32_t pid = payload->pid_;
+    const std::string& bundleName = payload->name_;
+    bool isCreated = payload->isCreated_;
 
     auto key = std::to_string(uid) + "_" + bundleName;
     if (isCreated) {
         // if process is created
         GetAndCreateAppInfo(uid, pid, bundleName);
         if (!ExemptionTypeFlag::IsExempted(proxiedAppInfo_[key].appExemptionFlag_)) {
-            ProxyRunningLockList(true, {std::make_pair(pid, uid)});
+            QueueProxyRunningLock(true, {std::make_pair(pid, uid)});
         }
     } else {
         auto iter = proxiedAppInfo_.find(key);
@@ -603,7 +595,7 @@ void RunningLockStrategy::HandleProcessStatusChanged(const StandbyMessage& messa
             return;
         }
         if (!ExemptionTypeFlag::IsExempted(proxiedAppInfo_[key].appExemptionFlag_)) {
-            ProxyRunningLockList(false, {std::make_pair(pid, uid)});
+            QueueProxyRunningLock(false, {std::make_pair(pid, uid)});
         }
         iter->second.pids_.erase(pid);
         if (iter->second.pids_.empty()) {
@@ -626,6 +618,10 @@ void RunningLockStrategy::DumpShowDetailInfo(const std::vector<std::string>& arg
     result.append("=================RunningLock======================\n");
     result.append("Running Lock Strategy:\n").append("isProxied: " + std::to_string(isProxied_))
         .append(" isIdleMaintence: " + std::to_string(isIdleMaintence_)).append("\n");
+    result.append("proxy ops queued: " + std::to_string(queuedProxyOpCount_))
+        .append(" cancelled: " + std::to_string(cancelledProxyOpCount_))
+        .append(" pending: " + std::to_string(pendingProxyOps_.size()))
+        .append(" calls: " + std::to_string(proxyCallCount_)).append("\n");
     result.append("proxied app info: \n");
     for (const auto& [key, value] : proxiedAppInfo_) {
         result.append("key: ").append(key).append(" name: ").append(value.name_).append(" uid: ")
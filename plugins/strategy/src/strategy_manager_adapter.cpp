@@ -17,6 +17,7 @@
 
 #include "ibase_strategy.h"
 #include "standby_service_log.h"
+#include "exemption_index.h"
 #ifdef STANDBY_COMMUNICATION_NETMANAGER_BASE_ENABLE
 #include "network_strategy.h"
 #endif
@@ -56,6 +57,8 @@ bool StrategyManagerAdapter::UnInit()
         strategy->OnDestroy();
     }
     strategyList_.clear();
+    BuildEventRoutes();
+    ExemptionIndex::GetInstance()->Invalidate();
     return true;
 }
 
@@ -75,19 +78,60 @@ void StrategyManagerAdapter::RegisterPolicy(const std::vector<std::string>& stra
             strategyList_.emplace_back(strategyPtr);
         }
     }
+    BuildEventRoutes();
+}
+
+void StrategyManagerAdapter::BuildEventRoutes()
+{
+    eventInterest_ = 0;
+    for (auto& route : eventRoutes_) {
+        route.clear();
+    }
+    for (const auto& strategy : strategyList_) {
+        StandbyEventMask interest = strategy->GetEventInterest();
+        eventInterest_ |= interest;
+        for (uint32_t eventId = 0; eventId < MAX_MASKED_EVENT_ID; ++eventId) {
+            if ((interest & GetEventMask(eventId)) != 0) {
+                eventRoutes_[eventId].emplace_back(strategy);
+            }
+        }
+    }
+}
+
+StandbyEventMask StrategyManagerAdapter::GetEventInterest() const
+{
+    return eventInterest_;
 }
 
 void StrategyManagerAdapter::HandleEvent(const StandbyMessage& message)
 {
     STANDBYSERVICE_LOGD("StrategyManagerAdapter revceive message %{public}u, action: %{public}s",
         message.eventId_, message.action_.c_str());
-    for (const auto &strategy : strategyList_) {
+    // keep the shared app state coherent before strategies read it
+    ExemptionIndex::GetInstance()->HandleEvent(message);
+    if (message.eventId_ >= MAX_MASKED_EVENT_ID) {
+        for (const auto &strategy : strategyList_) {
+            strategy->HandleEvent(message);
+        }
+        deliveredCount_ += strategyList_.size();
+        return;
+    }
+    const auto& route = eventRoutes_[message.eventId_];
+    for (const auto &strategy : route) {
         strategy->HandleEvent(message);
     }
+    deliveredCount_ += route.size();
+    skippedCount_ += strategyList_.size() - route.size();
 }
 
 void StrategyManagerAdapter::ShellDump(const std::vector<std::string>& argsInStr, std::string& result)
 {
+    if (argsInStr.size() >= DUMP_DETAILED_INFO_MAX_NUMS && argsInStr[DUMP_FIRST_PARAM] == DUMP_DETAIL_INFO &&
+        argsInStr[DUMP_SECOND_PARAM] == DUMP_STRATGY_DETAIL) {
+        result.append("strategy message delivered: " + std::to_string(deliveredCount_))
+            .append(", skipped: " + std::to_string(skippedCount_)).append("\n");
+        ExemptionIndex::GetInstance()->ShellDump(result);
+    }
     for (const auto &strategy : strategyList_) {
         strategy->ShellDump(argsInStr, result);
     }
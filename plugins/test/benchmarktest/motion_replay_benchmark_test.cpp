@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "common_constant.h"
+#include "motion_trace_replay.h"
+#include "standby_config_manager.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+    // set to a trace file recorded in the format of MotionTrace to replay it besides the synthetic traces
+    const char* RECORDED_TRACE_ENV = "STANDBY_MOTION_TRACE";
+    constexpr float GRAVITY = 9.8f;
+    constexpr float STILL_NOISE = 0.02f;
+    constexpr float WALKING_AMPLITUDE = 1.5f;
+    constexpr double WALKING_FREQUENCY = 2.0;
+    constexpr double PI = 3.14159265358979323846;
+    constexpr int64_t MSEC_PER_SEC = 1000;
+    constexpr int64_t SAMPLE_PERIOD_MS = 200;
+    constexpr int64_t MOTION_ONSET_MS = 600;
+    constexpr int32_t TRACE_NUM = 64;
+    constexpr int64_t THROUGHPUT_SAMPLE_NUM = 1 << 16;
+
+    void SetMotionThreshold(int32_t motionThreshold)
+    {
+        StandbyConfigManager::GetInstance()->standbyParaMap_[MOTION_THREADSHOLD] = motionThreshold;
+        StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
+    }
+
+    // a device lying still with sensor noise, it starts walking at the onset if onsetMs is not negative
+    MotionTrace GenerateTrace(uint32_t seed, int64_t durationMs, int64_t periodMs, int64_t onsetMs)
+    {
+        std::mt19937 engine(seed);
+        std::normal_distribution<float> noise(0.0f, STILL_NOISE);
+        MotionTrace trace;
+        trace.isMoving_ = onsetMs >= 0;
+        for (int64_t timeMs = 0; timeMs < durationMs; timeMs += periodMs) {
+            MotionTraceSample sample {timeMs, MotionTraceSampleType::ACCELEROMETER,
+                {noise(engine), noise(engine), GRAVITY + noise(engine)}};
+            if (trace.isMoving_ && timeMs >= onsetMs) {
+                double phase = 2 * PI * WALKING_FREQUENCY * (timeMs - onsetMs) / MSEC_PER_SEC;
+                sample.accelData_.x += WALKING_AMPLITUDE * static_cast<float>(std::sin(phase));
+                sample.accelData_.z += WALKING_AMPLITUDE / 2 * static_cast<float>(std::sin(2 * phase));
+            }
+            trace.samples_.emplace_back(sample);
+        }
+        return trace;
+    }
+
+    MotionReplayConfig GetReplayConfig(bool isRepeatedDetection)
+    {
+        if (isRepeatedDetection) {
+            return {PERIODLY_TASK_DECTION_TIMEOUT, PERIODLY_TASK_REST_TIMEOUT, PERIODLY_TASK_TOTAL_TIMEOUT, true};
+        }
+        return {MOTION_DETECTION_TIMEOUT, REST_TIMEOUT, TOTAL_TIMEOUT, false};
+    }
+
+    // replay still and moving traces, report false wakes, missed motions and the decision latency after onset
+    void ReplayDecision(benchmark::State& state, bool isRepeatedDetection)
+    {
+        SetMotionThreshold(static_cast<int32_t>(state.range(0)));
+        MotionReplayConfig config = GetReplayConfig(isRepeatedDetection);
+        // half of the moving traces start moving before the evaluation, the others in the middle of it
+        std::vector<std::pair<MotionTrace, int64_t>> traces;
+        for (int32_t index = 0; index < TRACE_NUM; ++index) {
+            int64_t onsetMs = index % 2 == 0 ? 0 : std::min<int64_t>(MOTION_ONSET_MS, config.totalTimeOut_ / 2);
+            traces.emplace_back(GenerateTrace(index, config.totalTimeOut_, SAMPLE_PERIOD_MS, -1), 0);
+            traces.emplace_back(GenerateTrace(index, config.totalTimeOut_, SAMPLE_PERIOD_MS, onsetMs), onsetMs);
+        }
+        MotionTraceReplayer replayer(config);
+        int64_t falseWakeCount = 0;
+        int64_t missCount = 0;
+        int64_t detectedCount = 0;
+        int64_t totalLatencyMs = 0;
+        int64_t sampleCount = 0;
+        for (auto _ : state) {
+            falseWakeCount = missCount = detectedCount = totalLatencyMs = 0;
+            for (const auto& [trace, onsetMs] : traces) {
+                MotionReplayResult result = replayer.Replay(trace);
+                sampleCount += static_cast<int64_t>(result.deliveredSampleCount_);
+                if (!trace.isMoving_) {
+                    falseWakeCount += result.isMotionDetected_ ? 1 : 0;
+                    continue;
+                }
+                if (!result.isMotionDetected_) {
+                    ++missCount;
+                    continue;
+                }
+                ++detectedCount;
+                totalLatencyMs += result.decisionTimeMs_ - onsetMs;
+            }
+        }
+        state.SetItemsProcessed(sampleCount);
+        state.counters["false_wakes"] = falseWakeCount;
+        state.counters["misses"] = missCount;
+        state.counters["latency_ms"] = detectedCount == 0 ? 0.0 : static_cast<double>(totalLatencyMs) / detectedCount;
+    }
+}
+
+/**
+ * @tc.name: ReplayThroughput
+ * @tc.desc: samples per second through the callbacks, the ring and the energy kernel without a decision.
+ */
+static void ReplayThroughput(benchmark::State& state)
+{
+    SetMotionThreshold(INT32_MAX);
+    MotionReplayConfig config {INT32_MAX, 0, INT32_MAX, false};
+    MotionTrace trace = GenerateTrace(0, THROUGHPUT_SAMPLE_NUM, 1, -1);
+    MotionTraceReplayer replayer(config);
+    int64_t sampleCount = 0;
+    for (auto _ : state) {
+        MotionReplayResult result = replayer.Replay(trace);
+        sampleCount += static_cast<int64_t>(result.deliveredSampleCount_);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(sampleCount);
+}
+BENCHMARK(ReplayThroughput);
+
+/**
+ * @tc.name: ReplayMotionDetection
+ * @tc.desc: decisions of the motion detection when entering sleep, argument is motion_threshold.
+ */
+static void ReplayMotionDetection(benchmark::State& state)
+{
+    ReplayDecision(state, false);
+}
+BENCHMARK(ReplayMotionDetection)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+/**
+ * @tc.name: ReplayRepeatedMotionDetection
+ * @tc.desc: decisions of the periodical motion detection in sleep, argument is motion_threshold.
+ */
+static void ReplayRepeatedMotionDetection(benchmark::State& state)
+{
+    ReplayDecision(state, true);
+}
+BENCHMARK(ReplayRepeatedMotionDetection)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+/**
+ * @tc.name: ReplayRecordedTrace
+ * @tc.desc: decision of the recorded trace, argument is motion_threshold.
+ */
+static void ReplayRecordedTrace(benchmark::State& state, const MotionTrace& trace, bool isRepeatedDetection)
+{
+    SetMotionThreshold(static_cast<int32_t>(state.range(0)));
+    MotionTraceReplayer replayer(GetReplayConfig(isRepeatedDetection));
+    MotionReplayResult result;
+    for (auto _ : state) {
+        result = replayer.Replay(trace);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(result.deliveredSampleCount_) * state.iterations());
+    state.counters["detected"] = result.isMotionDetected_ ? 1 : 0;
+    state.counters["false_wakes"] = (!trace.isMoving_ && result.isMotionDetected_) ? 1 : 0;
+    state.counters["decision_ms"] = static_cast<double>(result.decisionTimeMs_);
+}
+
+void RegisterRecordedTraceBenchmark()
+{
+    const char* path = std::getenv(RECORDED_TRACE_ENV);
+    if (path == nullptr) {
+        return;
+    }
+    static MotionTrace trace;
+    if (!MotionTrace::Load(path, trace)) {
+        std::fprintf(stderr, "failed to load motion trace %s\n", path);
+        return;
+    }
+    for (bool isRepeatedDetection : {false, true}) {
+        benchmark::RegisterBenchmark(isRepeatedDetection ? "ReplayRecordedTrace/repeated" : "ReplayRecordedTrace",
+            [isRepeatedDetection](benchmark::State& state) {
+                ReplayRecordedTrace(state, trace, isRepeatedDetection);
+            })->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+    }
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+
+int main(int argc, char** argv)
+{
+    OHOS::DevStandbyMgr::RegisterRecordedTraceBenchmark();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "motion_trace_replay.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "base_state.h"
+#include "motion_sensor_monitor.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+const std::string TRACE_MOVING = "moving";
+const std::string TRACE_ACCELEROMETER = "A";
+const std::string TRACE_SIGNIFICANT_MOTION = "M";
+
+bool ParseRecord(const std::string& line, MotionTrace& trace)
+{
+    std::istringstream record(line);
+    std::string tag;
+    if (!(record >> tag) || tag[0] == '#') {
+        return true;
+    }
+    if (tag == TRACE_MOVING) {
+        return static_cast<bool>(record >> trace.isMoving_);
+    }
+    MotionTraceSample sample;
+    if (!(record >> sample.timeMs_)) {
+        return false;
+    }
+    if (!trace.samples_.empty() && sample.timeMs_ < trace.samples_.back().timeMs_) {
+        return false;
+    }
+    if (tag == TRACE_SIGNIFICANT_MOTION) {
+        sample.type_ = MotionTraceSampleType::SIGNIFICANT_MOTION;
+    } else if (tag != TRACE_ACCELEROMETER ||
+        !(record >> sample.accelData_.x >> sample.accelData_.y >> sample.accelData_.z)) {
+        return false;
+    }
+    trace.samples_.emplace_back(sample);
+    return true;
+}
+}
+
+bool MotionTrace::Parse(std::istream& input, MotionTrace& trace)
+{
+    trace = MotionTrace {};
+    std::string line;
+    while (std::getline(input, line)) {
+        if (!ParseRecord(line, trace)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MotionTrace::Load(const std::string& path, MotionTrace& trace)
+{
+    std::ifstream input(path);
+    return input.is_open() && Parse(input, trace);
+}
+
+MotionTraceReplayer::MotionTraceReplayer(const MotionReplayConfig& config) : config_(config)
+{
+    ConstraintEvalParam params {};
+    params.isRepeatedDetection_ = config.isRepeatedDetection_;
+    monitor_ = std::make_shared<MotionSensorMonitor>(config.detectionTimeOut_, config.restTimeOut_,
+        config.totalTimeOut_, params);
+}
+
+MotionTraceReplayer::~MotionTraceReplayer()
+{
+    monitor_->StopMonitoringInner();
+}
+
+MotionReplayResult MotionTraceReplayer::Replay(const MotionTrace& trace)
+{
+    MotionReplayResult result;
+    result.decisionTimeMs_ = config_.totalTimeOut_;
+    monitor_->ResetEvaluation();
+    bool isDetecting = false;
+    for (const auto& sample : trace.samples_) {
+        if (sample.timeMs_ >= config_.totalTimeOut_) {
+            break;
+        }
+        // a new window restarts the sensor and the energy, as PeriodlyStartMotionDetection does
+        bool isInWindow = IsInDetectionWindow(sample.timeMs_);
+        if (isInWindow && !isDetecting) {
+            monitor_->StartMonitoringInner();
+        } else if (!isInWindow && isDetecting) {
+            monitor_->StopMonitoringInner();
+        }
+        isDetecting = isInWindow;
+        if (!isDetecting) {
+            ++result.restingSampleCount_;
+            continue;
+        }
+        Deliver(sample);
+        ++result.deliveredSampleCount_;
+        if (monitor_->hasPostedResult_.load()) {
+            result.isMotionDetected_ = true;
+            result.decisionTimeMs_ = sample.timeMs_;
+            break;
+        }
+    }
+    monitor_->StopMonitoringInner();
+    return result;
+}
+
+bool MotionTraceReplayer::IsInDetectionWindow(int64_t timeMs) const
+{
+    int64_t period = static_cast<int64_t>(config_.detectionTimeOut_) + config_.restTimeOut_;
+    return period <= 0 || timeMs % period < config_.detectionTimeOut_;
+}
+
+void MotionTraceReplayer::Deliver(const MotionTraceSample& sample)
+{
+    AccelData accelData = sample.accelData_;
+    SensorEvent event {};
+    event.data = reinterpret_cast<uint8_t*>(&accelData);
+    event.dataLen = sizeof(AccelData);
+    if (sample.type_ == MotionTraceSampleType::SIGNIFICANT_MOTION) {
+        MotionSensorMonitor::MotionSensorCallback(&event);
+        return;
+    }
+    if (config_.isRepeatedDetection_) {
+        MotionSensorMonitor::RepeatAcceleromterCallback(&event);
+    } else {
+        MotionSensorMonitor::AcceleromterCallback(&event);
+    }
+    monitor_->DrainAccelSamples();
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_PLUGINS_TEST_BENCHMARKTEST_MOTION_TRACE_REPLAY_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_PLUGINS_TEST_BENCHMARKTEST_MOTION_TRACE_REPLAY_H
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sensor_agent_type.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+class MotionSensorMonitor;
+
+enum class MotionTraceSampleType : uint32_t {
+    ACCELEROMETER = 0,
+    SIGNIFICANT_MOTION,
+};
+
+struct MotionTraceSample {
+    // time since the evaluation started
+    int64_t timeMs_ {0};
+    MotionTraceSampleType type_ {MotionTraceSampleType::ACCELEROMETER};
+    AccelData accelData_ {0, 0, 0};
+};
+
+/**
+ * @brief samples recorded from the accelerometer and the significant motion sensor.
+ *
+ * The text format has one record per line, fields are separated by spaces and lines starting with '#' are comments:
+ *     moving <0|1>             whether the device was moving when recorded, used to count false wakes
+ *     A <timeMs> <x> <y> <z>   accelerometer sample
+ *     M <timeMs>               significant motion event
+ * Records must be sorted by time.
+ */
+struct MotionTrace {
+    bool isMoving_ {false};
+    std::vector<MotionTraceSample> samples_ {};
+
+    static bool Parse(std::istream& input, MotionTrace& trace);
+    static bool Load(const std::string& path, MotionTrace& trace);
+};
+
+struct MotionReplayConfig {
+    int32_t detectionTimeOut_ {0};
+    int32_t restTimeOut_ {0};
+    int32_t totalTimeOut_ {0};
+    bool isRepeatedDetection_ {false};
+};
+
+struct MotionReplayResult {
+    bool isMotionDetected_ {false};
+    // virtual time of the decision, the total timeout if no motion is detected
+    int64_t decisionTimeMs_ {0};
+    uint64_t deliveredSampleCount_ {0};
+    // samples arriving while the sensor rests between detections
+    uint64_t restingSampleCount_ {0};
+};
+
+/**
+ * @brief replay a trace through the callbacks of MotionSensorMonitor with a virtual clock.
+ *
+ * The replayer plays the role of the handler: it opens and closes detection windows as the timed tasks of the
+ * monitor would, and drains samples right after each callback as an idle handler would. The monitor is not bound to
+ * sensors and the result is read from the monitor instead of ending the evaluation of the state manager.
+ */
+class MotionTraceReplayer {
+public:
+    explicit MotionTraceReplayer(const MotionReplayConfig& config);
+    ~MotionTraceReplayer();
+
+    // the motion threshold is read from the standby config when the replay starts
+    MotionReplayResult Replay(const MotionTrace& trace);
+
+private:
+    bool IsInDetectionWindow(int64_t timeMs) const;
+    void Deliver(const MotionTraceSample& sample);
+
+private:
+    MotionReplayConfig config_ {};
+    std::shared_ptr<MotionSensorMonitor> monitor_ {nullptr};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_PLUGINS_TEST_BENCHMARKTEST_MOTION_TRACE_REPLAY_H
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "standby_messsage.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+    const std::string BUNDLE_NAME = "com.example.standby.benchmark";
+    constexpr int32_t UID = 20010001;
+    constexpr int32_t PID = 12345;
+
+    // same cost model as StandbyServiceImpl::DispatchEvent, the message is captured by a posted task
+    void Dispatch(StandbyMessage message, const std::function<void(const StandbyMessage&)>& consumer)
+    {
+        std::function<void()> task = [message = std::move(message), &consumer]() {
+            consumer(message);
+        };
+        task();
+    }
+}
+
+/**
+ * @tc.name: ProcessStateChangedWithWant
+ * @tc.desc: produce and consume PROCESS_STATE_CHANGED through want params, the layout before typed payload.
+ */
+static void ProcessStateChangedWithWant(benchmark::State& state)
+{
+    auto consumer = [](const StandbyMessage& message) {
+        int32_t uid = message.want_->GetIntParam("uid", -1);
+        int32_t pid = message.want_->GetIntParam("pid", -1);
+        std::string bundleName = message.want_->GetStringParam("name");
+        bool isCreated = message.want_->GetBoolParam("isCreated", false);
+        benchmark::DoNotOptimize(uid + pid + static_cast<int32_t>(bundleName.size()) + isCreated);
+    };
+    for (auto _ : state) {
+        StandbyMessage standbyMessage {StandbyMessageType::PROCESS_STATE_CHANGED};
+        standbyMessage.want_ = AAFwk::Want {};
+        standbyMessage.want_->SetParam("uid", UID);
+        standbyMessage.want_->SetParam("pid", PID);
+        standbyMessage.want_->SetParam("name", BUNDLE_NAME);
+        standbyMessage.want_->SetParam("isCreated", true);
+        Dispatch(standbyMessage, consumer);
+    }
+}
+BENCHMARK(ProcessStateChangedWithWant);
+
+/**
+ * @tc.name: ProcessStateChangedWithPayload
+ * @tc.desc: produce and consume PROCESS_STATE_CHANGED through the typed payload.
+ */
+static void ProcessStateChangedWithPayload(benchmark::State& state)
+{
+    auto consumer = [](const StandbyMessage& message) {
+        ProcessStateChangedPayload decoded;
+        const ProcessStateChangedPayload* payload = message.GetPayload(decoded);
+        benchmark::DoNotOptimize(payload->uid_ + payload->pid_ + static_cast<int32_t>(payload->name_.size()) +
+            payload->isCreated_);
+    };
+    for (auto _ : state) {
+        Dispatch(StandbyMessage(StandbyMessageType::PROCESS_STATE_CHANGED,
+            ProcessStateChangedPayload {UID, PID, BUNDLE_NAME, true}), consumer);
+    }
+}
+BENCHMARK(ProcessStateChangedWithPayload);
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -72,6 +72,7 @@ HWTEST_F(MotionSensorMonitorTest, AcceleromterCallback, TestSize.Level1)
     auto repeatedMotionConstraint = std::make_shared<MotionSensorMonitor>(
         PERIODLY_TASK_DECTION_TIMEOUT, PERIODLY_TASK_REST_TIMEOUT, PERIODLY_TASK_TOTAL_TIMEOUT, repeatedMotionParams);
     StandbyConfigManager::GetInstance()->standbyParaMap_[MOTION_THREADSHOLD] = 0;
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
     SensorEvent event;
     GravityData data = { 0, 0, 0 };
     event.sensorTypeId = SENSOR_TYPE_ID_NONE;
@@ -93,6 +94,7 @@ HWTEST_F(MotionSensorMonitorTest, RepeatAcceleromterCallback, TestSize.Level1)
     auto repeatedMotionConstraint = std::make_shared<MotionSensorMonitor>(
         PERIODLY_TASK_DECTION_TIMEOUT, PERIODLY_TASK_REST_TIMEOUT, PERIODLY_TASK_TOTAL_TIMEOUT, repeatedMotionParams);
     StandbyConfigManager::GetInstance()->standbyParaMap_[MOTION_THREADSHOLD] = 0;
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
     SensorEvent event;
     GravityData data = { 0, 0, 0 };
     event.sensorTypeId = SENSOR_TYPE_ID_NONE;
@@ -272,5 +274,53 @@ HWTEST_F(MotionSensorMonitorTest, StopSensor, TestSize.Level1)
     repeatedMotionConstraint->isMonitoring_ = true;
     repeatedMotionConstraint->StopSensor();
 }
+
+/**
+ * @tc.name: DrainAccelSamples
+ * @tc.desc: test samples pushed by sensor callbacks and evaluated in batch.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MotionSensorMonitorTest, DrainAccelSamples, TestSize.Level1)
+{
+    ConstraintEvalParam repeatedMotionParams{};
+    auto repeatedMotionConstraint = std::make_shared<MotionSensorMonitor>(
+        PERIODLY_TASK_DECTION_TIMEOUT, PERIODLY_TASK_REST_TIMEOUT, PERIODLY_TASK_TOTAL_TIMEOUT, repeatedMotionParams);
+    std::vector<AccelData> samples {{0, 0, 0}, {1, 0, 0}, {0, 2, 0}, {0, 0, 3}, {1, 1, 1}, {2, 0, 0}};
+    MotionSensorMonitor::energy_ = 0;
+    MotionSensorMonitor::hasPrevAccelData_ = false;
+    for (auto& sample : samples) {
+        MotionSensorMonitor::AddEnergy(&sample);
+    }
+    double energy = MotionSensorMonitor::GetEnergy();
+    MotionSensorMonitor::energy_ = 0;
+    MotionSensorMonitor::hasPrevAccelData_ = false;
+    MotionSensorMonitor::AddEnergy(samples.data(), samples.size());
+    EXPECT_DOUBLE_EQ(MotionSensorMonitor::GetEnergy(), energy);
+
+    // samples are dropped while no monitor is active
+    SensorEvent event;
+    event.data = reinterpret_cast<uint8_t*>(&samples[1]);
+    MotionSensorMonitor::activeMonitor_.store(nullptr);
+    repeatedMotionConstraint->AcceleromterCallback(&event);
+    EXPECT_FALSE(repeatedMotionConstraint->isDrainPosted_.load());
+
+    MotionSensorMonitor::energy_ = 0;
+    MotionSensorMonitor::hasPrevAccelData_ = false;
+    MotionSensorMonitor::activeMonitor_.store(repeatedMotionConstraint.get());
+    repeatedMotionConstraint->isMonitoring_ = true;
+    repeatedMotionConstraint->motionThreshold_ = energy / 2;
+    for (auto& sample : samples) {
+        event.data = reinterpret_cast<uint8_t*>(&sample);
+        repeatedMotionConstraint->RepeatAcceleromterCallback(&event);
+    }
+    EXPECT_TRUE(repeatedMotionConstraint->isDrainPosted_.load());
+    repeatedMotionConstraint->DrainAccelSamples();
+    EXPECT_FALSE(repeatedMotionConstraint->isDrainPosted_.load());
+    EXPECT_DOUBLE_EQ(MotionSensorMonitor::GetEnergy(), energy);
+    EXPECT_TRUE(repeatedMotionConstraint->hasPostedResult_.load());
+    repeatedMotionConstraint->StopMonitoringInner();
+    EXPECT_EQ(MotionSensorMonitor::activeMonitor_.load(), nullptr);
+}
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
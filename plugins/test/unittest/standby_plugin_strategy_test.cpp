@@ -21,15 +21,18 @@
 #include "system_ability_definition.h"
 
 #include "running_lock_strategy.h"
+#include "exemption_index.h"
 #ifdef STANDBY_COMMUNICATION_NETMANAGER_BASE_ENABLE
 #include "network_strategy.h"
 #include "base_network_strategy.h"
 #endif
+#include "allow_type.h"
 #include "standby_messsage.h"
 #include "common_constant.h"
 #include "want.h"
 #include "workscheduler_srv_client.h"
 #include "standby_config_manager.h"
+#include "standby_service_impl.h"
 
 using namespace testing::ext;
 using namespace testing::mt;
@@ -183,8 +186,8 @@ HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_004, TestSize.Leve
  */
 HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_005, TestSize.Level1)
 {
-    auto runningLockStrategy = std::make_shared<RunningLockStrategy>();
-    EXPECT_EQ(runningLockStrategy->GetBackgroundTaskApp(), ERR_OK);
+    auto exemptionIndex = ExemptionIndex::GetInstance();
+    EXPECT_EQ(exemptionIndex->GetBackgroundTaskApp(), ERR_OK);
 }
 
 /**
@@ -195,8 +198,8 @@ HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_005, TestSize.Leve
  */
 HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_006, TestSize.Level1)
 {
-    auto runningLockStrategy = std::make_shared<RunningLockStrategy>();
-    EXPECT_EQ(runningLockStrategy->GetForegroundApplications(), ERR_OK);
+    auto exemptionIndex = ExemptionIndex::GetInstance();
+    EXPECT_EQ(exemptionIndex->GetForegroundApplications(), ERR_OK);
 }
 
 /**
@@ -207,8 +210,8 @@ HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_006, TestSize.Leve
  */
 HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_007, TestSize.Level1)
 {
-    auto runningLockStrategy = std::make_shared<RunningLockStrategy>();
-    EXPECT_EQ(runningLockStrategy->GetWorkSchedulerTask(), ERR_OK);
+    auto exemptionIndex = ExemptionIndex::GetInstance();
+    EXPECT_EQ(exemptionIndex->GetWorkSchedulerTask(), ERR_OK);
 }
 
 /**
@@ -219,8 +222,8 @@ HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_007, TestSize.Leve
  */
 HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_008, TestSize.Level1)
 {
-    auto runningLockStrategy = std::make_shared<RunningLockStrategy>();
-    EXPECT_EQ(runningLockStrategy->GetAllRunningAppInfo(), ERR_OK);
+    auto exemptionIndex = ExemptionIndex::GetInstance();
+    EXPECT_EQ(exemptionIndex->GetAllRunningAppInfo(), ERR_OK);
 }
 
 /**
@@ -344,5 +347,248 @@ HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_014, TestSize.Leve
     EXPECT_EQ(baseNetworkStrategy->IsFlagExempted(flag), true);
 }
 #endif // STANDBY_COMMUNICATION_NETMANAGER_BASE_ENABLE
+
+/**
+ * @tc.name: StandbyPluginStrategyTest_015
+ * @tc.desc: test typed payload of standby message.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_015, TestSize.Level1)
+{
+    auto runningLockStrategy = std::make_shared<RunningLockStrategy>();
+    int32_t uid = 1;
+    int32_t pid = 1;
+    std::string bundleName = "defaultBundleName";
+    runningLockStrategy->isProxied_ = true;
+    std::string mapKey = std::to_string(uid) + "_" + bundleName;
+    struct ProxiedProcInfo procInfo = {
+        bundleName,
+        uid,
+        {pid}
+    };
+    runningLockStrategy->proxiedAppInfo_.emplace(mapKey, procInfo);
+    StandbyMessage standbyMessage {StandbyMessageType::PROCESS_STATE_CHANGED,
+        ProcessStateChangedPayload {uid, pid, bundleName, false}};
+    runningLockStrategy->HandleProcessStatusChanged(standbyMessage);
+    EXPECT_EQ(runningLockStrategy->proxiedAppInfo_.count(mapKey), 0);
+    EXPECT_FALSE(standbyMessage.want_.has_value());
+
+    StandbyMessage wantMessage {StandbyMessageType::PROCESS_STATE_CHANGED};
+    wantMessage.want_ = AAFwk::Want {};
+    wantMessage.want_->SetParam("uid", uid);
+    wantMessage.want_->SetParam("pid", pid);
+    wantMessage.want_->SetParam("name", bundleName);
+    ProcessStateChangedPayload decoded;
+    const ProcessStateChangedPayload* payload = wantMessage.GetPayload(decoded);
+    EXPECT_EQ(payload, &decoded);
+    EXPECT_EQ(payload->name_, bundleName);
+
+    runningLockStrategy->proxiedAppInfo_.emplace(mapKey, procInfo);
+    StandbyMessage bgTaskMessage {StandbyMessageType::BG_TASK_STATUS_CHANGE,
+        BgTaskStatusPayload {CONTINUOUS_TASK, true, uid, bundleName, 0}};
+    EXPECT_EQ(runningLockStrategy->UpdateBgTaskAppStatus(bgTaskMessage), ERR_OK);
+    EXPECT_NE(runningLockStrategy->proxiedAppInfo_[mapKey].appExemptionFlag_ & ExemptionTypeFlag::CONTINUOUS_TASK, 0);
+
+    AllowListChangedPayload allowPayload;
+    allowPayload.allowType_ = AllowType::NETWORK;
+    allowPayload.changes_.push_back({uid, bundleName, AllowType::NETWORK, true});
+    StandbyMessage allowMessage {StandbyMessageType::ALLOW_LIST_CHANGED, std::move(allowPayload)};
+    EXPECT_EQ(runningLockStrategy->UpdateExemptionList(allowMessage), ERR_STANDBY_STRATEGY_NOT_MATCH);
+}
+
+/**
+ * @tc.name: StandbyPluginStrategyTest_016
+ * @tc.desc: test exemption cache of RunningLockStrategy.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_016, TestSize.Level1)
+{
+    auto runningLockStrategy = std::make_shared<RunningLockStrategy>();
+    int32_t uid = 1;
+    int32_t pid = 1;
+    std::string bundleName = "defaultBundleName";
+    runningLockStrategy->exemptionCache_.emplace(uid,
+        AppExemptionCache {bundleName, ExemptionTypeFlag::UNRESTRICTED});
+    runningLockStrategy->GetAndCreateAppInfo(uid, pid, bundleName);
+    std::string mapKey = std::to_string(uid) + "_" + bundleName;
+    EXPECT_EQ(runningLockStrategy->proxiedAppInfo_[mapKey].appExemptionFlag_, ExemptionTypeFlag::UNRESTRICTED);
+
+    runningLockStrategy->UpdateExemptionCache(bundleName, true);
+    EXPECT_EQ(runningLockStrategy->ResolveExemptionFlag(uid, bundleName),
+        ExemptionTypeFlag::UNRESTRICTED | ExemptionTypeFlag::EXEMPTION);
+    runningLockStrategy->UpdateExemptionCache(bundleName, false);
+    EXPECT_EQ(runningLockStrategy->ResolveExemptionFlag(uid, bundleName), ExemptionTypeFlag::UNRESTRICTED);
+
+    std::string restrictedName = "restrictedBundleName";
+    runningLockStrategy->restrictNameSet_.emplace(restrictedName);
+    uint8_t flag = runningLockStrategy->ResolveExemptionFlag(uid + 1, restrictedName);
+    EXPECT_NE(flag & ExemptionTypeFlag::RESTRICTED, 0);
+    EXPECT_EQ(runningLockStrategy->exemptionCache_.count(uid + 1), 1);
+
+    runningLockStrategy->ClearProxyRecord();
+    EXPECT_TRUE(runningLockStrategy->exemptionCache_.empty());
+}
+
+/**
+ * @tc.name: StandbyPluginStrategyTest_017
+ * @tc.desc: test ExemptionIndex.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_017, TestSize.Level1)
+{
+    auto exemptionIndex = ExemptionIndex::GetInstance();
+    exemptionIndex->Invalidate();
+    exemptionIndex->isPopulated_ = true;
+    auto reuseCount = exemptionIndex->reuseCount_;
+    EXPECT_EQ(exemptionIndex->Populate(), ERR_OK);
+    EXPECT_EQ(exemptionIndex->reuseCount_, reuseCount + 1);
+
+    int32_t uid = 1;
+    StandbyMessage processMessage {StandbyMessageType::PROCESS_STATE_CHANGED,
+        ProcessStateChangedPayload {uid, 1, "defaultBundleName", true}};
+    exemptionIndex->HandleEvent(processMessage);
+    EXPECT_EQ(exemptionIndex->entries_[uid].pids_.size(), 1);
+    StandbyMessage bgTaskMessage {StandbyMessageType::BG_TASK_STATUS_CHANGE,
+        BgTaskStatusPayload {CONTINUOUS_TASK, true, uid, "defaultBundleName", 1}};
+    exemptionIndex->HandleEvent(bgTaskMessage);
+    EXPECT_EQ(exemptionIndex->entries_[uid].appExemptionFlag_, ExemptionTypeFlag::CONTINUOUS_TASK);
+    EXPECT_EQ(exemptionIndex->entries_[uid].continuousTaskTypes_, 1 << 1);
+
+    #ifdef STANDBY_COMMUNICATION_NETMANAGER_BASE_ENABLE
+    auto baseNetworkStrategy = std::make_shared<NetworkStrategy>();
+    baseNetworkStrategy->condition_ = ConditionType::NIGHT_STANDBY;
+    baseNetworkStrategy->nightExemptionTaskType_ = 0;
+    EXPECT_EQ(baseNetworkStrategy->GetAppStateFlag(exemptionIndex->entries_[uid]), 0);
+    baseNetworkStrategy->nightExemptionTaskType_ = 1 << 1;
+    EXPECT_EQ(baseNetworkStrategy->GetAppStateFlag(exemptionIndex->entries_[uid]), ExemptionTypeFlag::CONTINUOUS_TASK);
+    #endif
+
+    processMessage.payload_ = ProcessStateChangedPayload {uid, 1, "defaultBundleName", false};
+    exemptionIndex->HandleEvent(processMessage);
+    EXPECT_TRUE(exemptionIndex->entries_[uid].pids_.empty());
+
+    StandbyMessage stateMessage {StandbyMessageType::STATE_TRANSIT};
+    exemptionIndex->HandleEvent(stateMessage);
+    EXPECT_FALSE(exemptionIndex->isPopulated_);
+    EXPECT_TRUE(exemptionIndex->entries_.empty());
+
+    exemptionIndex->isPopulated_ = true;
+    exemptionIndex->entries_[uid].appExemptionFlag_ = ExemptionTypeFlag::FOREGROUND_APP;
+    StandbyMessage conditionMessage {StandbyMessageType::RES_CTRL_CONDITION_CHANGED};
+    exemptionIndex->HandleEvent(conditionMessage);
+    EXPECT_FALSE(exemptionIndex->isPopulated_);
+    EXPECT_TRUE(exemptionIndex->entries_.empty());
+}
+
+/**
+ * @tc.name: StandbyPluginStrategyTest_018
+ * @tc.desc: test delta synchronization of firewall trustlist.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_018, TestSize.Level1)
+{
+    #ifdef STANDBY_COMMUNICATION_NETMANAGER_BASE_ENABLE
+    auto baseNetworkStrategy = std::make_shared<NetworkStrategy>();
+    baseNetworkStrategy->isIdleMaintence_ = false;
+    baseNetworkStrategy->netLimitedAppInfo_.clear();
+    baseNetworkStrategy->netLimitedAppInfo_.emplace(1, NetLimtedAppInfo {"exemptedBundleName",
+        ExemptionTypeFlag::TRANSIENT_TASK});
+    baseNetworkStrategy->netLimitedAppInfo_.emplace(2, NetLimtedAppInfo {"defaultBundleName"});
+    baseNetworkStrategy->SetNetAllowApps(true);
+    EXPECT_EQ(baseNetworkStrategy->trustlistShadow_.size(), 1);
+    EXPECT_EQ(baseNetworkStrategy->trustlistCallCount_, 1);
+
+    // unchanged trustlist is not sent again
+    baseNetworkStrategy->SetNetAllowApps(true);
+    EXPECT_EQ(baseNetworkStrategy->trustlistCallCount_, 1);
+
+    // changes cancelling out are not sent
+    baseNetworkStrategy->pendingTrustlist_[2] = true;
+    baseNetworkStrategy->pendingTrustlist_[2] = false;
+    baseNetworkStrategy->FlushTrustlistChanges();
+    EXPECT_EQ(baseNetworkStrategy->trustlistCallCount_, 1);
+
+    // changes in maintenance are deferred
+    baseNetworkStrategy->isIdleMaintence_ = true;
+    baseNetworkStrategy->pendingTrustlist_[1] = false;
+    baseNetworkStrategy->FlushTrustlistChanges();
+    EXPECT_EQ(baseNetworkStrategy->trustlistShadow_.count(1), 1);
+    baseNetworkStrategy->isIdleMaintence_ = false;
+    baseNetworkStrategy->FlushTrustlistChanges();
+    EXPECT_EQ(baseNetworkStrategy->trustlistShadow_.count(1), 0);
+    EXPECT_EQ(baseNetworkStrategy->trustlistSentCount_, 2);
+
+    // the trustlist of a restarted net policy service is unknown
+    baseNetworkStrategy->trustlistShadow_.emplace(1);
+    baseNetworkStrategy->isTrustlistKnown_ = true;
+    StandbyMessage saMessage {StandbyMessageType::SYS_ABILITY_STATUS_CHANGED};
+    saMessage.want_ = AAFwk::Want {};
+    saMessage.want_->SetParam(SA_STATUS, false);
+    saMessage.want_->SetParam(SA_ID, COMM_NET_POLICY_MANAGER_SYS_ABILITY_ID);
+    baseNetworkStrategy->HandleEvent(saMessage);
+    EXPECT_TRUE(baseNetworkStrategy->trustlistShadow_.empty());
+    EXPECT_FALSE(baseNetworkStrategy->isTrustlistKnown_);
+    baseNetworkStrategy->netLimitedAppInfo_.clear();
+    #endif
+}
+
+/**
+ * @tc.name: StandbyPluginStrategyTest_019
+ * @tc.desc: test batched proxy of running lock.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_019, TestSize.Level1)
+{
+    auto runningLockStrategy = std::make_shared<RunningLockStrategy>();
+    runningLockStrategy->isIdleMaintence_ = false;
+    runningLockStrategy->QueueProxyRunningLock(true, {std::make_pair(1, 1)});
+    runningLockStrategy->QueueProxyRunningLock(false, {std::make_pair(1, 1)});
+    EXPECT_TRUE(runningLockStrategy->pendingProxyOps_.empty());
+    EXPECT_EQ(runningLockStrategy->cancelledProxyOpCount_, 1);
+
+    runningLockStrategy->QueueProxyRunningLock(true, {std::make_pair(2, 1), std::make_pair(3, 1)});
+    runningLockStrategy->QueueProxyRunningLock(true, {std::make_pair(2, 1)});
+    runningLockStrategy->QueueProxyRunningLock(false, {std::make_pair(4, 2)});
+    EXPECT_EQ(runningLockStrategy->pendingProxyOps_.size(), 3);
+    auto proxyCallCount = runningLockStrategy->proxyCallCount_;
+    runningLockStrategy->FlushProxyRunningLocks();
+    EXPECT_TRUE(runningLockStrategy->pendingProxyOps_.empty());
+    EXPECT_EQ(runningLockStrategy->proxyCallCount_, proxyCallCount + 2);
+    EXPECT_FALSE(runningLockStrategy->isProxyFlushPosted_);
+}
+
+/**
+ * @tc.name: StandbyPluginStrategyTest_020
+ * @tc.desc: test exemption of a name allowed by another uid is kept when one uid is removed.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyPluginStrategyTest, StandbyPluginStrategyTest_020, TestSize.Level1)
+{
+    auto runningLockStrategy = std::make_shared<RunningLockStrategy>();
+    int32_t uid = 1;
+    std::string bundleName = "sharedBundleName";
+    runningLockStrategy->exemptionCache_.emplace(uid, AppExemptionCache {bundleName, 0});
+    EXPECT_TRUE(runningLockStrategy->UpdateExemptionCache(bundleName, true));
+
+    AllowRecord allowRecord(uid + 1, 0, bundleName, AllowType::RUNNING_LOCK);
+    allowRecord.reasonCode_ = ReasonCodeEnum::REASON_APP_API;
+    allowRecord.SetAllowTime(AllowTime {1, INT64_MAX, "test"});
+    auto& allowRecordIndex = StandbyServiceImpl::GetInstance()->allowRecordIndex_;
+    uint32_t slot = allowRecordIndex.Insert(allowRecord);
+    EXPECT_TRUE(runningLockStrategy->UpdateExemptionCache(bundleName, false));
+    EXPECT_EQ(runningLockStrategy->allowNameSet_.count(bundleName), 1);
+    EXPECT_EQ(runningLockStrategy->ResolveExemptionFlag(uid, bundleName), ExemptionTypeFlag::EXEMPTION);
+
+    allowRecordIndex.Erase(slot);
+    EXPECT_FALSE(runningLockStrategy->UpdateExemptionCache(bundleName, false));
+    EXPECT_EQ(runningLockStrategy->allowNameSet_.count(bundleName), 0);
+    EXPECT_EQ(runningLockStrategy->ResolveExemptionFlag(uid, bundleName), 0);
+}
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
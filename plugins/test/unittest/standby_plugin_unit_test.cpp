@@ -224,9 +224,11 @@ HWTEST_F(StandbyPluginUnitTest, StandbyPluginUnitTest_005, TestSize.Level1)
 HWTEST_F(StandbyPluginUnitTest, StandbyPluginUnitTest_006, TestSize.Level1)
 {
     StandbyConfigManager::GetInstance()->standbySwitchMap_[DETECT_MOTION_CONFIG] = false;
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
     constraintManager_->UnInit();
     constraintManager_->Init();
     StandbyConfigManager::GetInstance()->standbySwitchMap_[DETECT_MOTION_CONFIG] = true;
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
     constraintManager_->UnInit();
     constraintManager_->Init();
     constraintManager_->isEvaluation_ = true;
@@ -1017,5 +1019,34 @@ HWTEST_F(StandbyPluginUnitTest, StandbyPluginUnitTest_045, TestSize.Level1)
     stateManager->IsScrOffHalfHourCtrl();
     EXPECT_NE(standbyStateManager_, nullptr);
 }
+
+/**
+ * @tc.name: StandbyPluginUnitTest_046
+ * @tc.desc: test event interest routing of plugin managers.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyPluginUnitTest, StandbyPluginUnitTest_046, TestSize.Level1)
+{
+    EXPECT_NE(standbyStateManager_->GetEventInterest() & GetEventMask(StandbyMessageType::COMMON_EVENT), 0);
+    EXPECT_EQ(standbyStateManager_->GetEventInterest() & GetEventMask(StandbyMessageType::PROCESS_STATE_CHANGED), 0);
+    EXPECT_NE(listenerManager_->GetEventInterest() &
+        GetEventMask(StandbyMessageType::SYS_ABILITY_STATUS_CHANGED), 0);
+    EXPECT_EQ(GetEventMask(MAX_MASKED_EVENT_ID), ALL_STANDBY_EVENTS);
+
+    auto strategyManager = std::make_shared<StrategyManagerAdapter>();
+    strategyManager->RegisterPolicy({"RUNNING_LOCK"});
+    ASSERT_EQ(strategyManager->strategyList_.size(), 1);
+    EXPECT_NE(strategyManager->GetEventInterest() & GetEventMask(StandbyMessageType::PROCESS_STATE_CHANGED), 0);
+    EXPECT_EQ(strategyManager->GetEventInterest() & GetEventMask(StandbyMessageType::AUDIO_RENDERER_CHANGE), 0);
+
+    strategyManager->HandleEvent(StandbyMessage(StandbyMessageType::AUDIO_RENDERER_CHANGE));
+    EXPECT_EQ(strategyManager->deliveredCount_, 0);
+    EXPECT_EQ(strategyManager->skippedCount_, 1);
+    strategyManager->HandleEvent(StandbyMessage(StandbyMessageType::RES_CTRL_CONDITION_CHANGED));
+    EXPECT_EQ(strategyManager->deliveredCount_, 1);
+    strategyManager->UnInit();
+    EXPECT_EQ(strategyManager->GetEventInterest(), 0);
+}
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_INCLUDE_TIME_PROVIDER_H
 #define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_INCLUDE_TIME_PROVIDER_H
 
+#include <atomic>
 #include <ctime>
 #include <cstdint>
 
@@ -48,17 +49,31 @@ enum TimeConstant : int64_t {
 class TimeProvider {
 public:
     static bool ConvertTimeStampToLocalTime(int64_t curTimeStamp, struct tm& curLocalTime);
+    /**
+     * @brief get day or night condition after afterNextSeconds, served from the cached condition clock.
+     */
     static uint32_t GetCondition(int64_t afterNextSeconds = 0);
+    /**
+     * @brief recompute the cached condition clock, invoked on day and night switch and time or timezone change.
+     */
+    static void RefreshCondition();
     static int64_t GetNapTimeOut();
     static bool TimeDiffToDayNightSwitch(int64_t& timeDiff);
     static int32_t GetRandomDelay(int32_t low, int32_t high);
     static bool DiffToFixedClock(int64_t curTimeStamp, int32_t tmHour, int32_t tmMin, int64_t& timeDiff);
     static int32_t GetCurrentDate();
 
-#ifdef STANDBY_POWER_MANAGER_ENABLE
 private:
+    static int64_t GetWallTimeMs();
+    static uint64_t ComputeConditionClock(int64_t curSecTimeStamp);
+    static uint64_t LoadConditionClock(int64_t curSecTimeStamp);
+#ifdef STANDBY_POWER_MANAGER_ENABLE
     static bool IsPowerSaveMode();
 #endif
+
+private:
+    // timestamp in seconds of the next day and night switch, packed with the current condition
+    static std::atomic<uint64_t> conditionClock_;
 };
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
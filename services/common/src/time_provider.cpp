@@ -43,8 +43,21 @@ namespace {
 #ifdef STANDBY_POWER_MANAGER_ENABLE
     constexpr int32_t SAVE_MODE_ENTRANCE_MIN = 1;
 #endif
+    constexpr int64_t DAY_ENTRANCE_SEC = DAY_ENTRANCE_HOUR * SEC_PER_HOUR + DAY_ENTRANCE_MIN * SEC_PER_MIN;
+    constexpr int64_t NIGHT_ENTRANCE_SEC = NIGHT_ENTRANCE_HOUR * SEC_PER_HOUR + NIGHT_ENTRANCE_MIN * SEC_PER_MIN;
+    constexpr int64_t DAY_PERIOD_SEC = NIGHT_ENTRANCE_SEC - DAY_ENTRANCE_SEC;
+    constexpr int64_t NIGHT_PERIOD_SEC = SEC_PER_DAY - DAY_PERIOD_SEC;
+    constexpr uint32_t CONDITION_CLOCK_BITS = 2;
+    constexpr uint64_t CONDITION_CLOCK_MASK = (1ULL << CONDITION_CLOCK_BITS) - 1;
+
+    inline int64_t GetConditionPeriod(uint32_t condition)
+    {
+        return condition == ConditionType::NIGHT_STANDBY ? NIGHT_PERIOD_SEC : DAY_PERIOD_SEC;
+    }
 }
 
+std::atomic<uint64_t> TimeProvider::conditionClock_ {0};
+
 bool TimeProvider::ConvertTimeStampToLocalTime(int64_t curTimeStamp, struct tm& curLocalTime)
 {
     auto res = localtime_r(&curTimeStamp, &curLocalTime);
@@ -55,35 +68,100 @@ bool TimeProvider::ConvertTimeStampToLocalTime(int64_t curTimeStamp, struct tm&
     return true;
 }
 
-uint32_t TimeProvider::GetCondition(int64_t afterNextSeconds)
+int64_t TimeProvider::GetWallTimeMs()
+{
+    struct timespec curTime {};
+    clock_gettime(CLOCK_TYPE_REALTIME, &curTime);
+    return static_cast<int64_t>(curTime.tv_sec) * MSEC_PER_SEC + curTime.tv_nsec / NSEC_PER_MSEC;
+}
+
+// day condition lasts from 06:00 to 23:45 of local time, the rest of the day is night condition
+uint64_t TimeProvider::ComputeConditionClock(int64_t curSecTimeStamp)
 {
-    int64_t curSecTimeStamp = MiscServices::TimeServiceClient::GetInstance()->GetWallTimeMs() / MSEC_PER_SEC;
     struct tm curLocalTime {};
-    curSecTimeStamp += afterNextSeconds;
     if (!ConvertTimeStampToLocalTime(curSecTimeStamp, curLocalTime)) {
         STANDBYSERVICE_LOGE("convert time stamp to local time failed");
-        return ConditionType::DAY_STANDBY;
+        return 0;
     }
     STANDBYSERVICE_LOGD("current local time info: %{public}02d:%{public}02d:%{public}02d", curLocalTime.tm_hour,
         curLocalTime.tm_min, curLocalTime.tm_sec);
-    if ((curLocalTime.tm_hour < NIGHT_ENTRANCE_HOUR || curLocalTime.tm_min < NIGHT_ENTRANCE_MIN) &&
-        (curLocalTime.tm_hour >= DAY_ENTRANCE_HOUR)) {
+    int64_t secOfDay = curLocalTime.tm_hour * SEC_PER_HOUR + curLocalTime.tm_min * SEC_PER_MIN + curLocalTime.tm_sec;
+    uint32_t condition = ConditionType::NIGHT_STANDBY;
+    int64_t timeDiff = 0;
+    if (secOfDay >= DAY_ENTRANCE_SEC && secOfDay < NIGHT_ENTRANCE_SEC) {
+        condition = ConditionType::DAY_STANDBY;
+        timeDiff = NIGHT_ENTRANCE_SEC - secOfDay;
+    } else if (secOfDay >= NIGHT_ENTRANCE_SEC) {
+        timeDiff = SEC_PER_DAY - secOfDay + DAY_ENTRANCE_SEC;
+    } else {
+        timeDiff = DAY_ENTRANCE_SEC - secOfDay;
+    }
+    return (static_cast<uint64_t>(curSecTimeStamp + timeDiff) << CONDITION_CLOCK_BITS) | condition;
+}
+
+uint64_t TimeProvider::LoadConditionClock(int64_t curSecTimeStamp)
+{
+    uint64_t conditionClock = conditionClock_.load(std::memory_order_acquire);
+    int64_t nextSwitchSec = static_cast<int64_t>(conditionClock >> CONDITION_CLOCK_BITS);
+    uint32_t condition = static_cast<uint32_t>(conditionClock & CONDITION_CLOCK_MASK);
+    // the cache is stale once the switch is passed without refresh or the wall time is set backwards
+    if (conditionClock != 0 && curSecTimeStamp < nextSwitchSec &&
+        curSecTimeStamp >= nextSwitchSec - GetConditionPeriod(condition)) {
+        return conditionClock;
+    }
+    conditionClock = ComputeConditionClock(curSecTimeStamp);
+    conditionClock_.store(conditionClock, std::memory_order_release);
+    return conditionClock;
+}
+
+void TimeProvider::RefreshCondition()
+{
+    // reload timezone in case it is changed
+    tzset();
+    uint64_t conditionClock = ComputeConditionClock(GetWallTimeMs() / MSEC_PER_SEC);
+    conditionClock_.store(conditionClock, std::memory_order_release);
+    STANDBYSERVICE_LOGI("condition is %{public}u, next switch is " SPUBI64,
+        static_cast<uint32_t>(conditionClock & CONDITION_CLOCK_MASK),
+        static_cast<int64_t>(conditionClock >> CONDITION_CLOCK_BITS));
+}
+
+uint32_t TimeProvider::GetCondition(int64_t afterNextSeconds)
+{
+    int64_t curSecTimeStamp = GetWallTimeMs() / MSEC_PER_SEC;
+    uint64_t conditionClock = LoadConditionClock(curSecTimeStamp);
+    if (conditionClock == 0) {
         return ConditionType::DAY_STANDBY;
     }
-    return ConditionType::NIGHT_STANDBY;
+    uint32_t condition = static_cast<uint32_t>(conditionClock & CONDITION_CLOCK_MASK);
+    int64_t switchSec = static_cast<int64_t>(conditionClock >> CONDITION_CLOCK_BITS);
+    int64_t targetSec = curSecTimeStamp + afterNextSeconds;
+    if (targetSec < switchSec - GetConditionPeriod(condition)) {
+        conditionClock = ComputeConditionClock(targetSec);
+        return conditionClock == 0 ? ConditionType::DAY_STANDBY :
+            static_cast<uint32_t>(conditionClock & CONDITION_CLOCK_MASK);
+    }
+    if (targetSec >= switchSec) {
+        targetSec = switchSec + (targetSec - switchSec) % SEC_PER_DAY;
+    }
+    // walk the alternating day and night periods until the target time
+    while (targetSec >= switchSec) {
+        condition = condition == ConditionType::NIGHT_STANDBY ? ConditionType::DAY_STANDBY :
+            ConditionType::NIGHT_STANDBY;
+        switchSec += GetConditionPeriod(condition);
+    }
+    return condition;
 }
 
 bool TimeProvider::TimeDiffToDayNightSwitch(int64_t& timeDiff)
 {
-    int64_t curSecTimeStamp = MiscServices::TimeServiceClient::GetInstance()->GetWallTimeMs() / MSEC_PER_SEC;
-    bool res {false};
-    STANDBYSERVICE_LOGD("condition is %{public}u", GetCondition());
-    if (GetCondition() == ConditionType::NIGHT_STANDBY) {
-        res = DiffToFixedClock(curSecTimeStamp, DAY_ENTRANCE_HOUR, DAY_ENTRANCE_MIN, timeDiff);
-    } else {
-        res = DiffToFixedClock(curSecTimeStamp, NIGHT_ENTRANCE_HOUR, NIGHT_ENTRANCE_MIN, timeDiff);
+    int64_t curTimeStamp = GetWallTimeMs();
+    uint64_t conditionClock = LoadConditionClock(curTimeStamp / MSEC_PER_SEC);
+    if (conditionClock == 0) {
+        return false;
     }
-    return res;
+    STANDBYSERVICE_LOGD("condition is %{public}u", static_cast<uint32_t>(conditionClock & CONDITION_CLOCK_MASK));
+    timeDiff = static_cast<int64_t>(conditionClock >> CONDITION_CLOCK_BITS) * MSEC_PER_SEC - curTimeStamp;
+    return true;
 }
 
 bool TimeProvider::DiffToFixedClock(int64_t curTimeStamp, int32_t tmHour, int32_t tmMin, int64_t& timeDiff)
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_EXPIRY_INDEX_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_EXPIRY_INDEX_H
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace OHOS {
+namespace DevStandbyMgr {
+struct AllowExpiryEntry {
+    int32_t uid_ {-1};
+    std::string name_ {""};
+    uint32_t allowTypeIndex_ {0};
+    int64_t endTime_ {0};
+};
+
+/**
+ * @brief deadline index of time limited allow records, one entry per (uid, name, allowTypeIndex).
+ *
+ * The index is not thread safe, it is protected by the allow record lock of the service.
+ */
+class AllowExpiryIndex {
+public:
+    static constexpr int64_t NO_DEADLINE = -1;
+
+    /**
+     * @brief insert an entry or move the existing one to a new deadline.
+     */
+    void Update(int32_t uid, const std::string& name, uint32_t allowTypeIndex, int64_t endTime);
+
+    void Remove(int32_t uid, const std::string& name, uint32_t allowTypeIndex);
+
+    /**
+     * @brief get the earliest deadline, NO_DEADLINE if the index is empty.
+     */
+    int64_t GetEarliestDeadline() const;
+
+    /**
+     * @brief remove and return all entries whose deadline is not later than curTime.
+     */
+    std::vector<AllowExpiryEntry> PopExpired(int64_t curTime);
+
+    void Clear();
+    size_t Size() const;
+
+private:
+    using EntryKey = std::tuple<int32_t, std::string, uint32_t>;
+    using DeadlineKey = std::tuple<int64_t, int32_t, std::string, uint32_t>;
+    std::set<DeadlineKey> deadlines_ {};
+    std::map<EntryKey, int64_t> endTimes_ {};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_EXPIRY_INDEX_H
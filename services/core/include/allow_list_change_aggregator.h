@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_LIST_CHANGE_AGGREGATOR_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_LIST_CHANGE_AGGREGATOR_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "istandby_service_subscriber.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+/**
+ * @brief collects allow list changes and folds them into net per (uid, name) diffs.
+ *
+ * A type added and then removed within the same window, or removed and then added again, cancels out.
+ * The aggregator is not thread safe, it is protected by the allow record lock of the service.
+ */
+class AllowListChangeAggregator {
+public:
+    void Add(int32_t uid, const std::string& name, uint32_t allowType, bool added);
+
+    /**
+     * @brief take the net changes collected so far, changes which cancel out are dropped.
+     */
+    std::vector<AllowListChange> Drain();
+
+    bool Empty() const;
+
+private:
+    struct PendingChange {
+        uint32_t addedType_ {0};
+        uint32_t removedType_ {0};
+    };
+    std::map<std::pair<int32_t, std::string>, PendingChange> pendingChanges_ {};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_LIST_CHANGE_AGGREGATOR_H
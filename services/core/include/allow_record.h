@@ -16,18 +16,23 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_RECORD_H
 #define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_RECORD_H
 
-#include <list>
+#include <array>
 #include <string>
 #include <cstdint>
 #include "nlohmann/json.hpp"
+#include "allow_type.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
+// one slot per bit of AllowType, the highest bit is AllowType::FREEZE
+constexpr uint32_t ALLOW_TIME_SLOT_NUM = 7;
+static_assert((1U << (ALLOW_TIME_SLOT_NUM - 1)) == AllowType::FREEZE, "allow time slots mismatch AllowType");
+
 struct AllowTime {
     AllowTime() = default;
     AllowTime(uint32_t allowTypeIndex, int64_t endTime, const std::string& reason)
         : allowTypeIndex_(allowTypeIndex), endTime_(endTime), reason_(reason) {}
-    uint32_t allowTypeIndex_;
+    uint32_t allowTypeIndex_ {0};
     int64_t endTime_ {0};
     std::string reason_ {""};
 };
@@ -41,11 +46,21 @@ struct AllowRecord {
     bool setAllowRecordField(const nlohmann::json& value);
     bool ParseFromJson(const nlohmann::json& value);
 
+    /**
+     * @brief get the allow time of the given type, nullptr if the type has no time limited allow.
+     */
+    AllowTime* GetAllowTime(uint32_t allowTypeIndex);
+    bool SetAllowTime(const AllowTime& allowTime);
+    bool RemoveAllowTime(uint32_t allowTypeIndex);
+    void ClearAllowTime();
+
     int32_t uid_ {-1};
     int32_t pid_ {-1};
     std::string name_ {""};
     uint32_t allowType_ {0};
-    std::list<AllowTime> allowTimeList_ {};
+    // allow times are indexed by allowTypeIndex_, a slot is valid when its bit is set in allowTimeMask_
+    std::array<AllowTime, ALLOW_TIME_SLOT_NUM> allowTimes_ {};
+    uint32_t allowTimeMask_ {0};
     uint32_t reasonCode_ {0};
 };
 }  // namespace DevStandbyMgr
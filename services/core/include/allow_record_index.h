@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_RECORD_INDEX_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_RECORD_INDEX_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "allow_record.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+/**
+ * @brief allow records keyed by (uid, interned name id), stored in a contiguous slot vector.
+ *
+ * Every allow type keeps a posting list of the slots holding a time limited allow of that type, so
+ * looking up the records of one type costs the size of the result instead of the number of records.
+ * The index is not thread safe, it is protected by the allow record lock of the service.
+ */
+class AllowRecordIndex {
+public:
+    static constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+
+    /**
+     * @brief get the slot of the record, INVALID_SLOT if not exist.
+     */
+    uint32_t Find(int32_t uid, const std::string& name) const;
+
+    /**
+     * @brief get the slot of the record, an empty record is inserted if not exist.
+     *
+     * @return slot of the record and whether it is newly inserted
+     */
+    std::pair<uint32_t, bool> Emplace(int32_t uid, int32_t pid, const std::string& name);
+
+    /**
+     * @brief insert a record or replace the existing one with the same uid and name.
+     */
+    uint32_t Insert(const AllowRecord& record);
+
+    /**
+     * @brief get the record in the slot, the reference is invalidated by Emplace and Insert.
+     */
+    AllowRecord& Get(uint32_t slot);
+
+    /**
+     * @brief refresh the posting lists of the slot, must be called after allow times of the record changed.
+     */
+    void Sync(uint32_t slot);
+
+    void Erase(uint32_t slot);
+    void Clear();
+    size_t Size() const;
+    bool Empty() const;
+
+    /**
+     * @brief build the key of the record used by persistent data.
+     */
+    static std::string GetRecordKey(int32_t uid, const std::string& name);
+
+    template<typename Func>
+    void ForEach(Func&& func)
+    {
+        for (auto& recordSlot : slots_) {
+            if (recordSlot.inUse_) {
+                func(recordSlot.record_);
+            }
+        }
+    }
+
+    /**
+     * @brief visit records holding a time limited allow of the given type.
+     */
+    template<typename Func>
+    void ForEachOfType(uint32_t allowTypeIndex, Func&& func)
+    {
+        if (allowTypeIndex >= ALLOW_TIME_SLOT_NUM) {
+            return;
+        }
+        for (uint32_t slot : postings_[allowTypeIndex]) {
+            func(slots_[slot].record_);
+        }
+    }
+
+private:
+    struct RecordSlot {
+        AllowRecord record_ {};
+        uint64_t key_ {0};
+        uint32_t postedMask_ {0};
+        // position of the slot in the posting list of each posted allow type
+        std::array<uint32_t, ALLOW_TIME_SLOT_NUM> postingPos_ {};
+        bool inUse_ {false};
+    };
+
+    struct InternedName {
+        std::string name_ {""};
+        uint32_t refCount_ {0};
+    };
+
+    static uint64_t MakeKey(int32_t uid, uint32_t nameId);
+    bool GetNameId(const std::string& name, uint32_t& nameId) const;
+    uint32_t InternName(const std::string& name);
+    void ReleaseName(uint32_t nameId);
+    uint32_t AllocSlot(uint64_t key);
+    void AddPosting(uint32_t allowTypeIndex, uint32_t slot);
+    void RemovePosting(uint32_t allowTypeIndex, uint32_t slot);
+
+private:
+    std::vector<RecordSlot> slots_ {};
+    std::vector<uint32_t> freeSlots_ {};
+    std::unordered_map<uint64_t, uint32_t> slotMap_ {};
+    // interned ids are counted by the slots using them, an id is reclaimed once its last record is erased
+    std::unordered_map<std::string, uint32_t> nameIds_ {};
+    std::vector<InternedName> names_ {};
+    std::vector<uint32_t> freeNameIds_ {};
+    std::array<std::vector<uint32_t>, ALLOW_TIME_SLOT_NUM> postings_ {};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_RECORD_INDEX_H
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_RECORD_JOURNAL_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_RECORD_JOURNAL_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+/**
+ * @brief write-behind persistence of allow records, a snapshot file plus an append-only change journal.
+ *
+ * Changes are queued in memory by Record* and written out by Flush, which is expected to run on the
+ * service handler without holding the allow record lock. The journal is folded back into the snapshot
+ * by Compact once it grows past the compaction threshold.
+ * Each journal starts with its generation, a snapshot records the generation of the journal which may follow it,
+ * so a journal left behind by a compaction interrupted before truncation is not replayed over the newer snapshot.
+ */
+class AllowRecordJournal {
+public:
+    AllowRecordJournal(const std::string& snapshotPath, const std::string& journalPath);
+
+    /**
+     * @brief queue the latest content of a record, no file I/O is done here.
+     */
+    void RecordUpdate(const std::string& key, const nlohmann::json& record);
+
+    /**
+     * @brief queue the removal of a record, no file I/O is done here.
+     */
+    void RecordRemove(const std::string& key);
+
+    /**
+     * @brief append all queued changes to the journal file.
+     *
+     * @return true if succeed or nothing to flush
+     */
+    bool Flush();
+
+    /**
+     * @brief whether the journal has grown enough to be folded into the snapshot.
+     */
+    bool NeedsCompaction();
+
+    /**
+     * @brief rewrite the snapshot with the full content and truncate the journal.
+     *
+     * @param snapshot full content of all allow records, keyed by record key
+     * @return true if succeed
+     */
+    bool Compact(const nlohmann::json& snapshot);
+
+    /**
+     * @brief load the snapshot and replay the journal on top of it.
+     *
+     * @param root merged content of all allow records, keyed by record key
+     * @return true if any persistent data exists
+     */
+    bool Load(nlohmann::json& root);
+
+private:
+    bool AppendToJournal(const std::vector<std::string>& entries);
+    bool ReplayJournal(nlohmann::json& root, uint64_t snapshotGeneration);
+    bool WriteSnapshot(const nlohmann::json& snapshot, uint64_t generation);
+    bool ResetJournal(uint64_t generation);
+    void SyncParentDir(const std::string& path);
+
+private:
+    // serializes file I/O of the handler flush and the final flush of UnInit
+    std::mutex fileMutex_ {};
+    std::mutex pendingMutex_ {};
+    std::vector<std::string> pendingEntries_ {};
+    std::string snapshotPath_ {""};
+    std::string journalPath_ {""};
+    uint32_t journalEntryCount_ {0};
+    uint64_t journalGeneration_ {0};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_ALLOW_RECORD_JOURNAL_H
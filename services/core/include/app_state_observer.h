@@ -16,13 +16,79 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_APP_STATE_OBSERVER_H
 #define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_APP_STATE_OBSERVER_H
 
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "app_mgr_interface.h"
 #include "application_state_observer_stub.h"
 #include "event_handler.h"
 #include "iremote_object.h"
+#include "mpsc_queue.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
+struct AppStateEvent {
+    enum : uint8_t {
+        PROCESS_CREATED,
+        PROCESS_DIED,
+        APP_TERMINATED,
+        // live processes are seeded, the seed is taken from the queue
+        LIVE_PROCESSES_SEEDED,
+    };
+    uint8_t type_ {PROCESS_CREATED};
+    int32_t uid_ {-1};
+    int32_t pid_ {-1};
+    std::string bundleName_ {""};
+    // whether the app of a died process is still alive, checked by the enqueuing thread before seeding succeeds
+    bool isAppAlive_ {true};
+};
+
+/**
+ * @brief events of app state enqueued by binder threads and handled in batches by the handler of standby service.
+ *
+ * Live processes of each bundle are tracked from the events, so whether an app is still alive is known without ipc.
+ * The tracking is seeded with all running processes by an enqueuing thread, a failed seeding is retried with backoff.
+ * Until it succeeds, the enqueuing thread checks with ipc whether the app of a died process is alive, so the handler
+ * never waits for the app manager.
+ */
+class AppStateEventQueue : public std::enable_shared_from_this<AppStateEventQueue> {
+public:
+    explicit AppStateEventQueue(const std::shared_ptr<AppExecFwk::EventHandler>& handler);
+
+    void Enqueue(AppStateEvent&& event);
+
+private:
+    void PostDrainTask();
+    void DrainEvents();
+    void HandleEvent(const AppStateEvent& event);
+    // take all running processes in the enqueuing thread, at most one thread tries at a time
+    void TrySeedLiveProcesses();
+    void ApplySeed();
+    bool IsAppAlive(const AppStateEvent& event);
+    static int64_t GetNowMs();
+
+private:
+    std::shared_ptr<AppExecFwk::EventHandler> handler_ {};
+    MpscQueue<AppStateEvent> events_ {};
+    std::atomic<bool> isDrainPosted_ {false};
+    // set once the seed is queued, events enqueued after it are handled with live processes seeded
+    std::atomic<bool> isSeedTaken_ {false};
+    std::atomic<bool> isSeeding_ {false};
+    std::atomic<int64_t> nextSeedTimeMs_ {0};
+    // accessed by the thread holding isSeeding_ only
+    int64_t seedRetryDelayMs_ {0};
+    std::mutex seedMutex_ {};
+    std::unordered_map<std::string, std::unordered_set<int32_t>> seed_ {};
+    // following members are only accessed in the handler thread
+    std::unordered_map<std::string, std::unordered_set<int32_t>> livePids_ {};
+    // pids died before the seed is applied, which the seed may still contain
+    std::unordered_set<int32_t> diedPids_ {};
+    bool isLivePidsSeeded_ {false};
+};
+
 class AppStateObserver : public AppExecFwk::ApplicationStateObserverStub {
 public:
 
@@ -71,11 +137,9 @@ public:
      * @param pageStateData Page Process data.
      */
     void OnPageHide(const AppExecFwk::PageStateData &pageStateData) override;
-private:
-    bool CheckAlivedApp(const std::string &bundleName);
-
 private:
     std::shared_ptr<AppExecFwk::EventHandler> handler_ {};
+    std::shared_ptr<AppStateEventQueue> eventQueue_ {};
 };
 }  // namespace BackgroundTaskMgr
 }  // namespace OHOS
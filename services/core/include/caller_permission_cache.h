@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_CALLER_PERMISSION_CACHE_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_CALLER_PERMISSION_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace OHOS {
+namespace DevStandbyMgr {
+/**
+ * @brief caches whether the caller token is granted the exemption permission, saving the ipc of access token.
+ *
+ * The cache is direct mapped by token id, a token evicts the one sharing its slot. Lookups are lock free and do not
+ * allocate. The cache is cleared when apps are installed, updated or removed, and an entry expires ENTRY_TTL_SEC
+ * after it is put, which bounds how long a permission revoked at runtime is still honored.
+ */
+class CallerPermissionCache {
+public:
+    static constexpr uint32_t SLOT_NUM = 64;
+    static constexpr uint32_t ENTRY_TTL_SEC = 10;
+
+    bool Get(uint32_t tokenId, bool& isGranted) const;
+    void Put(uint32_t tokenId, bool isGranted);
+    void Clear();
+
+private:
+    // steady time in seconds, truncated to the bits of the put time stored in a slot
+    static uint32_t GetNowSec();
+
+private:
+    std::array<std::atomic<uint64_t>, SLOT_NUM> slots_ {};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_CALLER_PERMISSION_CACHE_H
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_CLONE_STREAM_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_CLONE_STREAM_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "errors.h"
+#include "nocopyable.h"
+#include "unique_fd.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+constexpr uint32_t CLONE_MODULE_NAME_LEN = 32;
+
+// head of a module in the clone file, followed by fileSize bytes of module data and then the next head
+struct CloneFileHead {
+    char moduleName[CLONE_MODULE_NAME_LEN];
+    // offset of this head from the start of the clone file
+    uint32_t fileOffset;
+    uint32_t fileSize;
+    uint8_t data[0];
+};
+
+/**
+ * @brief appends the backup data of one module straight to the clone fd.
+ */
+class CloneSectionWriter {
+public:
+    DISALLOW_COPY_AND_MOVE(CloneSectionWriter);
+
+    explicit CloneSectionWriter(int32_t fd) : fd_(fd) {}
+
+    bool Write(const void* data, size_t size);
+
+    uint64_t GetSize() const
+    {
+        return size_;
+    }
+
+private:
+    int32_t fd_ {-1};
+    uint64_t size_ {0};
+};
+
+// the backup callback writes the module state incrementally, the section is dropped if it fails
+using CloneBackupFunc = std::function<ErrCode(CloneSectionWriter&)>;
+// the restore callback gets a view of the module section, which is only valid during the call
+using CloneRestoreFunc = std::function<ErrCode(std::string_view)>;
+
+/**
+ * @brief builds a clone file in a memfd, the head of each module is filled in once its data is written.
+ */
+class CloneStreamWriter {
+public:
+    DISALLOW_COPY_AND_MOVE(CloneStreamWriter);
+
+    CloneStreamWriter() = default;
+
+    /**
+     * @brief create the memfd which the module sections are appended to.
+     */
+    bool Open();
+
+    /**
+     * @brief append the head and data of a module, both are rolled back if the callback fails.
+     */
+    ErrCode WriteModule(const std::string& moduleName, const CloneBackupFunc& func);
+
+    /**
+     * @brief seal the memfd and rewind it for the reader.
+     *
+     * @return the sealed fd, invalid if no module is written or writing failed
+     */
+    UniqueFd Finish();
+
+private:
+    UniqueFd fd_ {-1};
+    uint64_t offset_ {0};
+    uint32_t moduleNum_ {0};
+};
+
+/**
+ * @brief maps a clone file and visits its module sections without copying them.
+ *
+ * The clone file is a chain of CloneFileHead each followed by its data. An fd which can not be mapped, such as a
+ * pipe, is read into memory instead.
+ */
+class CloneStreamReader {
+public:
+    DISALLOW_COPY_AND_MOVE(CloneStreamReader);
+
+    CloneStreamReader() = default;
+    ~CloneStreamReader();
+
+    bool Open(int32_t fd);
+
+    void ForEachSection(const std::function<void(const std::string&, std::string_view)>& func) const;
+
+private:
+    const char* data_ {nullptr};
+    size_t size_ {0};
+    bool isMapped_ {false};
+    std::vector<char> buffer_ {};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_CLONE_STREAM_H
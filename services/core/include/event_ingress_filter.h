@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_EVENT_INGRESS_FILTER_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_EVENT_INGRESS_FILTER_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace DevStandbyMgr {
+enum class IngressPolicy : uint8_t {
+    // state critical events, always delivered at once
+    PASS_THROUGH = 0,
+    // a report identical to the last delivered one of the same key is dropped within the dedup window
+    DEDUPLICATE,
+    // the first report of a key is delivered at once, later ones within the coalesce window are folded into the
+    // last one which is delivered when the window ends, unless it equals the delivered one
+    COALESCE,
+};
+
+enum class IngressDecision : uint8_t {
+    PASS = 0,
+    SUPPRESS,
+    DEFER,
+};
+
+struct IngressEvent {
+    uint32_t resType_ {0};
+    int64_t value_ {0};
+    std::string sceneInfo_ {""};
+};
+
+/**
+ * @brief drops or folds high frequency resource schedule events before they are dispatched to plugins.
+ *
+ * Reports are keyed by resType and the uid or the connection carried in sceneInfo, two reports are the same if
+ * both value and sceneInfo are equal. Deferred events are handed back by TakeDueEvents, the caller posts the flush
+ * whenever Filter or TakeDueEvents returns a positive flush delay.
+ */
+class EventIngressFilter {
+public:
+    static constexpr int64_t DEFAULT_COALESCE_WINDOW_MS = 100;
+    static constexpr int64_t DEFAULT_DEDUP_WINDOW_MS = 1000;
+
+    // drop the pending events and the history of keys, window not greater than 0 means the default one
+    void Reset(int64_t coalesceWindowMs, int64_t dedupWindowMs);
+
+    IngressDecision Filter(uint32_t resType, int64_t value, const std::string& sceneInfo, int64_t nowMs,
+        int64_t& flushDelayMs);
+
+    /**
+     * @brief take the deferred events whose window has ended.
+     *
+     * @param flushDelayMs the delay of the next flush, 0 if no event is left pending.
+     */
+    std::vector<IngressEvent> TakeDueEvents(int64_t nowMs, int64_t& flushDelayMs);
+
+    static IngressPolicy GetPolicy(uint32_t resType);
+
+    void ShellDump(std::string& result);
+
+private:
+    struct KeySlot {
+        IngressPolicy policy_ {IngressPolicy::PASS_THROUGH};
+        uint64_t lastFingerprint_ {0};
+        int64_t lastDeliverTime_ {0};
+        int64_t windowEnd_ {0};
+        bool hasPending_ {false};
+        uint64_t pendingFingerprint_ {0};
+        IngressEvent pendingEvent_ {};
+    };
+
+    struct IngressStat {
+        uint64_t passedCount_ {0};
+        uint64_t suppressedCount_ {0};
+        uint64_t coalescedCount_ {0};
+    };
+
+    using SlotKey = std::pair<uint32_t, uint64_t>;
+
+    IngressDecision FilterLocked(KeySlot& slot, uint32_t resType, int64_t value, const std::string& sceneInfo,
+        uint64_t fingerprint, int64_t nowMs, int64_t& flushDelayMs);
+    // erase slots without pending event whose window has ended, called when too many keys are kept
+    void EvictIdleSlotsLocked(int64_t nowMs);
+    static uint64_t GetKey(uint32_t resType, int64_t value, const std::string& sceneInfo);
+    static uint64_t GetFingerprint(int64_t value, const std::string& sceneInfo);
+
+private:
+    std::mutex filterMutex_ {};
+    int64_t coalesceWindowMs_ {DEFAULT_COALESCE_WINDOW_MS};
+    int64_t dedupWindowMs_ {DEFAULT_DEDUP_WINDOW_MS};
+    std::map<SlotKey, KeySlot> slots_ {};
+    bool isFlushPosted_ {false};
+    std::map<uint32_t, IngressStat> stats_ {};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_EVENT_INGRESS_FILTER_H
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_MPSC_QUEUE_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_MPSC_QUEUE_H
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+/**
+ * @brief unbounded lock-free queue with multiple producers and a single consumer.
+ *
+ * Push is wait-free and can be called from any thread, Pop must only be called from the consumer thread. An element
+ * being pushed becomes visible to Pop once its producer has linked it, Pop may return false in the meantime.
+ */
+template<typename T>
+class MpscQueue {
+public:
+    DISALLOW_COPY_AND_MOVE(MpscQueue);
+
+    MpscQueue() : head_(&stub_), tail_(&stub_) {}
+
+    ~MpscQueue()
+    {
+        T value;
+        while (Pop(value)) {}
+        if (tail_ != &stub_) {
+            delete tail_;
+        }
+    }
+
+    bool Push(T value)
+    {
+        Node* node = new (std::nothrow) Node();
+        if (node == nullptr) {
+            return false;
+        }
+        node->value_ = std::move(value);
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next_.store(node, std::memory_order_release);
+        return true;
+    }
+
+    bool Pop(T& value)
+    {
+        Node* tail = tail_;
+        Node* next = tail->next_.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        value = std::move(next->value_);
+        tail_ = next;
+        if (tail != &stub_) {
+            delete tail;
+        }
+        return true;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next_ {nullptr};
+        T value_ {};
+    };
+
+    Node stub_ {};
+    std::atomic<Node*> head_;
+    // only accessed by the consumer
+    Node* tail_;
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_MPSC_QUEUE_H
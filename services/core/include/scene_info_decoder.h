@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_SCENE_INFO_DECODER_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_SCENE_INFO_DECODER_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace OHOS {
+namespace DevStandbyMgr {
+constexpr uint32_t MAX_SCENE_FIELD_NUM = 4;
+
+enum class SceneFieldType : uint8_t {
+    // json string
+    STRING = 0,
+    // json string holding a decimal integer, converted like atoi
+    INT_STRING,
+    // json integer, or json string holding a decimal integer
+    INT,
+    // json integer which is not negative
+    UINT,
+};
+
+struct SceneFieldSpec {
+    std::string_view key_ {};
+    SceneFieldType type_ {SceneFieldType::STRING};
+    bool isRequired_ {true};
+};
+
+// fields extracted from the sceneInfo of a resType, the index of a field is its index in fields_
+struct SceneInfoSchema {
+    std::array<SceneFieldSpec, MAX_SCENE_FIELD_NUM> fields_ {};
+    uint32_t fieldNum_ {0};
+};
+
+struct SceneFieldValue {
+    bool isPresent_ {false};
+    // raw content between the quotes, only valid while the decoded sceneInfo is alive
+    std::string_view str_ {};
+    bool isEscaped_ {false};
+    int64_t num_ {0};
+
+    // copy of the string with escape sequences resolved
+    std::string ToString() const;
+};
+
+using SceneInfoFields = std::array<SceneFieldValue, MAX_SCENE_FIELD_NUM>;
+
+enum class SceneDecodeResult : uint8_t {
+    OK = 0,
+    MALFORMED,
+    FIELD_MISSING,
+    FIELD_INVALID,
+};
+
+namespace SceneInfoSchemas {
+// RES_TYPE_CALL_STATE_CHANGED
+enum CallStateField : uint32_t { CALL_STATE = 0 };
+constexpr SceneInfoSchema CALL_STATE_CHANGED {{{{"state", SceneFieldType::INT}}}, 1};
+
+// RES_TYPE_BT_SERVICE_EVENT of GATT_APP_REGISTER
+enum GattAppRegisterField : uint32_t { REGISTER_ACTION = 0, REGISTER_UID, REGISTER_SIDE, REGISTER_APPID };
+constexpr SceneInfoSchema GATT_APP_REGISTER {{{
+    {"ACTION", SceneFieldType::STRING}, {"UID", SceneFieldType::INT_STRING},
+    {"SIDE", SceneFieldType::STRING}, {"APPID", SceneFieldType::INT_STRING}}}, 4};
+
+// RES_TYPE_BT_SERVICE_EVENT of GATT_CONNECT_STATE
+enum GattConnectStateField : uint32_t { CONNECT_STATE = 0, CONNECT_ROLE, CONNECT_IF };
+constexpr SceneInfoSchema GATT_CONNECT_STATE {{{
+    {"STATE", SceneFieldType::INT_STRING}, {"ROLE", SceneFieldType::STRING},
+    {"CONNECTIF", SceneFieldType::INT_STRING}}}, 3};
+
+// RES_TYPE_REPORT_BOKER_GATT_CONNECT, pkg is only reported on connection
+enum BrokerGattField : uint32_t { BROKER_CLIENT_IF = 0, BROKER_PKG };
+constexpr SceneInfoSchema BROKER_GATT_CONNECT {{{
+    {"clientIf", SceneFieldType::INT_STRING}, {"pkg", SceneFieldType::STRING}}}, 2};
+constexpr SceneInfoSchema BROKER_GATT_DISCONNECT {{{{"clientIf", SceneFieldType::INT_STRING}}}, 1};
+
+// RES_TYPE_EFFICIENCY_RESOURCES_STATE_CHANGED
+enum EfficiencyResourcesField : uint32_t { RESOURCES_BUNDLE_NAME = 0, RESOURCES_NUMBER };
+constexpr SceneInfoSchema EFFICIENCY_RESOURCES_STATE_CHANGED {{{
+    {"bundleName", SceneFieldType::STRING}, {"resourceNumber", SceneFieldType::UINT}}}, 2};
+
+// RES_TYPE_INNER_AUDIO_STATE and RES_TYPE_AUDIO_CAPTURE_STATUS_CHANGED
+enum AudioStateField : uint32_t { AUDIO_UID = 0 };
+constexpr SceneInfoSchema AUDIO_STATE_CHANGED {{{{"uid", SceneFieldType::STRING}}}, 1};
+
+// RES_TYPE_APP_INSTALL_UNINSTALL
+enum AppInstallField : uint32_t { INSTALL_BUNDLE_NAME = 0, INSTALL_UID };
+constexpr SceneInfoSchema APP_INSTALL_UNINSTALL {{{
+    {"bundleName", SceneFieldType::STRING}, {"uid", SceneFieldType::INT}}}, 2};
+}  // namespace SceneInfoSchemas
+
+/**
+ * @brief extract the fields of a schema from sceneInfo in a single pass without building a json document.
+ *
+ * The whole sceneInfo is validated as a json object, keys not in the schema are skipped. When a key repeats the
+ * last value wins, keys are compared without resolving escape sequences.
+ */
+class SceneInfoDecoder {
+public:
+    static SceneDecodeResult Decode(std::string_view sceneInfo, const SceneInfoSchema& schema,
+        SceneInfoFields& fields);
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_SCENE_INFO_DECODER_H
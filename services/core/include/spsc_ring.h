@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_SPSC_RING_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_SPSC_RING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+/**
+ * @brief bounded lock-free ring with a single producer and a single consumer.
+ *
+ * Push must only be called from the producer thread, PopBatch and Clear from the consumer thread. Neither blocks,
+ * Push fails if the ring is full.
+ */
+template<typename T, size_t CAPACITY>
+class SpscRing {
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "capacity must be a power of two");
+
+public:
+    DISALLOW_COPY_AND_MOVE(SpscRing);
+    SpscRing() = default;
+
+    bool Push(const T& value)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) >= CAPACITY) {
+            return false;
+        }
+        buffer_[head & (CAPACITY - 1)] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // pop at most maxCount elements into values, return the number of elements popped
+    size_t PopBatch(T* values, size_t maxCount)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t count = head_.load(std::memory_order_acquire) - tail;
+        count = count < maxCount ? count : maxCount;
+        for (size_t index = 0; index < count; ++index) {
+            values[index] = buffer_[(tail + index) & (CAPACITY - 1)];
+        }
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    void Clear()
+    {
+        tail_.store(head_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // producer and consumer indexes live on their own cache lines so that they do not bounce between cores
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_ {0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_ {0};
+    alignas(CACHE_LINE_SIZE) std::array<T, CAPACITY> buffer_ {};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_SPSC_RING_H
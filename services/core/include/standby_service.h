@@ -53,9 +53,12 @@ public:
     ErrCode UnsubscribeStandbyCallback(const sptr<IStandbyServiceSubscriber>& subscriber) override;
     ErrCode ApplyAllowResource(const ResourceRequest& resourceRequest) override;
     ErrCode UnapplyAllowResource(const ResourceRequest& resourceRequest) override;
+    ErrCode ApplyAllowResourceBatch(const std::vector<ResourceRequest>& resourceRequests) override;
+    ErrCode UnapplyAllowResourceBatch(const std::vector<ResourceRequest>& resourceRequests) override;
     ErrCode GetAllowList(uint32_t allowType, std::vector<AllowInfo>& allowInfoList,
         uint32_t reasonCode) override;
     ErrCode IsDeviceInStandby(bool& isStandby) override;
+    ErrCode GetStandbyStatePage(int& fd) override;
     ErrCode SetNatInterval(uint32_t type, bool enable, uint32_t interval) override;
     ErrCode DelayHeartBeat(int64_t timestamp) override;
     ErrCode ReportSceneInfo(uint32_t resType, int64_t value, const std::string &sceneInfo) override;
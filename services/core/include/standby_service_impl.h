@@ -31,14 +31,21 @@
 #include <vector>
 
 #include "accesstoken_kit.h"
+#include "allow_expiry_index.h"
 #include "allow_info.h"
+#include "allow_list_change_aggregator.h"
 #include "allow_record.h"
+#include "allow_record_index.h"
+#include "allow_record_journal.h"
 #include "app_mgr_client.h"
 #include "app_mgr_helper.h"
 #include "app_state_observer.h"
+#include "caller_permission_cache.h"
+#include "clone_stream.h"
 #include "common_event_observer.h"
 #include "event_runner.h"
 #include "event_handler.h"
+#include "event_ingress_filter.h"
 #include "iconstraint_manager_adapter.h"
 #include "ilistener_manager_adapter.h"
 #include "ipc_skeleton.h"
@@ -50,6 +57,9 @@
 #include "res_type.h"
 #include "singleton.h"
 #include "standby_state_subscriber.h"
+#include "standby_state_page.h"
+#include "standby_state_snapshot.h"
+#include "task_lane_scheduler.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
@@ -76,13 +86,6 @@ enum P2pState {
     P2P_STATE_CLOSED,
 };
 
-struct CloneFileHead {
-    char moduleName[32];
-    uint32_t fileOffset;
-    uint32_t fileSize;
-    uint8_t data[0];
-};
-
 class StandbyServiceImpl : public std::enable_shared_from_this<StandbyServiceImpl> {
 DECLARE_DELAYED_SINGLETON(StandbyServiceImpl);
 public:
@@ -104,6 +107,11 @@ public:
     ErrCode SubscribeBackupRestoreCallback(const std::string& moduleName,
         const std::function<ErrCode(std::vector<char>&)>& onBackupFunc,
         const std::function<ErrCode(std::vector<char>&)>& onRestoreFunc);
+    /**
+     * @brief subscribe callbacks which write the backup data incrementally and restore it from a view.
+     */
+    ErrCode SubscribeStreamBackupRestoreCallback(const std::string& moduleName, const CloneBackupFunc& onBackupFunc,
+        const CloneRestoreFunc& onRestoreFunc);
     ErrCode UnsubscribeBackupRestoreCallback(const std::string& moduleName);
     ErrCode OnBackup(MessageParcel& data, MessageParcel& reply);
     ErrCode OnRestore(MessageParcel& data, MessageParcel& reply);
@@ -112,11 +120,14 @@ public:
     ErrCode UnsubscribeStandbyCallback(const sptr<IStandbyServiceSubscriber>& subscriber);
     ErrCode ApplyAllowResource(ResourceRequest& resourceRequest);
     ErrCode UnapplyAllowResource(ResourceRequest& resourceRequest);
+    ErrCode ApplyAllowResourceBatch(std::vector<ResourceRequest>& resourceRequests);
+    ErrCode UnapplyAllowResourceBatch(std::vector<ResourceRequest>& resourceRequests);
     ErrCode GetAllowList(uint32_t allowType, std::vector<AllowInfo>& allowInfoList,
         uint32_t reasonCode);
     ErrCode GetEligiableRestrictSet(uint32_t allowType, const std::string& strategyName,
         uint32_t resonCode, std::set<std::string>& restrictSet);
     ErrCode IsDeviceInStandby(bool& isStandby);
+    ErrCode GetStandbyStatePage(int32_t& fd);
     ErrCode ReportWorkSchedulerStatus(bool started, int32_t uid, const std::string& bundleName);
     ErrCode GetRestrictList(uint32_t restrictType, std::vector<AllowInfo>& restrictInfoList,
         uint32_t reasonCode);
@@ -124,6 +135,9 @@ public:
     ErrCode ReportDeviceStateChanged(int32_t type, bool enabled);
     ErrCode HandleCommonEvent(const uint32_t resType, const int64_t value, const std::string &sceneInfo);
     void SubHandleCommonEvent(const uint32_t resType, const int64_t value, const std::string &sceneInfo);
+    // deliver the event which passed the ingress filter to its handler
+    void DeliverCommonEvent(const uint32_t resType, const int64_t value, const std::string &sceneInfo);
+    void FlushIngressEvents();
     ErrCode ReportPowerOverused(const std::string &module, uint32_t level);
     ErrCode ReportSceneInfo(uint32_t resType, int64_t value, const std::string &sceneInfo);
     ErrCode HeartBeatValueChanged(const std::string &tag, int32_t timesTamp);
@@ -134,6 +148,19 @@ public:
         IStateManagerAdapter* stateManager);
 
     std::shared_ptr<AppExecFwk::EventHandler>& GetHandler();
+    /**
+     * @brief post the task to a lane of the handler, tasks of higher priority lanes are dispatched first.
+     *
+     * @param name name of the task, used to cancel it by RemoveLaneTask.
+     * @param delayMs the task joins its lane after delay.
+     */
+    bool PostLaneTask(TaskLane lane, const std::function<void()>& task, const std::string& name = "",
+        int64_t delayMs = 0);
+    /**
+     * @brief post the task to a lane of the handler and block until it has run, must not be invoked in the handler.
+     */
+    bool PostLaneSyncTask(TaskLane lane, const std::function<void()>& task);
+    void RemoveLaneTask(const std::string& name);
     std::shared_ptr<IConstraintManagerAdapter>& GetConstraintManager();
     std::shared_ptr<IListenerManagerAdapter>& GetListenerManager();
     std::shared_ptr<IStrategyManagerAdapter>& GetStrategyManager();
@@ -145,12 +172,16 @@ public:
     void ShellDumpInner(const std::vector<std::string>& argsInStr, std::string& result);
     void GetAllowListInner(uint32_t allowType, std::vector<AllowInfo>& allowInfoList,
         uint32_t reasonCode);
-    void DispatchEvent(const StandbyMessage& message);
+    void DispatchEvent(StandbyMessage message);
     bool IsDebugMode();
     bool IsServiceReady();
     void UpdateSaDependValue(const bool& isAdd, const uint32_t& saId);
     uint32_t GetSaDependValue();
 
+    // publish the state for queries from ipc threads, invoked by the state manager when state or phase transits
+    void PublishStandbyState(uint32_t state, uint32_t phase);
+
+    // must be invoked in a task of the critical lane, the message is delivered without posting it again
     void OnProcessStatusChanged(int32_t uid, int32_t pid, const std::string& bundleName, bool isCreated);
 private:
     StandbyServiceImpl(const StandbyServiceImpl&) = delete;
@@ -158,20 +189,51 @@ private:
     StandbyServiceImpl(StandbyServiceImpl&&) = delete;
     StandbyServiceImpl& operator= (StandbyServiceImpl&&) = delete;
     void ApplyAllowResInner(const ResourceRequest& resourceRequest, int32_t pid);
-    void UpdateRecord(std::shared_ptr<AllowRecord>& allowRecord, const ResourceRequest& resourceRequest);
+    void DispatchEventInHandler(StandbyMessage&& message);
+    void DispatchEventInner(StandbyMessage&& message);
+    /**
+     * @brief update the allow record with allowRecordMutex_ held, notification and persistence are left to caller.
+     *
+     * @return allow types newly added to the record
+     */
+    uint32_t ApplyAllowRecordLocked(const ResourceRequest& resourceRequest, int32_t pid);
+    void UpdateRecord(AllowRecord& allowRecord, const ResourceRequest& resourceRequest);
     void UnapplyAllowResInner(int32_t uid, const std::string& name, uint32_t allowType,  bool removeAll);
+    void UnapplyAllowResBatchInner(const std::map<std::pair<int32_t, std::string>, uint32_t>& unapplyAllowTypes,
+        bool removeAll);
+    /**
+     * @brief remove allow types from the record with allowRecordMutex_ held.
+     *
+     * @return allow types removed from the record
+     */
+    uint32_t UnapplyAllowRecordLocked(int32_t uid, const std::string& name, uint32_t allowType, bool removeAll);
+    ErrCode CheckBatchResourceRequest(std::vector<ResourceRequest>& resourceRequests, bool isApply);
+    /**
+     * @brief queue a change of allow list with allowRecordMutex_ held, changes within the notify window are
+     * reported to subscribers and strategies together.
+     */
+    void QueueAllowListChange(int32_t uid, const std::string& name, uint32_t allowType, bool added);
+    void FlushAllowListChanges();
     void GetTemporaryAllowList(uint32_t allowTypeIndex, std::vector<AllowInfo>& allowInfoList,
         uint32_t reasonCode);
     void GetPersistAllowList(uint32_t allowTypeIndex, std::vector<AllowInfo>& allowInfoList, bool isAllow, bool isApp);
     void GetRestrictListInner(uint32_t restrictType, std::vector<AllowInfo>& restrictInfoList,
         uint32_t reasonCode);
-    void NotifyAllowListChanged(int32_t uid, const std::string& name, uint32_t allowType, bool added);
+    void NotifyAllowListChanged(const std::vector<AllowListChange>& changes);
     std::string BuildBackupReplyCode(int32_t replyCode);
 
     void RecoverTimeLimitedTask();
+    void ArmExpiryTimer();
+    void HandleExpiredRecords();
     bool ParsePersistentData();
     void GetPidAndProcName(std::unordered_map<int32_t, std::string>& pidNameMap);
     void DumpPersistantData();
+    void SchedulePersistTask();
+    void FlushPersistantData();
+    // write the published state and the current day and night condition to the state page
+    void WriteStatePage();
+    // withdraw the record of the state page, clients fall back to ipc until the next write
+    void UnpublishStatePage();
     uint32_t dependsReady_ = 0;
 
     ErrCode CheckCallerPermission(uint32_t reasonCode = ReasonCodeEnum::REASON_APP_API);
@@ -179,6 +241,8 @@ private:
     ErrCode CheckNativePermission(Security::AccessToken::AccessTokenID tokenId);
     bool CheckAllowTypeInfo(uint32_t allowType);
     uint32_t GetExemptedResourceType(uint32_t resourceType);
+    // allow types the calling hap may be exempted from, all bits set if it applies for all resources
+    uint32_t GetExemptedResourceMask();
     std::vector<int32_t> QueryRunningResourcesApply(const int32_t uid, const std::string& bundleName);
     int32_t GetUserIdByUid(int32_t uid);
 
@@ -225,6 +289,11 @@ private:
     std::atomic<bool> isServiceReady_ {false};
     sptr<AppStateObserver> appStateObserver_ = nullptr;
     std::shared_ptr<AppExecFwk::EventHandler> handler_ {nullptr};
+    std::shared_ptr<TaskLaneScheduler> taskLaneScheduler_ {std::make_shared<TaskLaneScheduler>()};
+    StandbyStateSnapshot standbyStateSnapshot_ {};
+    std::mutex statePageMutex_ {};
+    std::shared_ptr<StandbyStatePage> statePage_ {nullptr};
+    CallerPermissionCache callerPermissionCache_ {};
     std::mutex appStateObserverMutex_ {};
     std::mutex eventObserverMutex_ {};
     std::recursive_mutex timerObserverMutex_ {};
@@ -232,12 +301,24 @@ private:
     std::mutex backupRestoreMutex_ {};
     std::map<std::string, std::function<ErrCode(std::vector<char>&)>> onBackupFuncMap_ {};
     std::map<std::string, std::function<ErrCode(std::vector<char>&)>> onRestoreFuncMap_ {};
+    std::map<std::string, CloneBackupFunc> onStreamBackupFuncMap_ {};
+    std::map<std::string, CloneRestoreFunc> onStreamRestoreFuncMap_ {};
     std::unique_ptr<AppExecFwk::AppMgrClient> appMgrClient_ {nullptr};
     std::shared_ptr<CommonEventObserver> commonEventObserver_ {nullptr};
     uint64_t dayNightSwitchTimerId_ {0};
-    std::unordered_map<std::string, std::shared_ptr<AllowRecord>> allowInfoMap_ {};
+    AllowRecordIndex allowRecordIndex_ {};
+    std::shared_ptr<AllowRecordJournal> allowRecordJournal_ {nullptr};
+    std::atomic<bool> persistTaskPosted_ {false};
+    AllowExpiryIndex allowExpiryIndex_ {};
+    int64_t armedExpiryDeadline_ {AllowExpiryIndex::NO_DEADLINE};
+    AllowListChangeAggregator allowListChangeAggregator_ {};
+    bool allowListNotifyPosted_ {false};
+    EventIngressFilter ingressFilter_ {};
     bool ready_ = false;
     void* registerPlugin_ {nullptr};
+    // accessed on handler_ only
+    uint64_t dispatchedMessageCount_ {0};
+    uint64_t skippedDeliveryCount_ {0};
     std::shared_ptr<IConstraintManagerAdapter> constraintManager_ {nullptr};
     std::shared_ptr<IListenerManagerAdapter> listenerManager_ {nullptr};
     std::shared_ptr<IStrategyManagerAdapter> strategyManager_ {nullptr};
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_STANDBY_STATE_SNAPSHOT_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_STANDBY_STATE_SNAPSHOT_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace OHOS {
+namespace DevStandbyMgr {
+/**
+ * @brief state and phase published by the state manager on transition.
+ *
+ * State and phase are packed in one word, so readers on ipc threads never see a torn pair and do not hop to the
+ * handler thread.
+ */
+class StandbyStateSnapshot {
+public:
+    void Publish(uint32_t state, uint32_t phase)
+    {
+        snapshot_.store((static_cast<uint64_t>(state) << STATE_SHIFT) | phase, std::memory_order_release);
+    }
+
+    /**
+     * @brief load the published state and phase.
+     *
+     * @return false if nothing is published, e.g. a state manager plugin which does not publish its state.
+     */
+    bool Load(uint32_t& state, uint32_t& phase) const
+    {
+        uint64_t snapshot = snapshot_.load(std::memory_order_acquire);
+        if (snapshot == NOT_PUBLISHED) {
+            return false;
+        }
+        state = static_cast<uint32_t>(snapshot >> STATE_SHIFT);
+        phase = static_cast<uint32_t>(snapshot);
+        return true;
+    }
+
+    void Reset()
+    {
+        snapshot_.store(NOT_PUBLISHED, std::memory_order_release);
+    }
+
+private:
+    static constexpr uint32_t STATE_SHIFT = 32;
+    static constexpr uint64_t NOT_PUBLISHED = UINT64_MAX;
+    std::atomic<uint64_t> snapshot_ {NOT_PUBLISHED};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_STANDBY_STATE_SNAPSHOT_H
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_TASK_LANE_SCHEDULER_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_TASK_LANE_SCHEDULER_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "event_handler.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+// lanes of the service handler, from the highest priority to the lowest
+enum class TaskLane : uint32_t {
+    // state transitions and state machine input of standby messages, handled in the order they are dispatched
+    CRITICAL = 0,
+    // synchronous queries waited by callers
+    QUERY,
+    // strategy fan-out of standby messages in dispatch order, strategy recomputations and allow record maintenance
+    STRATEGY,
+    // persistence and other work nobody waits for
+    BACKGROUND,
+    LANE_NUM,
+};
+
+/**
+ * @brief dispatches tasks of the service handler by lane priority.
+ *
+ * Every queued task posts one pump event to the handler, the pump runs the task of the highest priority lane rather
+ * than the task which posted it. A lane whose oldest task has waited longer than the aging bound of the lane is
+ * picked before lanes of higher priority except the critical one, so lower lanes are never starved.
+ * Tasks already running are not preempted, lanes only bound the time a task waits in the queue.
+ */
+class TaskLaneScheduler : public std::enable_shared_from_this<TaskLaneScheduler> {
+public:
+    static constexpr uint32_t LANE_NUM = static_cast<uint32_t>(TaskLane::LANE_NUM);
+    static constexpr uint32_t WAIT_BUCKET_NUM = 7;
+    static constexpr uint32_t DEPTH_BUCKET_NUM = 5;
+
+    bool PostTask(const std::shared_ptr<AppExecFwk::EventHandler>& handler, TaskLane lane,
+        const std::function<void()>& task, const std::string& name = "", int64_t delayMs = 0);
+
+    /**
+     * @brief queue the task and block until it has run, tasks of higher priority may run before it.
+     */
+    bool PostSyncTask(const std::shared_ptr<AppExecFwk::EventHandler>& handler, TaskLane lane,
+        const std::function<void()>& task);
+
+    // cancel the delayed task of name as well as the queued one
+    void RemoveTask(const std::shared_ptr<AppExecFwk::EventHandler>& handler, const std::string& name);
+
+    /**
+     * @brief run the next task picked by priority and aging.
+     *
+     * @return false if all lanes are empty.
+     */
+    bool RunNextTask();
+
+    void ShellDump(std::string& result);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct LaneTask {
+        std::function<void()> task_ {};
+        std::string name_ {};
+        Clock::time_point enqueueTime_ {};
+    };
+
+    struct LaneStat {
+        uint64_t postedCount_ {0};
+        uint64_t runCount_ {0};
+        uint64_t agedCount_ {0};
+        uint64_t maxWaitUs_ {0};
+        uint32_t maxDepth_ {0};
+        std::array<uint64_t, WAIT_BUCKET_NUM> waitBuckets_ {};
+        std::array<uint64_t, DEPTH_BUCKET_NUM> depthBuckets_ {};
+    };
+
+    bool Enqueue(const std::shared_ptr<AppExecFwk::EventHandler>& handler, TaskLane lane,
+        const std::function<void()>& task, const std::string& name);
+    void PushLocked(uint32_t laneIndex, LaneTask laneTask);
+    // pick the lane to run with laneMutex_ held, return LANE_NUM if all lanes are empty
+    uint32_t PickLaneLocked(Clock::time_point now);
+    static AppExecFwk::EventQueue::Priority GetPumpPriority(TaskLane lane);
+    static uint32_t GetWaitBucket(uint64_t waitUs);
+    static uint32_t GetDepthBucket(uint32_t depth);
+
+private:
+    std::mutex laneMutex_ {};
+    std::array<std::deque<LaneTask>, LANE_NUM> lanes_ {};
+    std::array<LaneStat, LANE_NUM> laneStats_ {};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_CORE_INCLUDE_TASK_LANE_SCHEDULER_H
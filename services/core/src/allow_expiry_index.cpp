@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "allow_expiry_index.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+void AllowExpiryIndex::Update(int32_t uid, const std::string& name, uint32_t allowTypeIndex, int64_t endTime)
+{
+    EntryKey entryKey {uid, name, allowTypeIndex};
+    auto iter = endTimes_.find(entryKey);
+    if (iter != endTimes_.end()) {
+        if (iter->second == endTime) {
+            return;
+        }
+        deadlines_.erase(DeadlineKey {iter->second, uid, name, allowTypeIndex});
+        iter->second = endTime;
+    } else {
+        endTimes_.emplace(std::move(entryKey), endTime);
+    }
+    deadlines_.emplace(endTime, uid, name, allowTypeIndex);
+}
+
+void AllowExpiryIndex::Remove(int32_t uid, const std::string& name, uint32_t allowTypeIndex)
+{
+    auto iter = endTimes_.find(EntryKey {uid, name, allowTypeIndex});
+    if (iter == endTimes_.end()) {
+        return;
+    }
+    deadlines_.erase(DeadlineKey {iter->second, uid, name, allowTypeIndex});
+    endTimes_.erase(iter);
+}
+
+int64_t AllowExpiryIndex::GetEarliestDeadline() const
+{
+    if (deadlines_.empty()) {
+        return NO_DEADLINE;
+    }
+    return std::get<0>(*deadlines_.begin());
+}
+
+std::vector<AllowExpiryEntry> AllowExpiryIndex::PopExpired(int64_t curTime)
+{
+    std::vector<AllowExpiryEntry> expiredEntries;
+    auto iter = deadlines_.begin();
+    while (iter != deadlines_.end() && std::get<0>(*iter) <= curTime) {
+        const auto& [endTime, uid, name, allowTypeIndex] = *iter;
+        expiredEntries.emplace_back(AllowExpiryEntry {uid, name, allowTypeIndex, endTime});
+        endTimes_.erase(EntryKey {uid, name, allowTypeIndex});
+        iter = deadlines_.erase(iter);
+    }
+    return expiredEntries;
+}
+
+void AllowExpiryIndex::Clear()
+{
+    deadlines_.clear();
+    endTimes_.clear();
+}
+
+size_t AllowExpiryIndex::Size() const
+{
+    return endTimes_.size();
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
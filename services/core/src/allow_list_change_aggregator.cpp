@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "allow_list_change_aggregator.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+void AllowListChangeAggregator::Add(int32_t uid, const std::string& name, uint32_t allowType, bool added)
+{
+    PendingChange& pendingChange = pendingChanges_[std::make_pair(uid, name)];
+    uint32_t& sameDirection = added ? pendingChange.addedType_ : pendingChange.removedType_;
+    uint32_t& oppositeDirection = added ? pendingChange.removedType_ : pendingChange.addedType_;
+    uint32_t cancelledType = oppositeDirection & allowType;
+    oppositeDirection &= ~cancelledType;
+    sameDirection |= (allowType & ~cancelledType);
+}
+
+std::vector<AllowListChange> AllowListChangeAggregator::Drain()
+{
+    std::vector<AllowListChange> changes;
+    for (const auto& [record, pendingChange] : pendingChanges_) {
+        if (pendingChange.addedType_ != 0) {
+            changes.emplace_back(AllowListChange {record.first, record.second, pendingChange.addedType_, true});
+        }
+        if (pendingChange.removedType_ != 0) {
+            changes.emplace_back(AllowListChange {record.first, record.second, pendingChange.removedType_, false});
+        }
+    }
+    pendingChanges_.clear();
+    return changes;
+}
+
+bool AllowListChangeAggregator::Empty() const
+{
+    return pendingChanges_.empty();
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
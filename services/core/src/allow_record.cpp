@@ -25,13 +25,17 @@ nlohmann::json AllowRecord::ParseToJson()
     value["name"] = name_;
     value["allowType"] = allowType_;
     value["reasonCode"] = reasonCode_;
-    if (!allowTimeList_.empty()) {
+    if (allowTimeMask_ != 0) {
         nlohmann::json allowList;
-        for (const auto &iter : allowTimeList_) {
+        for (uint32_t allowTypeIndex = 0; allowTypeIndex < ALLOW_TIME_SLOT_NUM; ++allowTypeIndex) {
+            if ((allowTimeMask_ & (1U << allowTypeIndex)) == 0) {
+                continue;
+            }
+            const auto& allowTime = allowTimes_[allowTypeIndex];
             nlohmann::json info;
-            info["allowTypeIndex"] = iter.allowTypeIndex_;
-            info["endTime"] = iter.endTime_;
-            info["reason"] = iter.reason_;
+            info["allowTypeIndex"] = allowTime.allowTypeIndex_;
+            info["endTime"] = allowTime.endTime_;
+            info["reason"] = allowTime.reason_;
             allowList.push_back(info);
         }
         value["allowTimeList"] = allowList;
@@ -51,9 +55,7 @@ bool AllowRecord::setAllowTime(const nlohmann::json& persistTime)
     uint32_t allowTypeIndex = persistTime.at("allowTypeIndex").get<uint32_t>();
     int64_t endTime_ = persistTime.at("endTime").get<int64_t>();
     std::string reason_ = persistTime.at("reason").get<std::string>();
-    this->allowTimeList_.emplace_back(AllowTime {allowTypeIndex, endTime_,
-                reason_});
-    return true;
+    return SetAllowTime(AllowTime {allowTypeIndex, endTime_, reason_});
 }
 
 bool AllowRecord::setAllowRecordField(const nlohmann::json& value)
@@ -92,5 +94,41 @@ bool AllowRecord::ParseFromJson(const nlohmann::json& value)
     }
     return true;
 }
+
+AllowTime* AllowRecord::GetAllowTime(uint32_t allowTypeIndex)
+{
+    if (allowTypeIndex >= ALLOW_TIME_SLOT_NUM || (allowTimeMask_ & (1U << allowTypeIndex)) == 0) {
+        return nullptr;
+    }
+    return &allowTimes_[allowTypeIndex];
+}
+
+bool AllowRecord::SetAllowTime(const AllowTime& allowTime)
+{
+    if (allowTime.allowTypeIndex_ >= ALLOW_TIME_SLOT_NUM) {
+        return false;
+    }
+    allowTimes_[allowTime.allowTypeIndex_] = allowTime;
+    allowTimeMask_ |= (1U << allowTime.allowTypeIndex_);
+    return true;
+}
+
+bool AllowRecord::RemoveAllowTime(uint32_t allowTypeIndex)
+{
+    if (GetAllowTime(allowTypeIndex) == nullptr) {
+        return false;
+    }
+    allowTimes_[allowTypeIndex].reason_.clear();
+    allowTimeMask_ &= ~(1U << allowTypeIndex);
+    return true;
+}
+
+void AllowRecord::ClearAllowTime()
+{
+    for (auto& allowTime : allowTimes_) {
+        allowTime.reason_.clear();
+    }
+    allowTimeMask_ = 0;
+}
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
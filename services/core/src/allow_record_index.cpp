@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "allow_record_index.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+    constexpr uint32_t UID_SHIFT = 32;
+    constexpr uint64_t NAME_ID_MASK = 0xFFFFFFFF;
+}
+
+uint32_t AllowRecordIndex::Find(int32_t uid, const std::string& name) const
+{
+    uint32_t nameId = 0;
+    if (!GetNameId(name, nameId)) {
+        return INVALID_SLOT;
+    }
+    auto iter = slotMap_.find(MakeKey(uid, nameId));
+    if (iter == slotMap_.end()) {
+        return INVALID_SLOT;
+    }
+    return iter->second;
+}
+
+std::pair<uint32_t, bool> AllowRecordIndex::Emplace(int32_t uid, int32_t pid, const std::string& name)
+{
+    uint64_t key = MakeKey(uid, InternName(name));
+    auto iter = slotMap_.find(key);
+    if (iter != slotMap_.end()) {
+        return std::make_pair(iter->second, false);
+    }
+    uint32_t slot = AllocSlot(key);
+    slots_[slot].record_ = AllowRecord {uid, pid, name, 0};
+    return std::make_pair(slot, true);
+}
+
+uint32_t AllowRecordIndex::Insert(const AllowRecord& record)
+{
+    uint64_t key = MakeKey(record.uid_, InternName(record.name_));
+    auto iter = slotMap_.find(key);
+    uint32_t slot = (iter == slotMap_.end()) ? AllocSlot(key) : iter->second;
+    slots_[slot].record_ = record;
+    Sync(slot);
+    return slot;
+}
+
+AllowRecord& AllowRecordIndex::Get(uint32_t slot)
+{
+    return slots_[slot].record_;
+}
+
+void AllowRecordIndex::Sync(uint32_t slot)
+{
+    auto& recordSlot = slots_[slot];
+    uint32_t changedMask = recordSlot.postedMask_ ^ recordSlot.record_.allowTimeMask_;
+    for (uint32_t allowTypeIndex = 0; changedMask != 0 && allowTypeIndex < ALLOW_TIME_SLOT_NUM; ++allowTypeIndex) {
+        uint32_t allowNumber = 1U << allowTypeIndex;
+        if ((changedMask & allowNumber) == 0) {
+            continue;
+        }
+        if ((recordSlot.record_.allowTimeMask_ & allowNumber) != 0) {
+            AddPosting(allowTypeIndex, slot);
+        } else {
+            RemovePosting(allowTypeIndex, slot);
+        }
+        changedMask &= ~allowNumber;
+    }
+    recordSlot.postedMask_ = recordSlot.record_.allowTimeMask_;
+}
+
+void AllowRecordIndex::Erase(uint32_t slot)
+{
+    auto& recordSlot = slots_[slot];
+    if (!recordSlot.inUse_) {
+        return;
+    }
+    recordSlot.record_.ClearAllowTime();
+    Sync(slot);
+    slotMap_.erase(recordSlot.key_);
+    ReleaseName(static_cast<uint32_t>(recordSlot.key_ & NAME_ID_MASK));
+    recordSlot.record_ = AllowRecord {};
+    recordSlot.inUse_ = false;
+    freeSlots_.emplace_back(slot);
+}
+
+void AllowRecordIndex::Clear()
+{
+    slots_.clear();
+    freeSlots_.clear();
+    slotMap_.clear();
+    nameIds_.clear();
+    names_.clear();
+    freeNameIds_.clear();
+    for (auto& posting : postings_) {
+        posting.clear();
+    }
+}
+
+size_t AllowRecordIndex::Size() const
+{
+    return slotMap_.size();
+}
+
+bool AllowRecordIndex::Empty() const
+{
+    return slotMap_.empty();
+}
+
+std::string AllowRecordIndex::GetRecordKey(int32_t uid, const std::string& name)
+{
+    return std::to_string(uid) + "_" + name;
+}
+
+uint64_t AllowRecordIndex::MakeKey(int32_t uid, uint32_t nameId)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(uid)) << UID_SHIFT) | nameId;
+}
+
+bool AllowRecordIndex::GetNameId(const std::string& name, uint32_t& nameId) const
+{
+    auto iter = nameIds_.find(name);
+    if (iter == nameIds_.end()) {
+        return false;
+    }
+    nameId = iter->second;
+    return true;
+}
+
+uint32_t AllowRecordIndex::InternName(const std::string& name)
+{
+    auto iter = nameIds_.find(name);
+    if (iter != nameIds_.end()) {
+        return iter->second;
+    }
+    uint32_t nameId = 0;
+    if (!freeNameIds_.empty()) {
+        nameId = freeNameIds_.back();
+        freeNameIds_.pop_back();
+        names_[nameId] = InternedName {name, 0};
+    } else {
+        nameId = static_cast<uint32_t>(names_.size());
+        names_.emplace_back(InternedName {name, 0});
+    }
+    nameIds_.emplace(name, nameId);
+    return nameId;
+}
+
+void AllowRecordIndex::ReleaseName(uint32_t nameId)
+{
+    if (nameId >= names_.size() || names_[nameId].refCount_ == 0) {
+        return;
+    }
+    if (--names_[nameId].refCount_ > 0) {
+        return;
+    }
+    nameIds_.erase(names_[nameId].name_);
+    names_[nameId].name_.clear();
+    freeNameIds_.emplace_back(nameId);
+}
+
+uint32_t AllowRecordIndex::AllocSlot(uint64_t key)
+{
+    uint32_t slot = 0;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+    slots_[slot].key_ = key;
+    slots_[slot].postedMask_ = 0;
+    slots_[slot].inUse_ = true;
+    slotMap_.emplace(key, slot);
+    ++names_[static_cast<uint32_t>(key & NAME_ID_MASK)].refCount_;
+    return slot;
+}
+
+void AllowRecordIndex::AddPosting(uint32_t allowTypeIndex, uint32_t slot)
+{
+    auto& posting = postings_[allowTypeIndex];
+    slots_[slot].postingPos_[allowTypeIndex] = static_cast<uint32_t>(posting.size());
+    posting.emplace_back(slot);
+}
+
+void AllowRecordIndex::RemovePosting(uint32_t allowTypeIndex, uint32_t slot)
+{
+    auto& posting = postings_[allowTypeIndex];
+    uint32_t pos = slots_[slot].postingPos_[allowTypeIndex];
+    if (pos >= posting.size() || posting[pos] != slot) {
+        return;
+    }
+    uint32_t lastSlot = posting.back();
+    posting[pos] = lastSlot;
+    slots_[lastSlot].postingPos_[allowTypeIndex] = pos;
+    posting.pop_back();
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
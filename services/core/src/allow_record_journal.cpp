@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "allow_record_journal.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+#include "json_utils.h"
+#include "standby_service_log.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+    const std::string TAG_OP = "op";
+    const std::string TAG_KEY = "key";
+    const std::string TAG_VALUE = "value";
+    const std::string OP_PUT = "put";
+    const std::string OP_DEL = "del";
+    // generation of the journal, the header line of a journal and a reserved key of the snapshot
+    const std::string TAG_GENERATION = "journalGeneration";
+    const std::string SNAPSHOT_TMP_SUFFIX = ".tmp";
+    constexpr uint32_t JOURNAL_COMPACTION_THRESHOLD = 256;
+}
+
+AllowRecordJournal::AllowRecordJournal(const std::string& snapshotPath, const std::string& journalPath)
+    : snapshotPath_(snapshotPath), journalPath_(journalPath) {}
+
+void AllowRecordJournal::RecordUpdate(const std::string& key, const nlohmann::json& record)
+{
+    nlohmann::json entry;
+    entry[TAG_OP] = OP_PUT;
+    entry[TAG_KEY] = key;
+    entry[TAG_VALUE] = record;
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingEntries_.emplace_back(entry.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
+}
+
+void AllowRecordJournal::RecordRemove(const std::string& key)
+{
+    nlohmann::json entry;
+    entry[TAG_OP] = OP_DEL;
+    entry[TAG_KEY] = key;
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingEntries_.emplace_back(entry.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
+}
+
+bool AllowRecordJournal::Flush()
+{
+    std::lock_guard<std::mutex> fileLock(fileMutex_);
+    std::vector<std::string> entries;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        entries.swap(pendingEntries_);
+    }
+    if (entries.empty()) {
+        return true;
+    }
+    if (!AppendToJournal(entries)) {
+        // put the entries back in front of newer ones, they will be retried by the next flush
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        entries.insert(entries.end(), std::make_move_iterator(pendingEntries_.begin()),
+            std::make_move_iterator(pendingEntries_.end()));
+        pendingEntries_.swap(entries);
+        return false;
+    }
+    journalEntryCount_ += static_cast<uint32_t>(entries.size());
+    STANDBYSERVICE_LOGD("flush %{public}d allow record changes, journal size is %{public}u",
+        static_cast<int32_t>(entries.size()), journalEntryCount_);
+    return true;
+}
+
+bool AllowRecordJournal::NeedsCompaction()
+{
+    std::lock_guard<std::mutex> fileLock(fileMutex_);
+    return journalEntryCount_ >= JOURNAL_COMPACTION_THRESHOLD;
+}
+
+bool AllowRecordJournal::Compact(const nlohmann::json& snapshot)
+{
+    std::lock_guard<std::mutex> fileLock(fileMutex_);
+    // entries of the current journal are all covered by the snapshot, it is stale once the snapshot is replaced
+    uint64_t generation = journalGeneration_ + 1;
+    if (!WriteSnapshot(snapshot, generation)) {
+        return false;
+    }
+    journalGeneration_ = generation;
+    journalEntryCount_ = 0;
+    if (!ResetJournal(generation)) {
+        // a stale journal is skipped by Load, remove it so that the next flush starts a journal of this generation
+        remove(journalPath_.c_str());
+    }
+    STANDBYSERVICE_LOGD("allow record journal compacted, snapshot size is %{public}d",
+        static_cast<int32_t>(snapshot.size()));
+    return true;
+}
+
+bool AllowRecordJournal::Load(nlohmann::json& root)
+{
+    std::lock_guard<std::mutex> fileLock(fileMutex_);
+    bool hasSnapshot = JsonUtils::LoadJsonValueFromFile(root, snapshotPath_) && root.is_object();
+    if (!hasSnapshot) {
+        root = nlohmann::json::object();
+    }
+    uint64_t snapshotGeneration = 0;
+    auto iter = root.find(TAG_GENERATION);
+    if (iter != root.end()) {
+        if (iter->is_number_unsigned()) {
+            snapshotGeneration = iter->get<uint64_t>();
+        }
+        root.erase(iter);
+    }
+    journalGeneration_ = snapshotGeneration;
+    journalEntryCount_ = 0;
+    bool hasJournal = ReplayJournal(root, snapshotGeneration);
+    return hasSnapshot || hasJournal;
+}
+
+bool AllowRecordJournal::WriteSnapshot(const nlohmann::json& snapshot, uint64_t generation)
+{
+    nlohmann::json content = snapshot;
+    content[TAG_GENERATION] = generation;
+    std::string tmpPath = snapshotPath_ + SNAPSHOT_TMP_SUFFIX;
+    if (!JsonUtils::DumpJsonValueToFile(content, tmpPath)) {
+        STANDBYSERVICE_LOGE("failed to dump allow record snapshot");
+        return false;
+    }
+    // the snapshot must be durable before it replaces the old one, otherwise both could be lost on power off
+    int32_t fd = open(tmpPath.c_str(), O_WRONLY);
+    if (fd < 0 || fsync(fd) != 0) {
+        STANDBYSERVICE_LOGE("failed to sync allow record snapshot");
+        if (fd >= 0) {
+            close(fd);
+        }
+        remove(tmpPath.c_str());
+        return false;
+    }
+    close(fd);
+    if (rename(tmpPath.c_str(), snapshotPath_.c_str()) != 0) {
+        STANDBYSERVICE_LOGE("failed to replace allow record snapshot");
+        remove(tmpPath.c_str());
+        return false;
+    }
+    SyncParentDir(snapshotPath_);
+    return true;
+}
+
+bool AllowRecordJournal::ResetJournal(uint64_t generation)
+{
+    nlohmann::json header;
+    header[TAG_GENERATION] = generation;
+    std::string content = header.dump();
+    content.push_back('\n');
+    int32_t fd = open(journalPath_.c_str(), O_CREAT | O_WRONLY | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        STANDBYSERVICE_LOGE("failed to truncate allow record journal");
+        return false;
+    }
+    bool isSucceed = write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size()) &&
+        fsync(fd) == 0;
+    close(fd);
+    if (!isSucceed) {
+        STANDBYSERVICE_LOGE("failed to write allow record journal header");
+    }
+    return isSucceed;
+}
+
+void AllowRecordJournal::SyncParentDir(const std::string& path)
+{
+    std::string::size_type pos = path.find_last_of('/');
+    std::string dirPath = pos == std::string::npos ? "." : (pos == 0 ? "/" : path.substr(0, pos));
+    int32_t fd = open(dirPath.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        return;
+    }
+    if (fsync(fd) != 0) {
+        STANDBYSERVICE_LOGW("failed to sync directory of %{public}s", path.c_str());
+    }
+    close(fd);
+}
+
+bool AllowRecordJournal::AppendToJournal(const std::vector<std::string>& entries)
+{
+    int32_t fd = open(journalPath_.c_str(), O_CREAT | O_WRONLY | O_APPEND, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        STANDBYSERVICE_LOGE("failed to open allow record journal");
+        return false;
+    }
+    std::string content;
+    struct stat fileStat {};
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size == 0) {
+        nlohmann::json header;
+        header[TAG_GENERATION] = journalGeneration_;
+        content.append(header.dump()).push_back('\n');
+    }
+    for (const auto& entry : entries) {
+        content.append(entry).push_back('\n');
+    }
+    size_t written = 0;
+    while (written < content.size()) {
+        ssize_t ret = write(fd, content.data() + written, content.size() - written);
+        if (ret <= 0) {
+            STANDBYSERVICE_LOGE("failed to write allow record journal");
+            close(fd);
+            return false;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    if (fdatasync(fd) != 0) {
+        STANDBYSERVICE_LOGE("failed to sync allow record journal");
+        close(fd);
+        return false;
+    }
+    close(fd);
+    return true;
+}
+
+bool AllowRecordJournal::ReplayJournal(nlohmann::json& root, uint64_t snapshotGeneration)
+{
+    std::string realPath;
+    if (!JsonUtils::GetRealPath(journalPath_, realPath)) {
+        return false;
+    }
+    std::ifstream fin(realPath);
+    if (!fin.is_open()) {
+        return false;
+    }
+    uint32_t replayCount = 0;
+    bool isHeader = true;
+    std::string line;
+    while (std::getline(fin, line)) {
+        // the last line may be torn if the device powered off while appending, skip it
+        nlohmann::json entry = nlohmann::json::parse(line, nullptr, false);
+        if (entry.is_discarded() || !entry.is_object()) {
+            isHeader = false;
+            continue;
+        }
+        if (std::exchange(isHeader, false) && entry.contains(TAG_GENERATION)) {
+            uint64_t generation = entry.at(TAG_GENERATION).is_number_unsigned() ?
+                entry.at(TAG_GENERATION).get<uint64_t>() : 0;
+            if (generation < snapshotGeneration) {
+                // left behind by a compaction interrupted before truncation, already folded into the snapshot
+                STANDBYSERVICE_LOGW("skip stale allow record journal of generation %{public}" PRIu64, generation);
+                fin.close();
+                ResetJournal(snapshotGeneration);
+                return false;
+            }
+            journalGeneration_ = generation;
+            continue;
+        }
+        std::string op;
+        std::string key;
+        if (!JsonUtils::GetStringFromJsonValue(entry, TAG_OP, op) ||
+            !JsonUtils::GetStringFromJsonValue(entry, TAG_KEY, key)) {
+            continue;
+        }
+        if (op == OP_PUT && entry.contains(TAG_VALUE)) {
+            root[key] = entry.at(TAG_VALUE);
+        } else if (op == OP_DEL) {
+            root.erase(key);
+        }
+        ++replayCount;
+    }
+    journalEntryCount_ = replayCount;
+    STANDBYSERVICE_LOGI("replay %{public}u allow record changes from journal", replayCount);
+    return replayCount > 0;
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
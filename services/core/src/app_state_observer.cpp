@@ -15,6 +15,9 @@
 
 #include "app_state_observer.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "app_mgr_constants.h"
 #include "app_mgr_helper.h"
 #include "standby_service_impl.h"
@@ -22,39 +25,181 @@
 
 namespace OHOS {
 namespace DevStandbyMgr {
-AppStateObserver::AppStateObserver(const std::shared_ptr<AppExecFwk::EventHandler>& handler): handler_(handler) {}
+namespace {
+// events handled in a turn of event loop, the rest are handled in the next turn
+constexpr uint32_t MAX_DRAIN_BATCH = 64;
+// delay before seeding is retried, doubled on every failure
+constexpr int64_t MIN_SEED_RETRY_DELAY_MS = 1000;
+constexpr int64_t MAX_SEED_RETRY_DELAY_MS = 60 * 1000;
+}
 
-void AppStateObserver::OnProcessDied(const AppExecFwk::ProcessData &processData)
+AppStateEventQueue::AppStateEventQueue(const std::shared_ptr<AppExecFwk::EventHandler>& handler): handler_(handler) {}
+
+void AppStateEventQueue::Enqueue(AppStateEvent&& event)
 {
-    STANDBYSERVICE_LOGD("process died, uid : %{public}d, pid : %{public}d", processData.uid, processData.pid);
-    if (!this->CheckAlivedApp(processData.bundleName)) {
-        auto uid = processData.uid;
-        auto bundleName = processData.bundleName;
-        handler_->PostTask([uid, bundleName]() {
-            StandbyServiceImpl::GetInstance()->RemoveAppAllowRecord(uid, bundleName, false);
-        });
-    }
-    handler_->PostTask([uid = processData.uid, pid = processData.pid, bundleName = processData.bundleName]() {
-        StandbyServiceImpl::GetInstance()->OnProcessStatusChanged(uid, pid, bundleName, false);
+    if (!isSeedTaken_.load(std::memory_order_acquire)) {
+        TrySeedLiveProcesses();
+    }
+    // an event enqueued before the seed may be handled without live processes, check the app here instead
+    if (event.type_ == AppStateEvent::PROCESS_DIED && !isSeedTaken_.load(std::memory_order_acquire)) {
+        bool isRunning {true};
+        if (!AppMgrHelper::GetInstance()->GetAppRunningStateByBundleName(event.bundleName_, isRunning)) {
+            STANDBYSERVICE_LOGW("connect to app mgr service failed");
+            isRunning = true;
+        }
+        event.isAppAlive_ = isRunning;
+    }
+    if (!events_.Push(std::move(event))) {
+        STANDBYSERVICE_LOGE("failed to enqueue app state event");
+        return;
+    }
+    PostDrainTask();
+}
+
+void AppStateEventQueue::PostDrainTask()
+{
+    if (isDrainPosted_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (handler_ == nullptr) {
+        DrainEvents();
+        return;
+    }
+    // process messages are state machine input, drain on the critical lane to keep their order with other messages
+    StandbyServiceImpl::GetInstance()->PostLaneTask(TaskLane::CRITICAL, [eventQueue = shared_from_this()]() {
+        eventQueue->DrainEvents();
     });
 }
 
-bool AppStateObserver::CheckAlivedApp(const std::string &bundleName)
+void AppStateEventQueue::DrainEvents()
 {
-    STANDBYSERVICE_LOGD("start check app alive or not");
-    bool isRunning {true};
-    if (!AppMgrHelper::GetInstance()->GetAppRunningStateByBundleName(bundleName, isRunning)) {
-        STANDBYSERVICE_LOGW("connect to app mgr service failed");
-        return true;
+    // reset before popping, event enqueued after the last pop posts another drain task
+    isDrainPosted_.store(false, std::memory_order_release);
+    AppStateEvent event;
+    for (uint32_t count = 0; count < MAX_DRAIN_BATCH; ++count) {
+        if (!events_.Pop(event)) {
+            return;
+        }
+        HandleEvent(event);
     }
-    return isRunning;
+    PostDrainTask();
+}
+
+void AppStateEventQueue::HandleEvent(const AppStateEvent& event)
+{
+    switch (event.type_) {
+        case AppStateEvent::PROCESS_CREATED:
+            livePids_[event.bundleName_].emplace(event.pid_);
+            diedPids_.erase(event.pid_);
+            StandbyServiceImpl::GetInstance()->OnProcessStatusChanged(event.uid_, event.pid_, event.bundleName_, true);
+            break;
+        case AppStateEvent::PROCESS_DIED:
+            if (auto iter = livePids_.find(event.bundleName_); iter != livePids_.end()) {
+                iter->second.erase(event.pid_);
+            }
+            if (!isLivePidsSeeded_) {
+                diedPids_.emplace(event.pid_);
+            }
+            if (!IsAppAlive(event)) {
+                livePids_.erase(event.bundleName_);
+                StandbyServiceImpl::GetInstance()->RemoveAppAllowRecord(event.uid_, event.bundleName_, false);
+            }
+            StandbyServiceImpl::GetInstance()->OnProcessStatusChanged(event.uid_, event.pid_, event.bundleName_, false);
+            break;
+        case AppStateEvent::APP_TERMINATED:
+            StandbyServiceImpl::GetInstance()->RemoveAppAllowRecord(event.uid_, event.bundleName_, false);
+            break;
+        case AppStateEvent::LIVE_PROCESSES_SEEDED:
+            ApplySeed();
+            break;
+        default:
+            break;
+    }
+}
+
+void AppStateEventQueue::TrySeedLiveProcesses()
+{
+    int64_t now = GetNowMs();
+    if (now < nextSeedTimeMs_.load(std::memory_order_relaxed) ||
+        isSeeding_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (isSeedTaken_.load(std::memory_order_acquire)) {
+        isSeeding_.store(false, std::memory_order_release);
+        return;
+    }
+    std::vector<AppExecFwk::RunningProcessInfo> allAppProcessInfos {};
+    if (!AppMgrHelper::GetInstance()->GetAllRunningProcesses(allAppProcessInfos)) {
+        seedRetryDelayMs_ = std::min(std::max(seedRetryDelayMs_ * 2, MIN_SEED_RETRY_DELAY_MS),
+            MAX_SEED_RETRY_DELAY_MS);
+        nextSeedTimeMs_.store(now + seedRetryDelayMs_, std::memory_order_relaxed);
+        STANDBYSERVICE_LOGW("connect to app mgr service failed, retry seeding after %{public}lld ms",
+            static_cast<long long>(seedRetryDelayMs_));
+        isSeeding_.store(false, std::memory_order_release);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(seedMutex_);
+        seed_.clear();
+        for (const auto& info : allAppProcessInfos) {
+            for (const auto& bundleName : info.bundleNames) {
+                seed_[bundleName].emplace(info.pid_);
+            }
+        }
+    }
+    // events enqueued once the seed is taken are queued after it
+    if (events_.Push({AppStateEvent::LIVE_PROCESSES_SEEDED})) {
+        isSeedTaken_.store(true, std::memory_order_release);
+    }
+    isSeeding_.store(false, std::memory_order_release);
+}
+
+void AppStateEventQueue::ApplySeed()
+{
+    std::unordered_map<std::string, std::unordered_set<int32_t>> seed {};
+    {
+        std::lock_guard<std::mutex> lock(seedMutex_);
+        seed.swap(seed_);
+    }
+    for (const auto& [bundleName, pids] : seed) {
+        for (int32_t pid : pids) {
+            if (diedPids_.count(pid) == 0) {
+                livePids_[bundleName].emplace(pid);
+            }
+        }
+    }
+    diedPids_.clear();
+    isLivePidsSeeded_ = true;
+    STANDBYSERVICE_LOGI("live processes are seeded, bundle size is %{public}d", static_cast<int32_t>(livePids_.size()));
+}
+
+bool AppStateEventQueue::IsAppAlive(const AppStateEvent& event)
+{
+    if (!isLivePidsSeeded_) {
+        return event.isAppAlive_;
+    }
+    auto iter = livePids_.find(event.bundleName_);
+    return iter != livePids_.end() && !iter->second.empty();
+}
+
+int64_t AppStateEventQueue::GetNowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+AppStateObserver::AppStateObserver(const std::shared_ptr<AppExecFwk::EventHandler>& handler): handler_(handler),
+    eventQueue_(std::make_shared<AppStateEventQueue>(handler)) {}
+
+void AppStateObserver::OnProcessDied(const AppExecFwk::ProcessData &processData)
+{
+    STANDBYSERVICE_LOGD("process died, uid : %{public}d, pid : %{public}d", processData.uid, processData.pid);
+    eventQueue_->Enqueue({AppStateEvent::PROCESS_DIED, processData.uid, processData.pid, processData.bundleName});
 }
 
 void AppStateObserver::OnProcessCreated(const AppExecFwk::ProcessData &processData)
 {
-    handler_->PostTask([uid = processData.uid, pid = processData.pid, bundleName = processData.bundleName]() {
-        StandbyServiceImpl::GetInstance()->OnProcessStatusChanged(uid, pid, bundleName, true);
-    });
+    eventQueue_->Enqueue({AppStateEvent::PROCESS_CREATED, processData.uid, processData.pid, processData.bundleName});
 }
 
 void AppStateObserver::OnApplicationStateChanged(const AppExecFwk::AppStateData &appStateData)
@@ -69,9 +214,7 @@ void AppStateObserver::OnApplicationStateChanged(const AppExecFwk::AppStateData
     STANDBYSERVICE_LOGD("app is terminated, uid: %{public}d, bunddlename: %{public}s", uid, bundleName.c_str());
     if (state == static_cast<int32_t>(AppExecFwk::ApplicationState::APP_STATE_TERMINATED) || state ==
         static_cast<int32_t>(AppExecFwk::ApplicationState::APP_STATE_END)) {
-        handler_->PostTask([uid, bundleName]() {
-            StandbyServiceImpl::GetInstance()->RemoveAppAllowRecord(uid, bundleName, false);
-        });
+        eventQueue_->Enqueue({AppStateEvent::APP_TERMINATED, uid, -1, bundleName});
     }
 }
 
@@ -87,13 +230,12 @@ void AppStateObserver::OnForegroundApplicationChanged(const AppExecFwk::AppState
     auto isFocused = appStateData.isFocused;
     STANDBYSERVICE_LOGD("fg app changed, state: %{public}d, bunddlename: %{public}s", state, bundleName.c_str());
     if (state == static_cast<int32_t>(AppExecFwk::ApplicationState::APP_STATE_FOREGROUND) && isFocused) {
-        handler_->PostTask([pid, bundleName]() {
-            StandbyMessage message(StandbyMessageType::FG_APPLICATION_CHANGED);
-            message.want_ = AAFwk::Want{};
-            message.want_->SetParam("cur_foreground_app_pid", pid);
-            message.want_->SetParam("cur_foreground_app_name", bundleName);
-            StandbyServiceImpl::GetInstance()->DispatchEvent(message);
-        });
+        // DispatchEvent posts the message to the critical lane itself
+        StandbyMessage message(StandbyMessageType::FG_APPLICATION_CHANGED);
+        message.want_ = AAFwk::Want{};
+        message.want_->SetParam("cur_foreground_app_pid", pid);
+        message.want_->SetParam("cur_foreground_app_name", bundleName);
+        StandbyServiceImpl::GetInstance()->DispatchEvent(std::move(message));
     }
 }
 
@@ -108,17 +250,15 @@ void AppStateObserver::OnPageShow(const AppExecFwk::PageStateData &pageStateData
     STANDBYSERVICE_LOGD("PageStateData: page show, pageName: %{public}s, bundlename: %{public}s",
         pageName.c_str(),
         bundleName.c_str());
-    handler_->PostTask([bundleName, moduleName, abilityName, pageName, targetBundleName, targetModuleName]() {
-        StandbyMessage message(StandbyMessageType::PAGE_SHOW);
-        message.want_ = AAFwk::Want{};
-        message.want_->SetParam("bundleName", bundleName);
-        message.want_->SetParam("moduleName", moduleName);
-        message.want_->SetParam("abilityName", abilityName);
-        message.want_->SetParam("pageName", pageName);
-        message.want_->SetParam("targetBundleName", targetBundleName);
-        message.want_->SetParam("targetModuleName", targetModuleName);
-        StandbyServiceImpl::GetInstance()->DispatchEvent(message);
-    });
+    StandbyMessage message(StandbyMessageType::PAGE_SHOW);
+    message.want_ = AAFwk::Want{};
+    message.want_->SetParam("bundleName", bundleName);
+    message.want_->SetParam("moduleName", moduleName);
+    message.want_->SetParam("abilityName", abilityName);
+    message.want_->SetParam("pageName", pageName);
+    message.want_->SetParam("targetBundleName", targetBundleName);
+    message.want_->SetParam("targetModuleName", targetModuleName);
+    StandbyServiceImpl::GetInstance()->DispatchEvent(std::move(message));
 }
 
 void AppStateObserver::OnPageHide(const AppExecFwk::PageStateData &pageStateData)
@@ -132,17 +272,15 @@ void AppStateObserver::OnPageHide(const AppExecFwk::PageStateData &pageStateData
     STANDBYSERVICE_LOGD("PageStateData: page hide, pageName: %{public}s, bundlename: %{public}s",
         pageName.c_str(),
         bundleName.c_str());
-    handler_->PostTask([bundleName, moduleName, abilityName, pageName, targetBundleName, targetModuleName]() {
-        StandbyMessage message(StandbyMessageType::PAGE_HIDE);
-        message.want_ = AAFwk::Want{};
-        message.want_->SetParam("bundleName", bundleName);
-        message.want_->SetParam("moduleName", moduleName);
-        message.want_->SetParam("abilityName", abilityName);
-        message.want_->SetParam("pageName", pageName);
-        message.want_->SetParam("targetBundleName", targetBundleName);
-        message.want_->SetParam("targetModuleName", targetModuleName);
-        StandbyServiceImpl::GetInstance()->DispatchEvent(message);
-    });
+    StandbyMessage message(StandbyMessageType::PAGE_HIDE);
+    message.want_ = AAFwk::Want{};
+    message.want_->SetParam("bundleName", bundleName);
+    message.want_->SetParam("moduleName", moduleName);
+    message.want_->SetParam("abilityName", abilityName);
+    message.want_->SetParam("pageName", pageName);
+    message.want_->SetParam("targetBundleName", targetBundleName);
+    message.want_->SetParam("targetModuleName", targetModuleName);
+    StandbyServiceImpl::GetInstance()->DispatchEvent(std::move(message));
 }
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "caller_permission_cache.h"
+
+#include <chrono>
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+// slot layout: token id in the high word, put time in seconds, granted and valid bit in the low word
+constexpr uint32_t TOKEN_ID_SHIFT = 32;
+constexpr uint64_t VALID_BIT = 1;
+constexpr uint64_t GRANTED_BIT = 1 << 1;
+constexpr uint32_t PUT_TIME_SHIFT = 2;
+constexpr uint32_t PUT_TIME_MASK = 0xFFFFFFFFu >> PUT_TIME_SHIFT;
+}
+
+bool CallerPermissionCache::Get(uint32_t tokenId, bool& isGranted) const
+{
+    uint64_t slot = slots_[tokenId % SLOT_NUM].load(std::memory_order_acquire);
+    if ((slot & VALID_BIT) == 0 || static_cast<uint32_t>(slot >> TOKEN_ID_SHIFT) != tokenId) {
+        return false;
+    }
+    uint32_t putTime = static_cast<uint32_t>(slot >> PUT_TIME_SHIFT) & PUT_TIME_MASK;
+    // the difference is taken modulo the width of the put time, so it stays right when the time wraps
+    if (((GetNowSec() - putTime) & PUT_TIME_MASK) >= ENTRY_TTL_SEC) {
+        return false;
+    }
+    isGranted = (slot & GRANTED_BIT) != 0;
+    return true;
+}
+
+void CallerPermissionCache::Put(uint32_t tokenId, bool isGranted)
+{
+    uint64_t slot = (static_cast<uint64_t>(tokenId) << TOKEN_ID_SHIFT) |
+        (static_cast<uint64_t>(GetNowSec()) << PUT_TIME_SHIFT) | VALID_BIT | (isGranted ? GRANTED_BIT : 0);
+    slots_[tokenId % SLOT_NUM].store(slot, std::memory_order_release);
+}
+
+uint32_t CallerPermissionCache::GetNowSec()
+{
+    auto nowSec = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    return static_cast<uint32_t>(nowSec) & PUT_TIME_MASK;
+}
+
+void CallerPermissionCache::Clear()
+{
+    for (auto& slot : slots_) {
+        slot.store(0, std::memory_order_release);
+    }
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
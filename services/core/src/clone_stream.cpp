@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "clone_stream.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <securec.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "standby_service_log.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+constexpr const char* CLONE_MEMFD_NAME = "standby_clone";
+constexpr size_t READ_CHUNK_SIZE = 64 * 1024;
+
+bool WriteFully(int32_t fd, const char* data, size_t size)
+{
+    while (size > 0) {
+        ssize_t len = write(fd, data, size);
+        if (len < 0 && errno == EINTR) {
+            continue;
+        }
+        if (len <= 0) {
+            return false;
+        }
+        data += len;
+        size -= static_cast<size_t>(len);
+    }
+    return true;
+}
+
+bool PwriteFully(int32_t fd, const char* data, size_t size, off_t offset)
+{
+    while (size > 0) {
+        ssize_t len = pwrite(fd, data, size, offset);
+        if (len < 0 && errno == EINTR) {
+            continue;
+        }
+        if (len <= 0) {
+            return false;
+        }
+        data += len;
+        size -= static_cast<size_t>(len);
+        offset += len;
+    }
+    return true;
+}
+}
+
+bool CloneSectionWriter::Write(const void* data, size_t size)
+{
+    if (size == 0) {
+        return true;
+    }
+    if (data == nullptr || !WriteFully(fd_, static_cast<const char*>(data), size)) {
+        return false;
+    }
+    size_ += size;
+    return true;
+}
+
+bool CloneStreamWriter::Open()
+{
+    fd_ = UniqueFd(memfd_create(CLONE_MEMFD_NAME, MFD_CLOEXEC | MFD_ALLOW_SEALING));
+    if (fd_.Get() < 0) {
+        STANDBYSERVICE_LOGE("create clone memfd failed, errno: %{public}d", errno);
+        return false;
+    }
+    offset_ = 0;
+    moduleNum_ = 0;
+    return true;
+}
+
+ErrCode CloneStreamWriter::WriteModule(const std::string& moduleName, const CloneBackupFunc& func)
+{
+    if (fd_.Get() < 0) {
+        return ERR_INVALID_OPERATION;
+    }
+    CloneFileHead head {};
+    if (moduleName.size() >= CLONE_MODULE_NAME_LEN ||
+        strncpy_s(head.moduleName, sizeof(head.moduleName), moduleName.c_str(), moduleName.size()) != EOK) {
+        STANDBYSERVICE_LOGE("module name %{public}s is too long to clone", moduleName.c_str());
+        return ERR_INVALID_VALUE;
+    }
+    // the head is reserved here and filled in once the size of the data is known
+    if (lseek(fd_.Get(), static_cast<off_t>(offset_ + sizeof(CloneFileHead)), SEEK_SET) < 0) {
+        fd_ = UniqueFd(-1);
+        return ERR_INVALID_OPERATION;
+    }
+    CloneSectionWriter sectionWriter(fd_.Get());
+    ErrCode ret = func(sectionWriter);
+    if (ret == ERR_OK && (offset_ > UINT32_MAX || sectionWriter.GetSize() > UINT32_MAX)) {
+        STANDBYSERVICE_LOGE("backup of %{public}s exceeds the clone file size", moduleName.c_str());
+        ret = ERR_INVALID_VALUE;
+    }
+    if (ret == ERR_OK) {
+        head.fileOffset = static_cast<uint32_t>(offset_);
+        head.fileSize = static_cast<uint32_t>(sectionWriter.GetSize());
+        if (!PwriteFully(fd_.Get(), reinterpret_cast<const char*>(&head), sizeof(head),
+            static_cast<off_t>(offset_))) {
+            STANDBYSERVICE_LOGE("write clone head failed, errno: %{public}d", errno);
+            ret = ERR_INVALID_OPERATION;
+        }
+    }
+    if (ret != ERR_OK) {
+        STANDBYSERVICE_LOGE("backup of %{public}s failed, ret: %{public}d", moduleName.c_str(), ret);
+        // drop the reserved head and whatever the module has written
+        if (ftruncate(fd_.Get(), static_cast<off_t>(offset_)) != 0) {
+            fd_ = UniqueFd(-1);
+        }
+        return ret;
+    }
+    offset_ += sizeof(CloneFileHead) + sectionWriter.GetSize();
+    ++moduleNum_;
+    return ERR_OK;
+}
+
+UniqueFd CloneStreamWriter::Finish()
+{
+    if (fd_.Get() < 0 || moduleNum_ == 0) {
+        return UniqueFd(-1);
+    }
+    if (fcntl(fd_.Get(), F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0) {
+        STANDBYSERVICE_LOGW("seal clone memfd failed, errno: %{public}d", errno);
+    }
+    lseek(fd_.Get(), 0, SEEK_SET);
+    moduleNum_ = 0;
+    return std::move(fd_);
+}
+
+CloneStreamReader::~CloneStreamReader()
+{
+    if (isMapped_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+bool CloneStreamReader::Open(int32_t fd)
+{
+    struct stat fileStat {};
+    if (fd < 0 || fstat(fd, &fileStat) != 0) {
+        return false;
+    }
+    if (S_ISREG(fileStat.st_mode) && fileStat.st_size > 0) {
+        void* addr = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            data_ = static_cast<const char*>(addr);
+            size_ = static_cast<size_t>(fileStat.st_size);
+            isMapped_ = true;
+            return true;
+        }
+        STANDBYSERVICE_LOGW("map clone fd failed, errno: %{public}d, read it instead", errno);
+    }
+    buffer_.clear();
+    lseek(fd, 0, SEEK_SET);
+    while (true) {
+        size_t oldSize = buffer_.size();
+        buffer_.resize(oldSize + READ_CHUNK_SIZE);
+        ssize_t len = read(fd, buffer_.data() + oldSize, READ_CHUNK_SIZE);
+        if (len < 0 && errno == EINTR) {
+            buffer_.resize(oldSize);
+            continue;
+        }
+        if (len < 0) {
+            buffer_.clear();
+            return false;
+        }
+        buffer_.resize(oldSize + static_cast<size_t>(len));
+        if (len == 0) {
+            break;
+        }
+    }
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    return size_ > 0;
+}
+
+void CloneStreamReader::ForEachSection(const std::function<void(const std::string&, std::string_view)>& func) const
+{
+    size_t offset = 0;
+    while (data_ != nullptr && offset + sizeof(CloneFileHead) <= size_) {
+        CloneFileHead head {};
+        if (memcpy_s(&head, sizeof(head), data_ + offset, sizeof(head)) != EOK ||
+            head.fileSize > size_ - offset - sizeof(CloneFileHead)) {
+            break;
+        }
+        head.moduleName[CLONE_MODULE_NAME_LEN - 1] = '\0';
+        func(std::string(head.moduleName), std::string_view(data_ + offset + sizeof(CloneFileHead), head.fileSize));
+        offset += sizeof(CloneFileHead) + head.fileSize;
+    }
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
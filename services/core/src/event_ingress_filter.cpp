@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "event_ingress_filter.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+#include "res_type.h"
+#include "scene_info_decoder.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+constexpr size_t MAX_SLOT_NUM = 256;
+constexpr uint64_t FINGERPRINT_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+constexpr uint64_t NO_KEY = 0;
+
+enum class IngressKey : uint8_t {
+    // device wide reports share a single key
+    NONE = 0,
+    // reports of different values are independent
+    VALUE,
+    // keyed by a field of sceneInfo
+    SCENE_FIELD,
+};
+
+struct IngressPolicyEntry {
+    IngressPolicy policy_ {IngressPolicy::PASS_THROUGH};
+    IngressKey key_ {IngressKey::NONE};
+    const SceneInfoSchema* keySchema_ {nullptr};
+    uint32_t keyField_ {0};
+};
+
+// resTypes not listed are state critical or rare, such as screen, charging and app install, and pass through
+const std::unordered_map<uint32_t, IngressPolicyEntry> INGRESS_POLICIES = {
+    {ResourceSchedule::ResType::RES_TYPE_INNER_AUDIO_STATE, {IngressPolicy::COALESCE, IngressKey::SCENE_FIELD,
+        &SceneInfoSchemas::AUDIO_STATE_CHANGED, SceneInfoSchemas::AUDIO_UID}},
+    {ResourceSchedule::ResType::RES_TYPE_AUDIO_CAPTURE_STATUS_CHANGED, {IngressPolicy::COALESCE,
+        IngressKey::SCENE_FIELD, &SceneInfoSchemas::AUDIO_STATE_CHANGED, SceneInfoSchemas::AUDIO_UID}},
+    {ResourceSchedule::ResType::RES_TYPE_CLICK_RECOGNIZE, {IngressPolicy::COALESCE, IngressKey::NONE}},
+    {ResourceSchedule::ResType::RES_TYPE_BT_SERVICE_EVENT, {IngressPolicy::DEDUPLICATE, IngressKey::VALUE}},
+    {ResourceSchedule::ResType::RES_TYPE_REPORT_BOKER_GATT_CONNECT, {IngressPolicy::DEDUPLICATE,
+        IngressKey::SCENE_FIELD, &SceneInfoSchemas::BROKER_GATT_DISCONNECT, SceneInfoSchemas::BROKER_CLIENT_IF}},
+    {ResourceSchedule::ResType::RES_TYPE_EFFICIENCY_RESOURCES_STATE_CHANGED, {IngressPolicy::DEDUPLICATE,
+        IngressKey::SCENE_FIELD, &SceneInfoSchemas::EFFICIENCY_RESOURCES_STATE_CHANGED,
+        SceneInfoSchemas::RESOURCES_BUNDLE_NAME}},
+    {ResourceSchedule::ResType::RES_TYPE_CALL_STATE_CHANGED, {IngressPolicy::DEDUPLICATE, IngressKey::NONE}},
+    {ResourceSchedule::ResType::RES_TYPE_WIFI_P2P_STATE_CHANGED, {IngressPolicy::DEDUPLICATE, IngressKey::NONE}},
+    {ResourceSchedule::ResType::RES_TYPE_WIFI_CONNECT_STATE_CHANGE, {IngressPolicy::DEDUPLICATE, IngressKey::NONE}},
+    {ResourceSchedule::ResType::RES_TYPE_THERMAL_SCENARIO_REPORT, {IngressPolicy::DEDUPLICATE, IngressKey::NONE}},
+};
+
+const std::string& GetPolicyName(IngressPolicy policy)
+{
+    static const std::string POLICY_NAMES[] = {"pass", "dedup", "coalesce"};
+    return POLICY_NAMES[static_cast<uint32_t>(policy)];
+}
+}
+
+void EventIngressFilter::Reset(int64_t coalesceWindowMs, int64_t dedupWindowMs)
+{
+    std::lock_guard<std::mutex> lock(filterMutex_);
+    coalesceWindowMs_ = (coalesceWindowMs <= 0) ? DEFAULT_COALESCE_WINDOW_MS : coalesceWindowMs;
+    dedupWindowMs_ = (dedupWindowMs <= 0) ? DEFAULT_DEDUP_WINDOW_MS : dedupWindowMs;
+    slots_.clear();
+    isFlushPosted_ = false;
+}
+
+IngressPolicy EventIngressFilter::GetPolicy(uint32_t resType)
+{
+    auto iter = INGRESS_POLICIES.find(resType);
+    return iter == INGRESS_POLICIES.end() ? IngressPolicy::PASS_THROUGH : iter->second.policy_;
+}
+
+IngressDecision EventIngressFilter::Filter(uint32_t resType, int64_t value, const std::string& sceneInfo,
+    int64_t nowMs, int64_t& flushDelayMs)
+{
+    flushDelayMs = 0;
+    IngressPolicy policy = GetPolicy(resType);
+    if (policy == IngressPolicy::PASS_THROUGH) {
+        std::lock_guard<std::mutex> lock(filterMutex_);
+        ++stats_[resType].passedCount_;
+        return IngressDecision::PASS;
+    }
+    // decoded out of the lock
+    uint64_t key = GetKey(resType, value, sceneInfo);
+    uint64_t fingerprint = GetFingerprint(value, sceneInfo);
+    std::lock_guard<std::mutex> lock(filterMutex_);
+    if (slots_.size() >= MAX_SLOT_NUM) {
+        EvictIdleSlotsLocked(nowMs);
+    }
+    auto [iter, isNewKey] = slots_.try_emplace(SlotKey {resType, key});
+    KeySlot& slot = iter->second;
+    if (isNewKey) {
+        slot.policy_ = policy;
+        slot.lastFingerprint_ = ~fingerprint;
+    }
+    IngressDecision decision = FilterLocked(slot, resType, value, sceneInfo, fingerprint, nowMs, flushDelayMs);
+    auto& stat = stats_[resType];
+    if (decision == IngressDecision::PASS) {
+        ++stat.passedCount_;
+    } else if (decision == IngressDecision::SUPPRESS) {
+        ++stat.suppressedCount_;
+    }
+    return decision;
+}
+
+IngressDecision EventIngressFilter::FilterLocked(KeySlot& slot, uint32_t resType, int64_t value,
+    const std::string& sceneInfo, uint64_t fingerprint, int64_t nowMs, int64_t& flushDelayMs)
+{
+    if (slot.policy_ == IngressPolicy::DEDUPLICATE) {
+        // the delivery time is not refreshed by duplicates, so one report per window still gets through
+        if (fingerprint == slot.lastFingerprint_ && nowMs - slot.lastDeliverTime_ < dedupWindowMs_) {
+            return IngressDecision::SUPPRESS;
+        }
+        slot.lastFingerprint_ = fingerprint;
+        slot.lastDeliverTime_ = nowMs;
+        return IngressDecision::PASS;
+    }
+    if (!slot.hasPending_ && nowMs >= slot.windowEnd_) {
+        slot.lastFingerprint_ = fingerprint;
+        slot.lastDeliverTime_ = nowMs;
+        slot.windowEnd_ = nowMs + coalesceWindowMs_;
+        return IngressDecision::PASS;
+    }
+    if (slot.hasPending_) {
+        ++stats_[resType].coalescedCount_;
+    }
+    slot.hasPending_ = true;
+    slot.pendingFingerprint_ = fingerprint;
+    slot.pendingEvent_ = {resType, value, sceneInfo};
+    if (!isFlushPosted_) {
+        isFlushPosted_ = true;
+        flushDelayMs = std::max(slot.windowEnd_ - nowMs, static_cast<int64_t>(1));
+    }
+    return IngressDecision::DEFER;
+}
+
+std::vector<IngressEvent> EventIngressFilter::TakeDueEvents(int64_t nowMs, int64_t& flushDelayMs)
+{
+    flushDelayMs = 0;
+    std::vector<IngressEvent> dueEvents;
+    std::lock_guard<std::mutex> lock(filterMutex_);
+    int64_t nextWindowEnd = INT64_MAX;
+    for (auto& [slotKey, slot] : slots_) {
+        if (!slot.hasPending_) {
+            continue;
+        }
+        if (nowMs < slot.windowEnd_) {
+            nextWindowEnd = std::min(nextWindowEnd, slot.windowEnd_);
+            continue;
+        }
+        slot.hasPending_ = false;
+        if (slot.pendingFingerprint_ == slot.lastFingerprint_) {
+            ++stats_[slotKey.first].suppressedCount_;
+            continue;
+        }
+        ++stats_[slotKey.first].passedCount_;
+        slot.lastFingerprint_ = slot.pendingFingerprint_;
+        slot.lastDeliverTime_ = nowMs;
+        slot.windowEnd_ = nowMs + coalesceWindowMs_;
+        dueEvents.emplace_back(std::move(slot.pendingEvent_));
+    }
+    isFlushPosted_ = nextWindowEnd != INT64_MAX;
+    if (isFlushPosted_) {
+        flushDelayMs = std::max(nextWindowEnd - nowMs, static_cast<int64_t>(1));
+    }
+    return dueEvents;
+}
+
+void EventIngressFilter::EvictIdleSlotsLocked(int64_t nowMs)
+{
+    for (auto iter = slots_.begin(); iter != slots_.end();) {
+        const KeySlot& slot = iter->second;
+        bool isIdle = !slot.hasPending_ && (slot.policy_ == IngressPolicy::DEDUPLICATE ?
+            nowMs - slot.lastDeliverTime_ >= dedupWindowMs_ : nowMs >= slot.windowEnd_);
+        iter = isIdle ? slots_.erase(iter) : std::next(iter);
+    }
+}
+
+uint64_t EventIngressFilter::GetKey(uint32_t resType, int64_t value, const std::string& sceneInfo)
+{
+    const IngressPolicyEntry& entry = INGRESS_POLICIES.at(resType);
+    switch (entry.key_) {
+        case IngressKey::VALUE:
+            return static_cast<uint64_t>(value);
+        case IngressKey::SCENE_FIELD: {
+            // a report without the key field shares the key of device wide reports
+            SceneInfoFields fields;
+            if (SceneInfoDecoder::Decode(sceneInfo, *entry.keySchema_, fields) == SceneDecodeResult::MALFORMED ||
+                !fields[entry.keyField_].isPresent_) {
+                return NO_KEY;
+            }
+            const SceneFieldValue& field = fields[entry.keyField_];
+            return entry.keySchema_->fields_[entry.keyField_].type_ == SceneFieldType::STRING ?
+                std::hash<std::string_view>()(field.str_) : static_cast<uint64_t>(field.num_);
+        }
+        default:
+            return NO_KEY;
+    }
+}
+
+uint64_t EventIngressFilter::GetFingerprint(int64_t value, const std::string& sceneInfo)
+{
+    return std::hash<std::string>()(sceneInfo) ^ (static_cast<uint64_t>(value) * FINGERPRINT_MULTIPLIER);
+}
+
+void EventIngressFilter::ShellDump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(filterMutex_);
+    IngressStat total;
+    std::stringstream detail;
+    for (const auto& [resType, stat] : stats_) {
+        total.passedCount_ += stat.passedCount_;
+        total.suppressedCount_ += stat.suppressedCount_;
+        total.coalescedCount_ += stat.coalescedCount_;
+        detail << "\t" << resType << "(" << GetPolicyName(GetPolicy(resType)) << "): passed " << stat.passedCount_
+            << ", suppressed " << stat.suppressedCount_ << ", coalesced " << stat.coalescedCount_ << "\n";
+    }
+    std::stringstream stream;
+    stream << "ingress filter: passed " << total.passedCount_ << ", suppressed " << total.suppressedCount_
+        << ", coalesced " << total.coalescedCount_ << ", tracked keys " << slots_.size() << "\n" << detail.str();
+    result += stream.str();
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scene_info_decoder.h"
+
+#include <limits>
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+constexpr uint32_t MAX_NESTING_DEPTH = 32;
+constexpr uint32_t UNICODE_ESCAPE_LEN = 4;
+constexpr uint32_t HEX_BASE = 16;
+constexpr uint32_t DECIMAL_BASE = 10;
+constexpr uint32_t HIGH_SURROGATE_BEGIN = 0xD800;
+constexpr uint32_t LOW_SURROGATE_BEGIN = 0xDC00;
+constexpr uint32_t SURROGATE_END = 0xE000;
+constexpr uint32_t SURROGATE_BITS = 10;
+constexpr uint32_t SUPPLEMENTARY_BEGIN = 0x10000;
+constexpr uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+constexpr uint32_t UTF8_ONE_BYTE_END = 0x80;
+constexpr uint32_t UTF8_TWO_BYTE_END = 0x800;
+constexpr uint32_t UTF8_CONTINUATION_BITS = 6;
+constexpr uint32_t UTF8_CONTINUATION_MASK = 0x3F;
+constexpr uint32_t UTF8_CONTINUATION = 0x80;
+constexpr uint32_t UTF8_TWO_BYTE_LEAD = 0xC0;
+constexpr uint32_t UTF8_THREE_BYTE_LEAD = 0xE0;
+constexpr uint32_t UTF8_FOUR_BYTE_LEAD = 0xF0;
+constexpr unsigned char MIN_UNESCAPED_CHAR = 0x20;
+
+enum class ValueKind : uint8_t {
+    STRING = 0,
+    INTEGER,
+    OTHER,
+};
+
+bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+int32_t HexValue(char c)
+{
+    if (IsDigit(c)) {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + DECIMAL_BASE;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + DECIMAL_BASE;
+    }
+    return -1;
+}
+
+// leading digits after optional blanks and sign, saturated instead of overflowing
+int64_t ParseInteger(std::string_view text)
+{
+    size_t pos = 0;
+    while (pos < text.size() && (IsSpace(text[pos]) || text[pos] == '\v' || text[pos] == '\f')) {
+        ++pos;
+    }
+    bool isNegative = false;
+    if (pos < text.size() && (text[pos] == '-' || text[pos] == '+')) {
+        isNegative = text[pos] == '-';
+        ++pos;
+    }
+    int64_t limit = std::numeric_limits<int64_t>::max();
+    int64_t result = 0;
+    for (; pos < text.size() && IsDigit(text[pos]); ++pos) {
+        int64_t digit = text[pos] - '0';
+        if (result > (limit - digit) / DECIMAL_BASE) {
+            return isNegative ? std::numeric_limits<int64_t>::min() : limit;
+        }
+        result = result * DECIMAL_BASE + digit;
+    }
+    return isNegative ? -result : result;
+}
+
+void AppendUtf8(std::string& result, uint32_t codePoint)
+{
+    if (codePoint < UTF8_ONE_BYTE_END) {
+        result.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < UTF8_TWO_BYTE_END) {
+        result.push_back(static_cast<char>(UTF8_TWO_BYTE_LEAD | (codePoint >> UTF8_CONTINUATION_BITS)));
+        result.push_back(static_cast<char>(UTF8_CONTINUATION | (codePoint & UTF8_CONTINUATION_MASK)));
+    } else if (codePoint < SUPPLEMENTARY_BEGIN) {
+        result.push_back(static_cast<char>(UTF8_THREE_BYTE_LEAD | (codePoint >> (UTF8_CONTINUATION_BITS * 2))));
+        result.push_back(static_cast<char>(UTF8_CONTINUATION |
+            ((codePoint >> UTF8_CONTINUATION_BITS) & UTF8_CONTINUATION_MASK)));
+        result.push_back(static_cast<char>(UTF8_CONTINUATION | (codePoint & UTF8_CONTINUATION_MASK)));
+    } else {
+        result.push_back(static_cast<char>(UTF8_FOUR_BYTE_LEAD | (codePoint >> (UTF8_CONTINUATION_BITS * 3))));
+        result.push_back(static_cast<char>(UTF8_CONTINUATION |
+            ((codePoint >> (UTF8_CONTINUATION_BITS * 2)) & UTF8_CONTINUATION_MASK)));
+        result.push_back(static_cast<char>(UTF8_CONTINUATION |
+            ((codePoint >> UTF8_CONTINUATION_BITS) & UTF8_CONTINUATION_MASK)));
+        result.push_back(static_cast<char>(UTF8_CONTINUATION | (codePoint & UTF8_CONTINUATION_MASK)));
+    }
+}
+
+// read the four hex digits of an escape validated by the reader
+uint32_t ReadUnicodeEscape(std::string_view text, size_t pos)
+{
+    uint32_t codeUnit = 0;
+    for (uint32_t index = 0; index < UNICODE_ESCAPE_LEN; ++index) {
+        codeUnit = codeUnit * HEX_BASE + static_cast<uint32_t>(HexValue(text[pos + index]));
+    }
+    return codeUnit;
+}
+
+class SceneInfoReader {
+public:
+    explicit SceneInfoReader(std::string_view text) : text_(text) {}
+
+    void SkipSpace()
+    {
+        while (pos_ < text_.size() && IsSpace(text_[pos_])) {
+            ++pos_;
+        }
+    }
+
+    bool IsEnd() const
+    {
+        return pos_ >= text_.size();
+    }
+
+    bool Consume(char c)
+    {
+        SkipSpace();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    // read the string starting at the current position, str is the raw content between the quotes
+    bool ReadString(std::string_view& str, bool& isEscaped)
+    {
+        SkipSpace();
+        if (pos_ >= text_.size() || text_[pos_] != '"') {
+            return false;
+        }
+        size_t begin = ++pos_;
+        isEscaped = false;
+        while (pos_ < text_.size()) {
+            char c = text_[pos_];
+            if (c == '"') {
+                str = text_.substr(begin, pos_ - begin);
+                ++pos_;
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < MIN_UNESCAPED_CHAR) {
+                return false;
+            }
+            if (c == '\\') {
+                isEscaped = true;
+                if (!SkipEscape()) {
+                    return false;
+                }
+                continue;
+            }
+            ++pos_;
+        }
+        return false;
+    }
+
+    // read a json number, isInteger is false if it has a fraction or an exponent
+    bool ReadNumber(std::string_view& literal, bool& isInteger)
+    {
+        SkipSpace();
+        size_t begin = pos_;
+        if (pos_ < text_.size() && text_[pos_] == '-') {
+            ++pos_;
+        }
+        if (pos_ < text_.size() && text_[pos_] == '0') {
+            ++pos_;
+        } else if (!SkipDigits()) {
+            return false;
+        }
+        isInteger = true;
+        if (pos_ < text_.size() && text_[pos_] == '.') {
+            ++pos_;
+            isInteger = false;
+            if (!SkipDigits()) {
+                return false;
+            }
+        }
+        if (pos_ < text_.size() && (text_[pos_] == 'e' || text_[pos_] == 'E')) {
+            ++pos_;
+            isInteger = false;
+            if (pos_ < text_.size() && (text_[pos_] == '-' || text_[pos_] == '+')) {
+                ++pos_;
+            }
+            if (!SkipDigits()) {
+                return false;
+            }
+        }
+        literal = text_.substr(begin, pos_ - begin);
+        return true;
+    }
+
+    // read a value of any type, str holds the string content or the number literal
+    bool ReadValue(ValueKind& kind, std::string_view& str, bool& isEscaped)
+    {
+        SkipSpace();
+        if (pos_ >= text_.size()) {
+            return false;
+        }
+        char c = text_[pos_];
+        if (c == '"') {
+            kind = ValueKind::STRING;
+            return ReadString(str, isEscaped);
+        }
+        if (c == '-' || IsDigit(c)) {
+            bool isInteger = false;
+            if (!ReadNumber(str, isInteger)) {
+                return false;
+            }
+            kind = isInteger ? ValueKind::INTEGER : ValueKind::OTHER;
+            return true;
+        }
+        kind = ValueKind::OTHER;
+        return SkipValue(0);
+    }
+
+    bool SkipValue(uint32_t depth)
+    {
+        SkipSpace();
+        if (pos_ >= text_.size() || depth > MAX_NESTING_DEPTH) {
+            return false;
+        }
+        std::string_view str;
+        bool isEscaped = false;
+        bool isInteger = false;
+        switch (text_[pos_]) {
+            case '{':
+                return SkipContainer('}', true, depth);
+            case '[':
+                return SkipContainer(']', false, depth);
+            case '"':
+                return ReadString(str, isEscaped);
+            case 't':
+                return SkipLiteral("true");
+            case 'f':
+                return SkipLiteral("false");
+            case 'n':
+                return SkipLiteral("null");
+            default:
+                return ReadNumber(str, isInteger);
+        }
+    }
+
+private:
+    bool SkipDigits()
+    {
+        size_t begin = pos_;
+        while (pos_ < text_.size() && IsDigit(text_[pos_])) {
+            ++pos_;
+        }
+        return pos_ > begin;
+    }
+
+    bool SkipEscape()
+    {
+        // skip the backslash
+        if (++pos_ >= text_.size()) {
+            return false;
+        }
+        switch (text_[pos_++]) {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+                return true;
+            case 'u':
+                for (uint32_t index = 0; index < UNICODE_ESCAPE_LEN; ++index, ++pos_) {
+                    if (pos_ >= text_.size() || HexValue(text_[pos_]) < 0) {
+                        return false;
+                    }
+                }
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool SkipLiteral(std::string_view literal)
+    {
+        if (text_.substr(pos_, literal.size()) != literal) {
+            return false;
+        }
+        pos_ += literal.size();
+        return true;
+    }
+
+    bool SkipContainer(char close, bool isObject, uint32_t depth)
+    {
+        // skip the opening bracket
+        ++pos_;
+        if (Consume(close)) {
+            return true;
+        }
+        do {
+            std::string_view key;
+            bool isEscaped = false;
+            if (isObject && (!ReadString(key, isEscaped) || !Consume(':'))) {
+                return false;
+            }
+            if (!SkipValue(depth + 1)) {
+                return false;
+            }
+        } while (Consume(','));
+        return Consume(close);
+    }
+
+private:
+    std::string_view text_;
+    size_t pos_ {0};
+};
+
+uint32_t FindField(const SceneInfoSchema& schema, std::string_view key)
+{
+    for (uint32_t index = 0; index < schema.fieldNum_; ++index) {
+        if (schema.fields_[index].key_ == key) {
+            return index;
+        }
+    }
+    return MAX_SCENE_FIELD_NUM;
+}
+
+bool ConvertField(SceneFieldType type, ValueKind kind, SceneFieldValue& value)
+{
+    switch (type) {
+        case SceneFieldType::STRING:
+            return kind == ValueKind::STRING;
+        case SceneFieldType::INT_STRING:
+            value.num_ = ParseInteger(value.str_);
+            return kind == ValueKind::STRING;
+        case SceneFieldType::INT:
+            value.num_ = ParseInteger(value.str_);
+            return kind == ValueKind::STRING || kind == ValueKind::INTEGER;
+        case SceneFieldType::UINT:
+            value.num_ = ParseInteger(value.str_);
+            return kind == ValueKind::INTEGER && value.str_.front() != '-';
+        default:
+            return false;
+    }
+}
+}
+
+std::string SceneFieldValue::ToString() const
+{
+    if (!isEscaped_) {
+        return std::string(str_);
+    }
+    std::string result;
+    result.reserve(str_.size());
+    for (size_t pos = 0; pos < str_.size(); ++pos) {
+        if (str_[pos] != '\\') {
+            result.push_back(str_[pos]);
+            continue;
+        }
+        char escape = str_[++pos];
+        switch (escape) {
+            case 'b':
+                result.push_back('\b');
+                break;
+            case 'f':
+                result.push_back('\f');
+                break;
+            case 'n':
+                result.push_back('\n');
+                break;
+            case 'r':
+                result.push_back('\r');
+                break;
+            case 't':
+                result.push_back('\t');
+                break;
+            case 'u': {
+                uint32_t codePoint = ReadUnicodeEscape(str_, pos + 1);
+                pos += UNICODE_ESCAPE_LEN;
+                if (codePoint >= HIGH_SURROGATE_BEGIN && codePoint < LOW_SURROGATE_BEGIN &&
+                    pos + UNICODE_ESCAPE_LEN + 2 < str_.size() && str_[pos + 1] == '\\' && str_[pos + 2] == 'u') {
+                    uint32_t lowSurrogate = ReadUnicodeEscape(str_, pos + 3);
+                    if (lowSurrogate >= LOW_SURROGATE_BEGIN && lowSurrogate < SURROGATE_END) {
+                        codePoint = SUPPLEMENTARY_BEGIN + ((codePoint - HIGH_SURROGATE_BEGIN) << SURROGATE_BITS) +
+                            (lowSurrogate - LOW_SURROGATE_BEGIN);
+                        pos += UNICODE_ESCAPE_LEN + 2;
+                    }
+                }
+                if (codePoint >= HIGH_SURROGATE_BEGIN && codePoint < SURROGATE_END) {
+                    codePoint = REPLACEMENT_CHARACTER;
+                }
+                AppendUtf8(result, codePoint);
+                break;
+            }
+            default:
+                // quote, backslash and slash stand for themselves
+                result.push_back(escape);
+                break;
+        }
+    }
+    return result;
+}
+
+SceneDecodeResult SceneInfoDecoder::Decode(std::string_view sceneInfo, const SceneInfoSchema& schema,
+    SceneInfoFields& fields)
+{
+    fields.fill(SceneFieldValue {});
+    std::array<bool, MAX_SCENE_FIELD_NUM> isValid {};
+    SceneInfoReader reader(sceneInfo);
+    if (!reader.Consume('{')) {
+        return SceneDecodeResult::MALFORMED;
+    }
+    if (!reader.Consume('}')) {
+        do {
+            std::string_view key;
+            bool isKeyEscaped = false;
+            if (!reader.ReadString(key, isKeyEscaped) || !reader.Consume(':')) {
+                return SceneDecodeResult::MALFORMED;
+            }
+            uint32_t index = isKeyEscaped ? MAX_SCENE_FIELD_NUM : FindField(schema, key);
+            if (index >= MAX_SCENE_FIELD_NUM) {
+                if (!reader.SkipValue(0)) {
+                    return SceneDecodeResult::MALFORMED;
+                }
+                continue;
+            }
+            SceneFieldValue value {};
+            ValueKind kind = ValueKind::OTHER;
+            if (!reader.ReadValue(kind, value.str_, value.isEscaped_)) {
+                return SceneDecodeResult::MALFORMED;
+            }
+            value.isPresent_ = true;
+            isValid[index] = ConvertField(schema.fields_[index].type_, kind, value);
+            fields[index] = value;
+        } while (reader.Consume(','));
+        if (!reader.Consume('}')) {
+            return SceneDecodeResult::MALFORMED;
+        }
+    }
+    reader.SkipSpace();
+    if (!reader.IsEnd()) {
+        return SceneDecodeResult::MALFORMED;
+    }
+    for (uint32_t index = 0; index < schema.fieldNum_; ++index) {
+        if (schema.fields_[index].isRequired_ && !fields[index].isPresent_) {
+            return SceneDecodeResult::FIELD_MISSING;
+        }
+    }
+    for (uint32_t index = 0; index < schema.fieldNum_; ++index) {
+        if (fields[index].isPresent_ && !isValid[index]) {
+            return SceneDecodeResult::FIELD_INVALID;
+        }
+    }
+    return SceneDecodeResult::OK;
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
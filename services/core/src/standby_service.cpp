@@ -242,6 +242,28 @@ ErrCode StandbyService::UnapplyAllowResource(const ResourceRequest& resourceRequ
     return StandbyServiceImpl::GetInstance()->UnapplyAllowResource(request);
 }
 
+ErrCode StandbyService::ApplyAllowResourceBatch(const std::vector<ResourceRequest>& resourceRequests)
+{
+    StandbyHitraceChain traceChain(__func__);
+    if (state_.load() != ServiceRunningState::STATE_RUNNING) {
+        STANDBYSERVICE_LOGW("standby service is not running");
+        return ERR_STANDBY_SYS_NOT_READY;
+    }
+    std::vector<ResourceRequest> requests(resourceRequests);
+    return StandbyServiceImpl::GetInstance()->ApplyAllowResourceBatch(requests);
+}
+
+ErrCode StandbyService::UnapplyAllowResourceBatch(const std::vector<ResourceRequest>& resourceRequests)
+{
+    StandbyHitraceChain traceChain(__func__);
+    if (state_.load() != ServiceRunningState::STATE_RUNNING) {
+        STANDBYSERVICE_LOGW("standby service is not running");
+        return ERR_STANDBY_SYS_NOT_READY;
+    }
+    std::vector<ResourceRequest> requests(resourceRequests);
+    return StandbyServiceImpl::GetInstance()->UnapplyAllowResourceBatch(requests);
+}
+
 ErrCode StandbyService::GetAllowList(uint32_t allowType, std::vector<AllowInfo>& allowInfoList,
     uint32_t reasonCode)
 {
@@ -263,6 +285,16 @@ ErrCode StandbyService::IsDeviceInStandby(bool& isStandby)
     return StandbyServiceImpl::GetInstance()->IsDeviceInStandby(isStandby);
 }
 
+ErrCode StandbyService::GetStandbyStatePage(int& fd)
+{
+    StandbyHitraceChain traceChain(__func__);
+    if (state_.load() != ServiceRunningState::STATE_RUNNING) {
+        STANDBYSERVICE_LOGW("standby service is not running");
+        return ERR_STANDBY_SYS_NOT_READY;
+    }
+    return StandbyServiceImpl::GetInstance()->GetStandbyStatePage(fd);
+}
+
 ErrCode StandbyService::SetNatInterval(uint32_t type, bool enable, uint32_t interval)
 {
     StandbyHitraceChain traceChain(__func__);
@@ -16,10 +16,10 @@
 #include "standby_service_impl.h"
 
 #include <algorithm>
+#include <chrono>
 #include <dlfcn.h>
-#include <fcntl.h>
-#include <file_ex.h>
 #include <functional>
+#include <limits>
 #include <securec.h>
 #include <set>
 #include <sstream>
@@ -42,6 +42,7 @@
 #include "json_utils.h"
 #include "res_common_util.h"
 #include "res_sched_event_reporter.h"
+#include "scene_info_decoder.h"
 #include "standby_config_manager.h"
 #include "standby_service.h"
 #include "standby_service_log.h"
@@ -58,11 +59,23 @@ namespace OHOS {
 namespace DevStandbyMgr {
 namespace {
 const std::string ALLOW_RECORD_FILE_PATH = "/data/service/el1/public/device_standby/allow_record";
-const std::string CLONE_BACKUP_FILE_PATH = "/data/service/el1/public/device_standby/device_standby_clone";
+const std::string ALLOW_RECORD_JOURNAL_PATH = "/data/service/el1/public/device_standby/allow_record_journal";
+const std::string PERSIST_ALLOW_RECORD_TASK = "PersistAllowRecordTask";
+const int64_t PERSIST_ALLOW_RECORD_DELAY = 1000;
+const std::string EXPIRE_ALLOW_RECORD_TASK = "ExpireAllowRecordTask";
+const int64_t EXPIRY_TICK_MS = 1000;
+const size_t MAX_BATCH_REQUEST_NUM = 1000;
+const std::string NOTIFY_ALLOW_LIST_CHANGED_TASK = "NotifyAllowListChangedTask";
+const std::string TAG_ALLOW_LIST_NOTIFY_DELAY = "allow_list_notify_delay";
+const int32_t ALLOW_LIST_NOTIFY_DELAY = 50;
+const std::string FLUSH_INGRESS_EVENTS_TASK = "FlushIngressEventsTask";
+const std::string TAG_INGRESS_COALESCE_WINDOW = "ingress_coalesce_window";
+const std::string TAG_INGRESS_DEDUP_WINDOW = "ingress_dedup_window";
 const std::string DEVICE_STANDBY_DIR = "/data/service/el1/public/device_standby";
 const std::string DEVICE_STANDBY_RDB_DIR = "/data/service/el3/100/device_standby/rdb";
 const std::string STANDBY_MSG_HANDLER = "StandbyMsgHandler";
 const std::string ON_PLUGIN_REGISTER = "OnPluginRegister";
+const std::string GET_PLUGIN_INTERFACE_VERSION = "GetPluginInterfaceVersion";
 const std::string TAG_PROCESS_ABNORMAL_TIME = "process_abnormal_time";
 const int32_t PROCESS_ABNORMAL_TIME = 20000;
 const std::string STANDBY_EXEMPTION_PERMISSION = "ohos.permission.DEVICE_STANDBY_EXEMPTION";
@@ -72,9 +85,37 @@ const uint32_t ONE_SECOND = 1000;
 const std::string DUMP_ON_POWER_OVERUSED = "--poweroverused";
 const std::string DUMP_ON_ACTION_CHANGED = "--actionchanged";
 const int32_t EXTENSION_ERROR_CODE = 13500099;
+
+// log failures in the wording of the former json based handlers
+bool DecodeSceneInfo(const std::string& sceneInfo, const SceneInfoSchema& schema, SceneInfoFields& fields,
+    const char* paramName)
+{
+    switch (SceneInfoDecoder::Decode(sceneInfo, schema, fields)) {
+        case SceneDecodeResult::OK:
+            return true;
+        case SceneDecodeResult::MALFORMED:
+            STANDBYSERVICE_LOGE("parse json failed");
+            return false;
+        case SceneDecodeResult::FIELD_MISSING:
+            STANDBYSERVICE_LOGE("%{public}s param does not exist", paramName);
+            return false;
+        default:
+            STANDBYSERVICE_LOGE("%{public}s param is invalid", paramName);
+            return false;
+    }
+}
+
+int64_t GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 }
 
-StandbyServiceImpl::StandbyServiceImpl() {}
+StandbyServiceImpl::StandbyServiceImpl()
+{
+    allowRecordJournal_ = std::make_shared<AllowRecordJournal>(ALLOW_RECORD_FILE_PATH, ALLOW_RECORD_JOURNAL_PATH);
+}
 
 StandbyServiceImpl::~StandbyServiceImpl() {}
 
@@ -95,10 +136,15 @@ bool StandbyServiceImpl::Init()
         STANDBYSERVICE_LOGE("standby msg handler create failed");
         return false;
     }
+    // clients fall back to ipc if the page is not available
+    statePage_ = StandbyStatePage::Create();
     if (StandbyConfigManager::GetInstance()->Init() != ERR_OK) {
         STANDBYSERVICE_LOGE("failed to init device standby config manager");
         return false;
     }
+    StandbyStateSubscriber::GetInstance()->Init();
+    ingressFilter_.Reset(StandbyConfigManager::GetInstance()->GetStandbyParam(TAG_INGRESS_COALESCE_WINDOW),
+        StandbyConfigManager::GetInstance()->GetStandbyParam(TAG_INGRESS_DEDUP_WINDOW));
     if (RegisterPlugin(StandbyConfigManager::GetInstance()->GetPluginName()) != ERR_OK
         && RegisterPlugin(DEFAULT_PLUGIN_NAME) != ERR_OK) {
         STANDBYSERVICE_LOGE("register plugin failed");
@@ -113,7 +159,7 @@ bool StandbyServiceImpl::Init()
 void StandbyServiceImpl::InitReadyState()
 {
     STANDBYSERVICE_LOGD("start init necessary plugin");
-    handler_->PostTask([this]() {
+    PostLaneTask(TaskLane::CRITICAL, [this]() {
         if (isServiceReady_.load()) {
             STANDBYSERVICE_LOGW("standby service is already ready, do not need repeat");
             return;
@@ -142,6 +188,7 @@ void StandbyServiceImpl::InitReadyState()
         StandbyService::GetInstance()->AddPluginSysAbilityListener(BACKGROUND_TASK_MANAGER_SERVICE_ID);
         StandbyService::GetInstance()->AddPluginSysAbilityListener(WORK_SCHEDULE_SERVICE_ID);
         StandbyService::GetInstance()->AddPluginSysAbilityListener(MSDP_USER_STATUS_SERVICE_ID);
+        StandbyService::GetInstance()->AddPluginSysAbilityListener(COMM_NET_POLICY_MANAGER_SYS_ABILITY_ID);
         }, AppExecFwk::EventQueue::Priority::HIGH);
 }
 
@@ -203,8 +250,10 @@ ErrCode StandbyServiceImpl::UnregisterAppStateObserver()
 
 void StandbyServiceImpl::DayNightSwitchCallback()
 {
-    handler_->PostTask([standbyImpl = shared_from_this()]() {
+    PostLaneTask(TaskLane::CRITICAL, [standbyImpl = shared_from_this()]() {
         STANDBYSERVICE_LOGD("start day and night switch");
+        TimeProvider::RefreshCondition();
+        standbyImpl->WriteStatePage();
         if (!standbyImpl->isServiceReady_.load()) {
             STANDBYSERVICE_LOGW("standby service is not ready");
             if (!TimedTask::StartDayNightSwitchTimer(standbyImpl->dayNightSwitchTimerId_)) {
@@ -230,11 +279,11 @@ void StandbyServiceImpl::DayNightSwitchCallback()
 ErrCode StandbyServiceImpl::RegisterTimeObserver()
 {
     std::lock_guard<std::recursive_mutex> lock(timerObserverMutex_);
-    handler_->PostTask([=]() {
+    PostLaneTask(TaskLane::CRITICAL, [=]() {
             STANDBYSERVICE_LOGE("Dispatch COMMON_EVENT_TIMER_SA_ABILITY begin");
             StandbyMessage message(StandbyMessageType::COMMON_EVENT, COMMON_EVENT_TIMER_SA_ABILITY);
             StandbyServiceImpl::GetInstance()->DispatchEvent(message);
-        }, ONE_SECOND);
+        }, "", ONE_SECOND);
     if (dayNightSwitchTimerId_ > 0) {
         return ERR_STANDBY_OBSERVER_ALREADY_EXIST;
     }
@@ -310,19 +359,30 @@ ErrCode StandbyServiceImpl::RegisterPlugin(const std::string& pluginName)
     STANDBYSERVICE_LOGI("start register plugin %{public}s", pluginName.c_str());
     registerPlugin_ = dlopen(pluginName.c_str(), RTLD_NOW);
     if (!registerPlugin_) {
-        dlclose(registerPlugin_);
         STANDBYSERVICE_LOGE("failed to open plugin %{public}s", pluginName.c_str());
         return ERR_STANDBY_PLUGIN_NOT_EXIST;
     }
+    // a plugin built against another layout of StandbyMessage must not receive messages of this service
+    void* versionFunc = dlsym(registerPlugin_, GET_PLUGIN_INTERFACE_VERSION.c_str());
+    uint32_t pluginVersion = versionFunc == nullptr ? 0 : reinterpret_cast<uint32_t (*)()>(versionFunc)();
+    if (pluginVersion != STANDBY_PLUGIN_INTERFACE_VERSION) {
+        dlclose(registerPlugin_);
+        registerPlugin_ = nullptr;
+        STANDBYSERVICE_LOGE("plugin %{public}s interface version %{public}u mismatches %{public}u",
+            pluginName.c_str(), pluginVersion, STANDBY_PLUGIN_INTERFACE_VERSION);
+        return ERR_STANDBY_PLUGIN_NOT_AVAILABLE;
+    }
     void* pluginFunc = dlsym(registerPlugin_, ON_PLUGIN_REGISTER.c_str());
     if (!pluginFunc) {
         dlclose(registerPlugin_);
+        registerPlugin_ = nullptr;
         STANDBYSERVICE_LOGE("failed to find extern func of plugin %{public}s", pluginName.c_str());
         return ERR_STANDBY_PLUGIN_NOT_EXIST;
     }
     auto onPluginInitFunc = reinterpret_cast<bool (*)()>(pluginFunc);
     if (!onPluginInitFunc()) {
         dlclose(registerPlugin_);
+        registerPlugin_ = nullptr;
         return ERR_STANDBY_PLUGIN_NOT_AVAILABLE;
     }
     return ERR_OK;
@@ -348,6 +408,22 @@ std::shared_ptr<AppExecFwk::EventHandler>& StandbyServiceImpl::GetHandler()
     return handler_;
 }
 
+bool StandbyServiceImpl::PostLaneTask(TaskLane lane, const std::function<void()>& task, const std::string& name,
+    int64_t delayMs)
+{
+    return taskLaneScheduler_->PostTask(handler_, lane, task, name, delayMs);
+}
+
+bool StandbyServiceImpl::PostLaneSyncTask(TaskLane lane, const std::function<void()>& task)
+{
+    return taskLaneScheduler_->PostSyncTask(handler_, lane, task);
+}
+
+void StandbyServiceImpl::RemoveLaneTask(const std::string& name)
+{
+    taskLaneScheduler_->RemoveTask(handler_, name);
+}
+
 std::shared_ptr<IConstraintManagerAdapter>& StandbyServiceImpl::GetConstraintManager()
 {
     return constraintManager_;
@@ -368,9 +444,36 @@ std::shared_ptr<IStateManagerAdapter>& StandbyServiceImpl::GetStateManager()
     return standbyStateManager_;
 }
 
+void StandbyServiceImpl::PublishStandbyState(uint32_t state, uint32_t phase)
+{
+    standbyStateSnapshot_.Publish(state, phase);
+    WriteStatePage();
+}
+
+void StandbyServiceImpl::WriteStatePage()
+{
+    uint32_t state = StandbyState::WORKING;
+    uint32_t phase = 0;
+    if (!standbyStateSnapshot_.Load(state, phase)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(statePageMutex_);
+    if (statePage_ != nullptr) {
+        statePage_->Write(state, phase, TimeProvider::GetCondition());
+    }
+}
+
+void StandbyServiceImpl::UnpublishStatePage()
+{
+    std::lock_guard<std::mutex> lock(statePageMutex_);
+    if (statePage_ != nullptr) {
+        statePage_->Unpublish();
+    }
+}
+
 void StandbyServiceImpl::UninitReadyState()
 {
-    handler_->PostTask([this]() {
+    PostLaneTask(TaskLane::CRITICAL, [this]() {
         if (!isServiceReady_.load()) {
             STANDBYSERVICE_LOGW("standby service is already not ready, do not need uninit");
             return;
@@ -380,8 +483,10 @@ void StandbyServiceImpl::UninitReadyState()
         constraintManager_->UnInit();
         strategyManager_->UnInit();
         standbyStateManager_->UnInit();
+        standbyStateSnapshot_.Reset();
+        UnpublishStatePage();
         isServiceReady_.store(false);
-        }, AppExecFwk::EventQueue::Priority::HIGH);
+        });
 }
 
 bool StandbyServiceImpl::ParsePersistentData()
@@ -393,28 +498,27 @@ bool StandbyServiceImpl::ParsePersistentData()
         return false;
     }
     nlohmann::json root;
-    if (!JsonUtils::LoadJsonValueFromFile(root, ALLOW_RECORD_FILE_PATH)) {
+    if (!allowRecordJournal_->Load(root)) {
         STANDBYSERVICE_LOGE("failed to load allow record from file");
         return false;
     }
 
     std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
+    allowRecordIndex_.Clear();
     for (auto iter = root.begin(); iter != root.end(); ++iter) {
-        std::shared_ptr<AllowRecord> recordPtr = std::make_shared<AllowRecord>();
-        if (recordPtr->ParseFromJson(iter.value())) {
-            allowInfoMap_.emplace(iter.key(), recordPtr);
+        AllowRecord allowRecord;
+        if (!allowRecord.ParseFromJson(iter.value())) {
+            continue;
         }
-    }
-    for (auto iter = allowInfoMap_.begin(); iter != allowInfoMap_.end();) {
-        auto pidNameIter = pidNameMap.find(iter->second->pid_);
-        if (pidNameIter == pidNameMap.end() || pidNameIter->second != iter->second->name_) {
-            allowInfoMap_.erase(iter++);
-        } else {
-            iter++;
+        auto pidNameIter = pidNameMap.find(allowRecord.pid_);
+        if (pidNameIter == pidNameMap.end() || pidNameIter->second != allowRecord.name_) {
+            continue;
         }
+        allowRecordIndex_.Insert(allowRecord);
     }
 
-    STANDBYSERVICE_LOGI("after reboot, allowInfoMap_ size is %{public}d", static_cast<int32_t>(allowInfoMap_.size()));
+    STANDBYSERVICE_LOGI("after reboot, allow record size is %{public}d",
+        static_cast<int32_t>(allowRecordIndex_.Size()));
     RecoverTimeLimitedTask();
     DumpPersistantData();
     return true;
@@ -447,32 +551,101 @@ void StandbyServiceImpl::GetPidAndProcName(std::unordered_map<int32_t, std::stri
 void StandbyServiceImpl::RecoverTimeLimitedTask()
 {
     STANDBYSERVICE_LOGD("start to recovery delayed task");
-    const auto &mgr = shared_from_this();
-    for (auto iter = allowInfoMap_.begin(); iter != allowInfoMap_.end(); ++iter) {
-        auto &allowTimeList = iter->second->allowTimeList_;
-        for (auto allowTimeIter = allowTimeList.begin(); allowTimeIter != allowTimeList.end(); ++allowTimeIter) {
-            auto task = [mgr, uid = iter->second->uid_, name = iter->second->name_] () {
-                mgr->UnapplyAllowResInner(uid, name, MAX_ALLOW_TYPE_NUMBER, false);
-            };
-            int32_t timeOut = static_cast<int32_t>(allowTimeIter->endTime_ -
-                MiscServices::TimeServiceClient::GetInstance()->GetMonotonicTimeMs());
-            handler_->PostTask(task, std::max(0, timeOut));
+    allowExpiryIndex_.Clear();
+    allowRecordIndex_.ForEach([this](AllowRecord& allowRecord) {
+        for (uint32_t allowTypeIndex = 0; allowTypeIndex < ALLOW_TIME_SLOT_NUM; ++allowTypeIndex) {
+            const AllowTime* allowTime = allowRecord.GetAllowTime(allowTypeIndex);
+            if (allowTime != nullptr) {
+                allowExpiryIndex_.Update(allowRecord.uid_, allowRecord.name_, allowTypeIndex, allowTime->endTime_);
+            }
         }
+    });
+    armedExpiryDeadline_ = AllowExpiryIndex::NO_DEADLINE;
+    ArmExpiryTimer();
+}
+
+void StandbyServiceImpl::ArmExpiryTimer()
+{
+    int64_t earliestDeadline = allowExpiryIndex_.GetEarliestDeadline();
+    if (earliestDeadline == AllowExpiryIndex::NO_DEADLINE) {
+        RemoveLaneTask(EXPIRE_ALLOW_RECORD_TASK);
+        armedExpiryDeadline_ = AllowExpiryIndex::NO_DEADLINE;
+        return;
     }
+    // deadlines are rounded up to a tick, so expiries landing on the same tick are handled in one batch
+    int64_t tickDeadline = (earliestDeadline + EXPIRY_TICK_MS - 1) / EXPIRY_TICK_MS * EXPIRY_TICK_MS;
+    if (tickDeadline == armedExpiryDeadline_) {
+        return;
+    }
+    RemoveLaneTask(EXPIRE_ALLOW_RECORD_TASK);
+    int64_t curTime = MiscServices::TimeServiceClient::GetInstance()->GetBootTimeMs();
+    PostLaneTask(TaskLane::STRATEGY, [this]() { this->HandleExpiredRecords(); }, EXPIRE_ALLOW_RECORD_TASK,
+        std::max(static_cast<int64_t>(0), tickDeadline - curTime));
+    armedExpiryDeadline_ = tickDeadline;
+}
+
+void StandbyServiceImpl::HandleExpiredRecords()
+{
+    std::vector<AllowExpiryEntry> expiredEntries;
+    {
+        std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
+        armedExpiryDeadline_ = AllowExpiryIndex::NO_DEADLINE;
+        expiredEntries = allowExpiryIndex_.PopExpired(
+            MiscServices::TimeServiceClient::GetInstance()->GetBootTimeMs());
+    }
+    STANDBYSERVICE_LOGD("handle %{public}d expired allow records", static_cast<int32_t>(expiredEntries.size()));
+    std::map<std::pair<int32_t, std::string>, uint32_t> expiredAllowTypes;
+    for (const auto& entry : expiredEntries) {
+        expiredAllowTypes[std::make_pair(entry.uid_, entry.name_)] |= (1 << entry.allowTypeIndex_);
+    }
+    UnapplyAllowResBatchInner(expiredAllowTypes, false);
+    std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
+    ArmExpiryTimer();
 }
 
 void StandbyServiceImpl::DumpPersistantData()
 {
-    nlohmann::json root;
+    nlohmann::json root = nlohmann::json::object();
     STANDBYSERVICE_LOGD("dump persistant data");
-    for (auto& [uid, allowInfo] : allowInfoMap_) {
-        root[uid] = allowInfo->ParseToJson();
+    allowRecordIndex_.ForEach([&root](AllowRecord& allowRecord) {
+        root[AllowRecordIndex::GetRecordKey(allowRecord.uid_, allowRecord.name_)] = allowRecord.ParseToJson();
+    });
+    allowRecordJournal_->Compact(root);
+}
+
+void StandbyServiceImpl::SchedulePersistTask()
+{
+    if (persistTaskPosted_.exchange(true)) {
+        return;
+    }
+    PostLaneTask(TaskLane::BACKGROUND, [this]() { this->FlushPersistantData(); },
+        PERSIST_ALLOW_RECORD_TASK, PERSIST_ALLOW_RECORD_DELAY);
+}
+
+void StandbyServiceImpl::FlushPersistantData()
+{
+    persistTaskPosted_.store(false);
+    if (!allowRecordJournal_->Flush()) {
+        SchedulePersistTask();
+        return;
+    }
+    if (!allowRecordJournal_->NeedsCompaction()) {
+        return;
+    }
+    nlohmann::json root = nlohmann::json::object();
+    {
+        std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
+        allowRecordIndex_.ForEach([&root](AllowRecord& allowRecord) {
+            root[AllowRecordIndex::GetRecordKey(allowRecord.uid_, allowRecord.name_)] = allowRecord.ParseToJson();
+        });
     }
-    JsonUtils::DumpJsonValueToFile(root, ALLOW_RECORD_FILE_PATH);
+    allowRecordJournal_->Compact(root);
 }
 
 void StandbyServiceImpl::UnInit()
 {
+    allowRecordJournal_->Flush();
+    StandbyStateSubscriber::GetInstance()->UnInit();
     if (!registerPlugin_) {
         dlclose(registerPlugin_);
         registerPlugin_ = nullptr;
@@ -486,7 +659,8 @@ ErrCode StandbyServiceImpl::SubscribeBackupRestoreCallback(const std::string& mo
     const std::function<ErrCode(std::vector<char>&)>& onRestoreFunc)
 {
     std::lock_guard<std::mutex> lock(backupRestoreMutex_);
-    if (onBackupFuncMap_.find(moduleName) != onBackupFuncMap_.end()) {
+    if (onBackupFuncMap_.find(moduleName) != onBackupFuncMap_.end() ||
+        onStreamBackupFuncMap_.find(moduleName) != onStreamBackupFuncMap_.end()) {
         STANDBYSERVICE_LOGE("Repeat subscribe backup restore callback, module name: %{public}s", moduleName.c_str());
         return ERR_INVALID_OPERATION;
     }
@@ -496,97 +670,103 @@ ErrCode StandbyServiceImpl::SubscribeBackupRestoreCallback(const std::string& mo
     return ERR_OK;
 }
 
+ErrCode StandbyServiceImpl::SubscribeStreamBackupRestoreCallback(const std::string& moduleName,
+    const CloneBackupFunc& onBackupFunc, const CloneRestoreFunc& onRestoreFunc)
+{
+    if (moduleName.size() >= CLONE_MODULE_NAME_LEN) {
+        STANDBYSERVICE_LOGE("module name of backup restore callback is too long: %{public}s", moduleName.c_str());
+        return ERR_INVALID_VALUE;
+    }
+    std::lock_guard<std::mutex> lock(backupRestoreMutex_);
+    if (onBackupFuncMap_.find(moduleName) != onBackupFuncMap_.end() ||
+        onStreamBackupFuncMap_.find(moduleName) != onStreamBackupFuncMap_.end()) {
+        STANDBYSERVICE_LOGE("Repeat subscribe backup restore callback, module name: %{public}s", moduleName.c_str());
+        return ERR_INVALID_OPERATION;
+    }
+
+    onStreamBackupFuncMap_.insert(std::make_pair(moduleName, onBackupFunc));
+    onStreamRestoreFuncMap_.insert(std::make_pair(moduleName, onRestoreFunc));
+    return ERR_OK;
+}
+
 ErrCode StandbyServiceImpl::UnsubscribeBackupRestoreCallback(const std::string& moduleName)
 {
     std::lock_guard<std::mutex> lock(backupRestoreMutex_);
     onBackupFuncMap_.erase(moduleName);
     onRestoreFuncMap_.erase(moduleName);
+    onStreamBackupFuncMap_.erase(moduleName);
+    onStreamRestoreFuncMap_.erase(moduleName);
     return ERR_OK;
 }
 
 ErrCode StandbyServiceImpl::OnBackup(MessageParcel& data, MessageParcel& reply)
 {
-    UniqueFd fd(-1);
     std::string replyCode = BuildBackupReplyCode(0);
-    std::vector<char> buff;
+    UniqueFd fd(-1);
     {
         std::lock_guard<std::mutex> lock(backupRestoreMutex_);
-        for (const auto& [moduleName, func] : onBackupFuncMap_) {
-            std::vector<char> moduleBuff;
-            CloneFileHead head {};
-            ErrCode err = func(moduleBuff);
-            if (err != ERR_OK ||
-                strncpy_s(head.moduleName, sizeof(head.moduleName), moduleName.c_str(), moduleName.size()) != 0) {
-                continue;
+        CloneStreamWriter writer;
+        if (writer.Open()) {
+            for (const auto& [moduleName, func] : onStreamBackupFuncMap_) {
+                writer.WriteModule(moduleName, func);
+            }
+            for (const auto& [moduleName, func] : onBackupFuncMap_) {
+                // callbacks of the former API still build the whole module data in a vector
+                writer.WriteModule(moduleName, [&func](CloneSectionWriter& sectionWriter) -> ErrCode {
+                    std::vector<char> moduleBuff;
+                    ErrCode err = func(moduleBuff);
+                    if (err != ERR_OK) {
+                        return err;
+                    }
+                    return sectionWriter.Write(moduleBuff.data(), moduleBuff.size()) ? ERR_OK : ERR_INVALID_OPERATION;
+                });
             }
-            head.fileOffset = buff.size();
-            head.fileSize = moduleBuff.size();
-            std::copy(reinterpret_cast<char*>(&head), reinterpret_cast<char*>(&head) + sizeof(CloneFileHead),
-                std::back_inserter(buff));
-            buff.insert(buff.end(), moduleBuff.begin(), moduleBuff.end());
+            fd = writer.Finish();
         }
     }
-    if (buff.size() != 0 && SaveBufferToFile(CLONE_BACKUP_FILE_PATH, buff)) {
-        fd = UniqueFd(open(CLONE_BACKUP_FILE_PATH.c_str(), O_RDONLY));
-    } else {
-        STANDBYSERVICE_LOGE("OnBackup fail: save buff to file fail");
+    if (fd.Get() < 0) {
+        STANDBYSERVICE_LOGE("OnBackup fail: write clone data fail");
         replyCode  = BuildBackupReplyCode(EXTENSION_ERROR_CODE);
     }
 
     if ((!reply.WriteFileDescriptor(fd)) || (!reply.WriteString(replyCode))) {
-        close(fd.Release());
-        int32_t ret = remove(CLONE_BACKUP_FILE_PATH.c_str());
-        STANDBYSERVICE_LOGE("OnBackup fail: reply write fail! remove ret: %{public}d", ret);
+        STANDBYSERVICE_LOGE("OnBackup fail: reply write fail!");
         return ERR_INVALID_OPERATION;
     }
-    close(fd.Release());
-    int32_t ret = remove(CLONE_BACKUP_FILE_PATH.c_str());
-    STANDBYSERVICE_LOGI("OnBackup succ: backup data success! remove ret: %{public}d", ret);
+    STANDBYSERVICE_LOGI("OnBackup succ: backup data success!");
     return ERR_OK;
 }
 
 ErrCode StandbyServiceImpl::OnRestore(MessageParcel& data, MessageParcel& reply)
 {
     std::string replyCode = BuildBackupReplyCode(0);
-    std::vector<char> buff;
     UniqueFd fd(data.ReadFileDescriptor());
     if (fd.Get() < 0) {
         STANDBYSERVICE_LOGE("OnRestore fail: ReadFileDescriptor fail");
         return ERR_INVALID_OPERATION;
     }
-    const off_t fileLength = lseek(fd.Get(), 0, SEEK_END);
-    lseek(fd, 0, SEEK_SET);
-    buff.resize(fileLength);
-    const ssize_t len = read(fd, buff.data(), fileLength);
-    if (len == fileLength && fileLength != 0) {
+    CloneStreamReader cloneReader;
+    if (cloneReader.Open(fd.Get())) {
         std::lock_guard<std::mutex> lock(backupRestoreMutex_);
-        off_t offset = 0;
-        while (offset + static_cast<off_t>(sizeof(CloneFileHead)) < fileLength) {
-            CloneFileHead* head = reinterpret_cast<CloneFileHead*>(buff.data() + offset);
-            head->moduleName[sizeof(CloneFileHead::moduleName) - 1] = '\0';
-            if (offset + static_cast<off_t>(sizeof(CloneFileHead) + head->fileSize) > fileLength) {
-                break;
+        cloneReader.ForEachSection([this](const std::string& moduleName, std::string_view section) {
+            if (auto iter = onStreamRestoreFuncMap_.find(moduleName); iter != onStreamRestoreFuncMap_.end()) {
+                iter->second(section);
+                return;
             }
-            const auto& onRestoreFunc = onRestoreFuncMap_.find(std::string(head->moduleName));
-            if (onRestoreFunc != onRestoreFuncMap_.end()) {
-                std::vector<char> moduleBuff;
-                std::copy(reinterpret_cast<char*>(&head->data), reinterpret_cast<char*>(&head->data) + head->fileSize,
-                    std::back_inserter(moduleBuff));
-                (onRestoreFunc->second)(moduleBuff);
+            if (auto iter = onRestoreFuncMap_.find(moduleName); iter != onRestoreFuncMap_.end()) {
+                std::vector<char> moduleBuff(section.begin(), section.end());
+                iter->second(moduleBuff);
             }
-            offset += static_cast<off_t>(sizeof(CloneFileHead) + head->fileSize);
-        }
+        });
     } else {
         STANDBYSERVICE_LOGE("OnRestore fail: get file fail");
         replyCode  = BuildBackupReplyCode(EXTENSION_ERROR_CODE);
     }
 
     if (!reply.WriteString(replyCode)) {
-        close(fd.Release());
         STANDBYSERVICE_LOGE("OnRestore fail: reply write fail!");
         return ERR_INVALID_OPERATION;
     }
-    close(fd.Release());
     STANDBYSERVICE_LOGI("OnRestore succ: reply write success!");
     return ERR_OK;
 }
@@ -628,7 +808,8 @@ ErrCode StandbyServiceImpl::CheckCallerPermission(uint32_t reasonCode)
     int32_t uid = IPCSkeleton::GetCallingUid();
     STANDBYSERVICE_LOGD("check caller permission, uid of caller is %{public}d", uid);
     Security::AccessToken::AccessTokenID tokenId = OHOS::IPCSkeleton::GetCallingTokenID();
-    if (Security::AccessToken::AccessTokenKit::GetTokenType(tokenId)
+    // the type is decoded from the token id without ipc
+    if (Security::AccessToken::AccessTokenKit::GetTokenTypeFlag(tokenId)
         == Security::AccessToken::ATokenTypeEnum::TOKEN_HAP) {
         return IsSystemAppWithPermission(uid, tokenId, reasonCode);
     }
@@ -638,9 +819,13 @@ ErrCode StandbyServiceImpl::CheckCallerPermission(uint32_t reasonCode)
 ErrCode StandbyServiceImpl::IsSystemAppWithPermission(int32_t uid,
     Security::AccessToken::AccessTokenID tokenId, uint32_t reasonCode)
 {
-    Security::AccessToken::AccessTokenID callerToken = IPCSkeleton::GetCallingTokenID();
-    if (Security::AccessToken::AccessTokenKit::VerifyAccessToken(callerToken, STANDBY_EXEMPTION_PERMISSION)
-        != Security::AccessToken::PermissionState::PERMISSION_GRANTED) {
+    bool isGranted = false;
+    if (!callerPermissionCache_.Get(tokenId, isGranted)) {
+        isGranted = Security::AccessToken::AccessTokenKit::VerifyAccessToken(tokenId, STANDBY_EXEMPTION_PERMISSION)
+            == Security::AccessToken::PermissionState::PERMISSION_GRANTED;
+        callerPermissionCache_.Put(tokenId, isGranted);
+    }
+    if (!isGranted) {
         STANDBYSERVICE_LOGE("CheckPermission: ohos.permission.DEVICE_STANDBY_EXEMPTION failed");
         return ERR_STANDBY_PERMISSION_DENIED;
     }
@@ -659,18 +844,23 @@ ErrCode StandbyServiceImpl::IsSystemAppWithPermission(int32_t uid,
 }
 
 uint32_t StandbyServiceImpl::GetExemptedResourceType(uint32_t resourceType)
+{
+    return GetExemptedResourceMask() & resourceType;
+}
+
+uint32_t StandbyServiceImpl::GetExemptedResourceMask()
 {
     int32_t uid = IPCSkeleton::GetCallingUid();
     auto bundleName = BundleManagerHelper::GetInstance()->GetClientBundleName(uid);
     const std::vector<int32_t>& resourcesApply = QueryRunningResourcesApply(uid, bundleName);
 
-    uint32_t exemptedResourceType = 0;
+    uint32_t exemptedResourceMask = 0;
     if (resourcesApply.empty()) {
-        return exemptedResourceType;
+        return exemptedResourceMask;
     }
 
     if (std::find(resourcesApply.begin(), resourcesApply.end(), EXEMPT_ALL_RESOURCES) != resourcesApply.end()) {
-        return resourceType;
+        return std::numeric_limits<uint32_t>::max();
     }
 
     // traverse resourcesApply and get exempted resource type
@@ -679,11 +869,9 @@ uint32_t StandbyServiceImpl::GetExemptedResourceType(uint32_t resourceType)
             continue;
         }
         // maps number in resourceApply to resourceType defined in allow_type.h
-        exemptedResourceType |= (1 << (resourceType - EXEMPT_ALL_RESOURCES - 1));
+        exemptedResourceMask |= (1 << (resourceType - EXEMPT_ALL_RESOURCES - 1));
     }
-    exemptedResourceType &= resourceType;
-
-    return exemptedResourceType;
+    return exemptedResourceMask;
 }
 
 // meaning of number in resourcesApply list: 100 - all type of resources, 101 - NETWORK,
@@ -773,6 +961,17 @@ ErrCode StandbyServiceImpl::ApplyAllowResource(ResourceRequest& resourceRequest)
 }
 
 void StandbyServiceImpl::ApplyAllowResInner(const ResourceRequest& resourceRequest, int32_t pid)
+{
+    std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
+    uint32_t addedAllowType = ApplyAllowRecordLocked(resourceRequest, pid);
+    ArmExpiryTimer();
+    if (addedAllowType != 0) {
+        QueueAllowListChange(resourceRequest.GetUid(), resourceRequest.GetName(), addedAllowType, true);
+    }
+    SchedulePersistTask();
+}
+
+uint32_t StandbyServiceImpl::ApplyAllowRecordLocked(const ResourceRequest& resourceRequest, int32_t pid)
 {
     STANDBYSERVICE_LOGI("apply res inner, uid: %{public}d, name: %{public}s, allowType: %{public}u,"\
         " duration: %{public}d, reason: %{public}s", resourceRequest.GetUid(),
@@ -781,37 +980,122 @@ void StandbyServiceImpl::ApplyAllowResInner(const ResourceRequest& resourceReque
 
     int32_t uid = resourceRequest.GetUid();
     const std::string& name = resourceRequest.GetName();
-    std::string keyStr = std::to_string(uid) + "_" + name;
     uint32_t preAllowType = 0;
 
-    std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
-    auto iter = allowInfoMap_.find(keyStr);
-    if (iter == allowInfoMap_.end()) {
-        std::tie(iter, std::ignore) =
-            allowInfoMap_.emplace(keyStr, std::make_shared<AllowRecord>(uid, pid, name, 0));
-        iter->second->reasonCode_ = resourceRequest.GetReasonCode();
+    auto [slot, inserted] = allowRecordIndex_.Emplace(uid, pid, name);
+    AllowRecord& allowRecord = allowRecordIndex_.Get(slot);
+    if (inserted) {
+        allowRecord.reasonCode_ = resourceRequest.GetReasonCode();
     } else {
-        preAllowType = iter->second->allowType_;
-        iter->second->pid_ = pid;
+        preAllowType = allowRecord.allowType_;
+        allowRecord.pid_ = pid;
     }
-    UpdateRecord(iter->second, resourceRequest);
-    if (preAllowType != iter->second->allowType_) {
-        uint32_t alowTypeDiff = iter->second->allowType_ ^ (preAllowType &
-            iter->second->allowType_);
+    UpdateRecord(allowRecord, resourceRequest);
+    allowRecordIndex_.Sync(slot);
+    uint32_t alowTypeDiff = allowRecord.allowType_ ^ (preAllowType & allowRecord.allowType_);
+    if (alowTypeDiff != 0) {
         STANDBYSERVICE_LOGI("after update record, there is added exemption type: %{public}d",
             alowTypeDiff);
-        StandbyStateSubscriber::GetInstance()->ReportAllowListChanged(uid, name, alowTypeDiff, true);
-        NotifyAllowListChanged(uid, name, alowTypeDiff, true);
     }
-    if (iter->second->allowType_ == 0) {
+    std::string keyStr = AllowRecordIndex::GetRecordKey(uid, name);
+    if (allowRecord.allowType_ == 0) {
         STANDBYSERVICE_LOGI("%{public}s does not have valid record, delete record", keyStr.c_str());
-        allowInfoMap_.erase(iter);
+        allowRecordIndex_.Erase(slot);
+        allowRecordJournal_->RecordRemove(keyStr);
+    } else {
+        allowRecordJournal_->RecordUpdate(keyStr, allowRecord.ParseToJson());
     }
-    DumpPersistantData();
+    return alowTypeDiff;
+}
+
+ErrCode StandbyServiceImpl::ApplyAllowResourceBatch(std::vector<ResourceRequest>& resourceRequests)
+{
+    if (!IsServiceReady()) {
+        return ERR_STANDBY_SYS_NOT_READY;
+    }
+    STANDBYSERVICE_LOGD("start ApplyAllowResourceBatch");
+    if (auto checkRet = CheckBatchResourceRequest(resourceRequests, true); checkRet != ERR_OK) {
+        return checkRet;
+    }
+    int32_t pid = IPCSkeleton::GetCallingPid();
+    std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
+    for (const auto& resourceRequest : resourceRequests) {
+        uint32_t addedAllowType = ApplyAllowRecordLocked(resourceRequest, pid);
+        if (addedAllowType != 0) {
+            QueueAllowListChange(resourceRequest.GetUid(), resourceRequest.GetName(), addedAllowType, true);
+        }
+    }
+    ArmExpiryTimer();
+    SchedulePersistTask();
+    return ERR_OK;
+}
+
+ErrCode StandbyServiceImpl::CheckBatchResourceRequest(std::vector<ResourceRequest>& resourceRequests,
+    bool isApply)
+{
+    if (resourceRequests.empty() || resourceRequests.size() > MAX_BATCH_REQUEST_NUM) {
+        STANDBYSERVICE_LOGE("size of resource requests is invalid: %{public}d",
+            static_cast<int32_t>(resourceRequests.size()));
+        return ERR_STANDBY_INVALID_PARAM;
+    }
+    // permission only depends on the reason code, check each reason code of the batch once
+    std::set<uint32_t> checkedReasonCodes;
+    bool isHap = Security::AccessToken::AccessTokenKit::GetTokenType(OHOS::IPCSkeleton::GetCallingTokenID())
+        == Security::AccessToken::ATokenTypeEnum::TOKEN_HAP;
+    // the exempted resources only depend on the caller, query the bundle manager once for the whole batch
+    uint32_t exemptedResourceMask = isHap ? GetExemptedResourceMask() : 0;
+    for (auto& resourceRequest : resourceRequests) {
+        if (checkedReasonCodes.insert(resourceRequest.GetReasonCode()).second) {
+            if (auto checkRet = CheckCallerPermission(resourceRequest.GetReasonCode()); checkRet != ERR_OK) {
+                return checkRet;
+            }
+        }
+        // update allow type according to configuration
+        if (isHap) {
+            resourceRequest.SetAllowType(resourceRequest.GetAllowType() & exemptedResourceMask);
+        }
+        if (!CheckAllowTypeInfo(resourceRequest.GetAllowType()) || resourceRequest.GetUid() < 0) {
+            STANDBYSERVICE_LOGE("resourceRequest param is invalid");
+            return ERR_RESOURCE_TYPES_INVALID;
+        }
+        if (isApply && resourceRequest.GetDuration() < 0) {
+            STANDBYSERVICE_LOGE("duration param is invalid");
+            return ERR_DURATION_INVALID;
+        }
+    }
+    return ERR_OK;
+}
+
+void StandbyServiceImpl::QueueAllowListChange(int32_t uid, const std::string& name, uint32_t allowType, bool added)
+{
+    allowListChangeAggregator_.Add(uid, name, allowType, added);
+    if (allowListNotifyPosted_) {
+        return;
+    }
+    int32_t notifyDelay = StandbyConfigManager::GetInstance()->GetStandbyParam(TAG_ALLOW_LIST_NOTIFY_DELAY);
+    notifyDelay = (notifyDelay <= 0) ? ALLOW_LIST_NOTIFY_DELAY : notifyDelay;
+    PostLaneTask(TaskLane::STRATEGY, [this]() { this->FlushAllowListChanges(); }, NOTIFY_ALLOW_LIST_CHANGED_TASK,
+        notifyDelay);
+    allowListNotifyPosted_ = true;
 }
 
-void StandbyServiceImpl::UpdateRecord(std::shared_ptr<AllowRecord>& allowRecord,
-    const ResourceRequest& resourceRequest)
+void StandbyServiceImpl::FlushAllowListChanges()
+{
+    std::vector<AllowListChange> changes;
+    {
+        std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
+        allowListNotifyPosted_ = false;
+        changes = allowListChangeAggregator_.Drain();
+    }
+    if (changes.empty()) {
+        STANDBYSERVICE_LOGD("allow list changes cancel out, no need to notify");
+        return;
+    }
+    StandbyStateSubscriber::GetInstance()->ReportAllowListChanged(changes);
+    NotifyAllowListChanged(changes);
+}
+
+void StandbyServiceImpl::UpdateRecord(AllowRecord& allowRecord, const ResourceRequest& resourceRequest)
 {
     int32_t uid = resourceRequest.GetUid();
     const std::string& name = resourceRequest.GetName();
@@ -839,20 +1123,17 @@ void StandbyServiceImpl::UpdateRecord(std::shared_ptr<AllowRecord>& allowRecord,
             continue;
         }
         endTime = curTime + maxDuration;
-        auto& allowTimeList = allowRecord->allowTimeList_;
-        auto findRecordTask = [allowTypeIndex](const auto& it) { return it.allowTypeIndex_ == allowTypeIndex; };
-        auto it = std::find_if(allowTimeList.begin(), allowTimeList.end(), findRecordTask);
-        if (it == allowTimeList.end()) {
-            allowTimeList.emplace_back(AllowTime {allowTypeIndex, endTime, resourceRequest.GetReason()});
+        AllowTime* allowTime = allowRecord.GetAllowTime(allowTypeIndex);
+        if (allowTime == nullptr) {
+            allowRecord.SetAllowTime(AllowTime {allowTypeIndex, endTime, resourceRequest.GetReason()});
         } else {
-            it->reason_ = resourceRequest.GetReason();
-            it->endTime_ = std::max(it->endTime_, endTime);
+            allowTime->reason_ = resourceRequest.GetReason();
+            allowTime->endTime_ = std::max(allowTime->endTime_, endTime);
+            endTime = allowTime->endTime_;
         }
-        allowRecord->allowType_ = (allowRecord->allowType_ | allowNumber);
-        auto task = [this, uid, name, allowType] () {
-            this->UnapplyAllowResInner(uid, name, allowType, false);
-        };
-        handler_->PostTask(task, maxDuration);
+        allowRecord.allowType_ = (allowRecord.allowType_ | allowNumber);
+        // re-applying moves the existing deadline instead of queueing another expiry task
+        allowExpiryIndex_.Update(uid, name, allowTypeIndex, endTime);
     }
     STANDBYSERVICE_LOGE("update end time of allow list");
 }
@@ -881,50 +1162,96 @@ ErrCode StandbyServiceImpl::UnapplyAllowResource(ResourceRequest& resourceReques
     return ERR_OK;
 }
 
+ErrCode StandbyServiceImpl::UnapplyAllowResourceBatch(std::vector<ResourceRequest>& resourceRequests)
+{
+    if (!IsServiceReady()) {
+        return ERR_STANDBY_SYS_NOT_READY;
+    }
+    STANDBYSERVICE_LOGD("start UnapplyAllowResourceBatch");
+    if (auto checkRet = CheckBatchResourceRequest(resourceRequests, false); checkRet != ERR_OK) {
+        return checkRet;
+    }
+    std::map<std::pair<int32_t, std::string>, uint32_t> unapplyAllowTypes;
+    for (const auto& resourceRequest : resourceRequests) {
+        unapplyAllowTypes[std::make_pair(resourceRequest.GetUid(), resourceRequest.GetName())] |=
+            resourceRequest.GetAllowType();
+    }
+    UnapplyAllowResBatchInner(unapplyAllowTypes, true);
+    return ERR_OK;
+}
+
 void StandbyServiceImpl::UnapplyAllowResInner(int32_t uid, const std::string& name,
     uint32_t allowType, bool removeAll)
+{
+    std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
+    uint32_t removedNumber = UnapplyAllowRecordLocked(uid, name, allowType, removeAll);
+    if (removedNumber == 0) {
+        return;
+    }
+    QueueAllowListChange(uid, name, removedNumber, false);
+    SchedulePersistTask();
+}
+
+void StandbyServiceImpl::UnapplyAllowResBatchInner(
+    const std::map<std::pair<int32_t, std::string>, uint32_t>& unapplyAllowTypes, bool removeAll)
+{
+    bool isRemoved = false;
+    std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
+    for (const auto& [record, allowType] : unapplyAllowTypes) {
+        uint32_t removedNumber = UnapplyAllowRecordLocked(record.first, record.second, allowType, removeAll);
+        if (removedNumber != 0) {
+            QueueAllowListChange(record.first, record.second, removedNumber, false);
+            isRemoved = true;
+        }
+    }
+    if (isRemoved) {
+        SchedulePersistTask();
+    }
+}
+
+uint32_t StandbyServiceImpl::UnapplyAllowRecordLocked(int32_t uid, const std::string& name,
+    uint32_t allowType, bool removeAll)
 {
     STANDBYSERVICE_LOGD("start UnapplyAllowResInner, uid is %{public}d, allowType is %{public}d, removeAll is "\
         "%{public}d", uid, allowType, removeAll);
-    std::string keyStr = std::to_string(uid) + "_" + name;
 
-    std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
-    auto iter = allowInfoMap_.find(keyStr);
-    if (iter == allowInfoMap_.end()) {
+    uint32_t slot = allowRecordIndex_.Find(uid, name);
+    if (slot == AllowRecordIndex::INVALID_SLOT) {
         STANDBYSERVICE_LOGD("uid has no corresponding allow list");
-        return;
+        return 0;
     }
-    if ((allowType & iter->second->allowType_) == 0) {
+    AllowRecord& allowRecord = allowRecordIndex_.Get(slot);
+    if ((allowType & allowRecord.allowType_) == 0) {
         STANDBYSERVICE_LOGD("allow list has no corresponding allow type");
-        return;
+        return 0;
     }
-    auto& allowRecordPtr = iter->second;
-    auto& allowTimeList = allowRecordPtr->allowTimeList_;
     uint32_t removedNumber = 0;
     int64_t curTime = MiscServices::TimeServiceClient::GetInstance()->GetBootTimeMs();
-    for (auto it = allowTimeList.begin(); it != allowTimeList.end();) {
-        uint32_t allowNumber = allowType & (1 << it->allowTypeIndex_);
-        if (allowNumber != 0 && (removeAll || curTime >= it->endTime_)) {
-            it = allowTimeList.erase(it);
+    for (uint32_t allowTypeIndex = 0; allowTypeIndex < ALLOW_TIME_SLOT_NUM; ++allowTypeIndex) {
+        uint32_t allowNumber = allowType & (1 << allowTypeIndex);
+        const AllowTime* allowTime = allowRecord.GetAllowTime(allowTypeIndex);
+        if (allowNumber != 0 && allowTime != nullptr && (removeAll || curTime >= allowTime->endTime_)) {
+            allowExpiryIndex_.Remove(uid, name, allowTypeIndex);
+            allowRecord.RemoveAllowTime(allowTypeIndex);
             removedNumber |= allowNumber;
-        } else {
-            ++it;
         }
     }
     STANDBYSERVICE_LOGD("remove allow list, uid: %{public}d, type: %{public}u", uid, removedNumber);
     if (removedNumber == 0) {
         STANDBYSERVICE_LOGW("none member of the allow list should be removed");
-        return;
+        return 0;
     }
-    if (removedNumber == allowRecordPtr->allowType_) {
-        allowInfoMap_.erase(keyStr);
+    std::string keyStr = AllowRecordIndex::GetRecordKey(uid, name);
+    if (removedNumber == allowRecord.allowType_) {
+        allowRecordIndex_.Erase(slot);
+        allowRecordJournal_->RecordRemove(keyStr);
         STANDBYSERVICE_LOGI("allow list has been delete");
     } else {
-        allowRecordPtr->allowType_ = allowRecordPtr->allowType_ - removedNumber;
+        allowRecord.allowType_ = allowRecord.allowType_ - removedNumber;
+        allowRecordIndex_.Sync(slot);
+        allowRecordJournal_->RecordUpdate(keyStr, allowRecord.ParseToJson());
     }
-    StandbyStateSubscriber::GetInstance()->ReportAllowListChanged(uid, name, removedNumber, false);
-    NotifyAllowListChanged(uid, name, removedNumber, false);
-    DumpPersistantData();
+    return removedNumber;
 }
 
 void StandbyServiceImpl::OnProcessStatusChanged(int32_t uid, int32_t pid, const std::string& bundleName, bool isCreated)
@@ -934,25 +1261,20 @@ void StandbyServiceImpl::OnProcessStatusChanged(int32_t uid, int32_t pid, const
     }
     STANDBYSERVICE_LOGI("process status change, uid: %{public}d, pid: %{public}d, name: %{public}s, alive: %{public}d",
         uid, pid, bundleName.c_str(), isCreated);
-    StandbyMessage standbyMessage {StandbyMessageType::PROCESS_STATE_CHANGED};
-    standbyMessage.want_ = AAFwk::Want {};
-    standbyMessage.want_->SetParam("uid", uid);
-    standbyMessage.want_->SetParam("pid", pid);
-    standbyMessage.want_->SetParam("name", bundleName);
-    standbyMessage.want_->SetParam("isCreated", isCreated);
-    DispatchEvent(standbyMessage);
+    // invoked by the drain task of app state events on the critical lane, which keeps the dispatch order
+    DispatchEventInHandler(StandbyMessage(StandbyMessageType::PROCESS_STATE_CHANGED,
+        ProcessStateChangedPayload {uid, pid, bundleName, isCreated}));
 }
 
-void StandbyServiceImpl::NotifyAllowListChanged(int32_t uid, const std::string& name,
-    uint32_t allowType, bool added)
+void StandbyServiceImpl::NotifyAllowListChanged(const std::vector<AllowListChange>& changes)
 {
-    StandbyMessage standbyMessage {StandbyMessageType::ALLOW_LIST_CHANGED};
-    standbyMessage.want_ = AAFwk::Want {};
-    standbyMessage.want_->SetParam("uid", uid);
-    standbyMessage.want_->SetParam("name", name);
-    standbyMessage.want_->SetParam("allowType", static_cast<int>(allowType));
-    standbyMessage.want_->SetParam("added", added);
-    DispatchEvent(standbyMessage);
+    AllowListChangedPayload payload;
+    payload.changes_.reserve(changes.size());
+    for (const auto& change : changes) {
+        payload.changes_.push_back({change.uid_, change.name_, change.allowType_, change.added_});
+        payload.allowType_ |= change.allowType_;
+    }
+    DispatchEvent(StandbyMessage(StandbyMessageType::ALLOW_LIST_CHANGED, std::move(payload)));
 }
 
 ErrCode StandbyServiceImpl::GetAllowList(uint32_t allowType, std::vector<AllowInfo>& allowInfoList,
@@ -996,45 +1318,38 @@ void StandbyServiceImpl::GetTemporaryAllowList(uint32_t allowTypeIndex, std::vec
     allowInfoList, uint32_t reasonCode)
 {
     int64_t curTime = MiscServices::TimeServiceClient::GetInstance()->GetBootTimeMs();
-    auto findRecordTask = [allowTypeIndex](const auto& it) { return it.allowTypeIndex_ == allowTypeIndex; };
-    for (auto& [key, allowRecordPtr] : allowInfoMap_) {
-        if ((allowRecordPtr->allowType_ & (1 << allowTypeIndex)) == 0) {
-            continue;
-        }
-        if (allowRecordPtr->reasonCode_ != reasonCode) {
-            continue;
-        }
-        auto& allowTimeList = allowRecordPtr->allowTimeList_;
-        auto it = std::find_if(allowTimeList.begin(), allowTimeList.end(), findRecordTask);
-        if (it == allowTimeList.end()) {
-            continue;
+    allowRecordIndex_.ForEachOfType(allowTypeIndex, [&](AllowRecord& allowRecord) {
+        if ((allowRecord.allowType_ & (1 << allowTypeIndex)) == 0 || allowRecord.reasonCode_ != reasonCode) {
+            return;
         }
-        int64_t duration =  std::max(static_cast<int64_t>(it->endTime_ - curTime), static_cast<int64_t>(0L));
+        const AllowTime* allowTime = allowRecord.GetAllowTime(allowTypeIndex);
+        int64_t duration = std::max(static_cast<int64_t>(allowTime->endTime_ - curTime), static_cast<int64_t>(0L));
         if (duration > 0) {
-            allowInfoList.emplace_back((1 << allowTypeIndex), allowRecordPtr->name_, duration);
+            allowInfoList.emplace_back((1 << allowTypeIndex), allowRecord.name_, duration);
         } else {
-            auto task = [this, allowRecordPtr = allowRecordPtr] () {
-                this->UnapplyAllowResInner(allowRecordPtr->uid_, allowRecordPtr->name_,
-                    allowRecordPtr->allowType_, false);
+            auto task = [this, uid = allowRecord.uid_, name = allowRecord.name_,
+                allowType = allowRecord.allowType_] () {
+                this->UnapplyAllowResInner(uid, name, allowType, false);
             };
-            handler_->PostTask(task);
+            PostLaneTask(TaskLane::STRATEGY, task);
         }
-    }
+    });
 }
 
 void StandbyServiceImpl::GetPersistAllowList(uint32_t allowTypeIndex, std::vector<AllowInfo>& allowInfoList,
     bool isAllow, bool isApp)
 {
+    if (allowTypeIndex >= MAX_ALLOW_TYPE_NUM) {
+        return;
+    }
     uint32_t condition = TimeProvider::GetCondition();
-    std::set<std::string> psersistAllowList;
-    if (isApp) {
-        psersistAllowList = StandbyConfigManager::GetInstance()->GetEligiblePersistAllowConfig(
-            AllowTypeName[allowTypeIndex], condition, isAllow, true);
-    } else {
-        psersistAllowList = StandbyConfigManager::GetInstance()->GetEligiblePersistAllowConfig(
-            AllowTypeName[allowTypeIndex], condition, isAllow, false);
+    auto psersistAllowList = StandbyConfigManager::GetInstance()->GetEligiblePersistAllowList(
+        AllowTypeName[allowTypeIndex], condition, isAllow, isApp);
+    if (psersistAllowList == nullptr) {
+        return;
     }
-    for (const auto& allowName : psersistAllowList) {
+    allowInfoList.reserve(allowInfoList.size() + psersistAllowList->size());
+    for (const auto& allowName : *psersistAllowList) {
         allowInfoList.emplace_back((1 << allowTypeIndex), allowName, -1);
     }
 }
@@ -1049,10 +1364,30 @@ ErrCode StandbyServiceImpl::IsDeviceInStandby(bool& isStandby)
     if (!IsServiceReady()) {
         return ERR_STANDBY_SYS_NOT_READY;
     }
-    handler_->PostSyncTask([this, &isStandby]() {
+    uint32_t state = StandbyState::WORKING;
+    uint32_t phase = 0;
+    if (standbyStateSnapshot_.Load(state, phase)) {
+        isStandby = (state == StandbyState::SLEEP);
+        return ERR_OK;
+    }
+    taskLaneScheduler_->PostSyncTask(handler_, TaskLane::QUERY, [this, &isStandby]() {
         auto curState = standbyStateManager_->GetCurState();
         isStandby = (curState == StandbyState::SLEEP);
-        }, AppExecFwk::EventQueue::Priority::HIGH);
+        });
+    return ERR_OK;
+}
+
+ErrCode StandbyServiceImpl::GetStandbyStatePage(int32_t& fd)
+{
+    if (auto checkRet = CheckCallerPermission(); checkRet != ERR_OK) {
+        STANDBYSERVICE_LOGE("caller permission denied.");
+        return checkRet;
+    }
+    if (statePage_ == nullptr) {
+        return ERR_STANDBY_OBJECT_NOT_EXIST;
+    }
+    // the page keeps its fd, the reply carries a duplicate of it
+    fd = statePage_->GetFd();
     return ERR_OK;
 }
 
@@ -1088,12 +1423,11 @@ ErrCode StandbyServiceImpl::ReportWorkSchedulerStatus(bool started, int32_t uid,
     }
     STANDBYSERVICE_LOGD("work scheduler status changed, isstarted: %{public}d, uid: %{public}d, bundleName: %{public}s",
         started, uid, bundleName.c_str());
-    StandbyMessage standbyMessage {StandbyMessageType::BG_TASK_STATUS_CHANGE};
-    standbyMessage.want_ = AAFwk::Want {};
-    standbyMessage.want_->SetParam(BG_TASK_TYPE, WORK_SCHEDULER);
-    standbyMessage.want_->SetParam(BG_TASK_STATUS, started);
-    standbyMessage.want_->SetParam(BG_TASK_UID, uid);
-    DispatchEvent(standbyMessage);
+    BgTaskStatusPayload payload;
+    payload.type_ = WORK_SCHEDULER;
+    payload.started_ = started;
+    payload.uid_ = uid;
+    DispatchEvent(StandbyMessage(StandbyMessageType::BG_TASK_STATUS_CHANGE, std::move(payload)));
     return ERR_OK;
 }
 
@@ -1205,18 +1539,11 @@ ErrCode StandbyServiceImpl::ReportDeviceStateChanged(int32_t type, bool enabled)
 
 void WEAK_FUNC StandbyServiceImpl::HandleCallStateChanged(const std::string &sceneInfo)
 {
-    nlohmann::json payload = nlohmann::json::parse(sceneInfo, nullptr, false);
-    if (payload.is_discarded()) {
-        STANDBYSERVICE_LOGE("parse json failed");
+    SceneInfoFields fields;
+    if (!DecodeSceneInfo(sceneInfo, SceneInfoSchemas::CALL_STATE_CHANGED, fields, "call state")) {
         return;
     }
-    int32_t state = -1;
-    if (payload.at("state").is_string()) {
-        state = atoi(payload["state"].get<std::string>().c_str());
-    }
-    if (payload.at("state").is_number_integer()) {
-        state = payload["state"].get<std::int32_t>();
-    }
+    int32_t state = static_cast<int32_t>(fields[SceneInfoSchemas::CALL_STATE].num_);
     bool disable = (state == static_cast<int32_t>(TelCallState::CALL_STATUS_UNKNOWN) ||
                     state == static_cast<int32_t>(TelCallState::CALL_STATUS_DISCONNECTED) ||
                     state == static_cast<int32_t>(TelCallState::CALL_STATUS_IDLE));
@@ -1282,23 +1609,15 @@ ErrCode StandbyServiceImpl::HeartBeatValueChanged(const std::string &tag, int32_
 void StandbyServiceImpl::HandleBTServiceEvent(const int64_t value, const std::string &sceneInfo)
 {
     STANDBYSERVICE_LOGI("HandleBTSerciceEvent value: %{public}" PRId64, value);
-    nlohmann::json payload = nlohmann::json::parse(sceneInfo, nullptr, false);
-    if (payload.is_discarded()) {
-        STANDBYSERVICE_LOGE("parse json failed");
-        return;
-    }
+    SceneInfoFields fields;
     if (value == ResourceSchedule::ResType::BtServiceEvent::GATT_APP_REGISTER) {
-        if (!payload.contains("ACTION") || !payload.contains("UID") ||
-            !payload.at("ACTION").is_string() || !payload.at("UID").is_string() ||
-            !payload.contains("SIDE") || !payload.at("SIDE").is_string() ||
-            !payload.contains("APPID") || !payload.at("APPID").is_string()) {
-            STANDBYSERVICE_LOGE("Bt Gatt Register info is valid");
+        if (!DecodeSceneInfo(sceneInfo, SceneInfoSchemas::GATT_APP_REGISTER, fields, "Bt Gatt Register")) {
             return;
         }
-        std::string action = payload["ACTION"].get<std::string>();
-        int32_t uid = atoi(payload["UID"].get<std::string>().c_str());
-        std::string side = payload["SIDE"].get<std::string>();
-        int32_t appid = atoi(payload["APPID"].get<std::string>().c_str());
+        std::string action = fields[SceneInfoSchemas::REGISTER_ACTION].ToString();
+        int32_t uid = static_cast<int32_t>(fields[SceneInfoSchemas::REGISTER_UID].num_);
+        std::string side = fields[SceneInfoSchemas::REGISTER_SIDE].ToString();
+        int32_t appid = static_cast<int32_t>(fields[SceneInfoSchemas::REGISTER_APPID].num_);
         StandbyMessage standbyMessage {StandbyMessageType::GATT_APP_REGISTER};
         standbyMessage.want_ = AAFwk::Want {};
         standbyMessage.want_->SetParam("ACTION", action);
@@ -1307,15 +1626,12 @@ void StandbyServiceImpl::HandleBTServiceEvent(const int64_t value, const std::st
         standbyMessage.want_->SetParam("APPID", appid);
         DispatchEvent(standbyMessage);
     } else if (value == ResourceSchedule::ResType::BtServiceEvent::GATT_CONNECT_STATE) {
-        if (!payload.contains("STATE") || !payload.at("STATE").is_string() ||
-            !payload.contains("ROLE") || !payload.at("ROLE").is_string() ||
-            !payload.contains("CONNECTIF") || !payload.at("CONNECTIF").is_string()) {
-            STANDBYSERVICE_LOGE("Bt Gatt Connection info is valid");
+        if (!DecodeSceneInfo(sceneInfo, SceneInfoSchemas::GATT_CONNECT_STATE, fields, "Bt Gatt Connection")) {
             return;
         }
-        int32_t state = atoi(payload["STATE"].get<std::string>().c_str());
-        std::string side = payload["ROLE"].get<std::string>();
-        int32_t appid = atoi(payload["CONNECTIF"].get<std::string>().c_str());
+        int32_t state = static_cast<int32_t>(fields[SceneInfoSchemas::CONNECT_STATE].num_);
+        std::string side = fields[SceneInfoSchemas::CONNECT_ROLE].ToString();
+        int32_t appid = static_cast<int32_t>(fields[SceneInfoSchemas::CONNECT_IF].num_);
         StandbyMessage standbyMessage {StandbyMessageType::GATT_CONNECT_STATE};
         standbyMessage.want_ = AAFwk::Want {};
         standbyMessage.want_->SetParam("STATE", state);
@@ -1328,19 +1644,13 @@ void StandbyServiceImpl::HandleBTServiceEvent(const int64_t value, const std::st
 void StandbyServiceImpl::HandleBrokerGattConnect(const int64_t value, const std::string &sceneInfo)
 {
     STANDBYSERVICE_LOGI("HandleBrokerGattConnect value: %{public}" PRId64, value);
-    nlohmann::json payload = nlohmann::json::parse(sceneInfo, nullptr, false);
-    if (payload.is_discarded()) {
-        STANDBYSERVICE_LOGE("parse json failed");
-        return;
-    }
+    SceneInfoFields fields;
     if (value) {
-        if (!payload.contains("clientIf") || !payload.contains("pkg") || !payload.at("clientIf").is_string() ||
-            !payload.at("pkg").is_string()) {
-            STANDBYSERVICE_LOGE("Broker Gatt connect info is valid");
+        if (!DecodeSceneInfo(sceneInfo, SceneInfoSchemas::BROKER_GATT_CONNECT, fields, "Broker Gatt connect")) {
             return;
         }
-        std::string pkg = payload["pkg"].get<std::string>();
-        int32_t clientIf = atoi(payload["clientIf"].get<std::string>().c_str());
+        std::string pkg = fields[SceneInfoSchemas::BROKER_PKG].ToString();
+        int32_t clientIf = static_cast<int32_t>(fields[SceneInfoSchemas::BROKER_CLIENT_IF].num_);
         bool connect = true;
         StandbyMessage standbyMessage {StandbyMessageType::BROKER_GATT_CONNECT};
         standbyMessage.want_ = AAFwk::Want {};
@@ -1349,11 +1659,10 @@ void StandbyServiceImpl::HandleBrokerGattConnect(const int64_t value, const std:
         standbyMessage.want_->SetParam("connect", connect);
         DispatchEvent(standbyMessage);
     } else {
-        if (!payload.contains("clientIf") || !payload.at("clientIf").is_string()) {
-            STANDBYSERVICE_LOGE("Broker Gatt disconnect info is valid");
+        if (!DecodeSceneInfo(sceneInfo, SceneInfoSchemas::BROKER_GATT_DISCONNECT, fields, "Broker Gatt disconnect")) {
             return;
         }
-        int32_t clientIf = atoi(payload["clientIf"].get<std::string>().c_str());
+        int32_t clientIf = static_cast<int32_t>(fields[SceneInfoSchemas::BROKER_CLIENT_IF].num_);
         bool connect = false;
         StandbyMessage standbyMessage {StandbyMessageType::BROKER_GATT_CONNECT};
         standbyMessage.want_ = AAFwk::Want {};
@@ -1433,25 +1742,13 @@ void StandbyServiceImpl::HandleResourcesStateChanged(const int64_t value, const
             value == ResourceSchedule::ResType::EfficiencyResourcesStatus::PROC_EFFICIENCY_RESOURCES_APPLY) {
             isApply = true;
         }
-        nlohmann::json payload = nlohmann::json::parse(sceneInfo, nullptr, false);
-        if (payload.is_discarded()) {
-            STANDBYSERVICE_LOGE("parse json failed");
-            return;
-        }
-        if (!payload.contains("bundleName") || !payload.contains("resourceNumber")) {
-            STANDBYSERVICE_LOGE("param does not exist");
-            return;
-        }
-        if (!payload.at("bundleName").is_string()) {
-            STANDBYSERVICE_LOGE("bundle name param is invalid");
-            return;
-        }
-        std::string bundleName = payload.at("bundleName").get<std::string>();
-        if (!payload.at("resourceNumber").is_number_unsigned()) {
-            STANDBYSERVICE_LOGE("resource number param is invalid");
+        SceneInfoFields fields;
+        if (!DecodeSceneInfo(sceneInfo, SceneInfoSchemas::EFFICIENCY_RESOURCES_STATE_CHANGED, fields,
+            "efficiency resources")) {
             return;
         }
-        uint32_t resourceNumber = payload["resourceNumber"].get<std::uint32_t>();
+        std::string bundleName = fields[SceneInfoSchemas::RESOURCES_BUNDLE_NAME].ToString();
+        uint32_t resourceNumber = static_cast<uint32_t>(fields[SceneInfoSchemas::RESOURCES_NUMBER].num_);
         StandbyMessage standbyMessage {StandbyMessageType::BG_EFFICIENCY_RESOURCE_APPLY};
         standbyMessage.want_ = AAFwk::Want {};
         standbyMessage.want_->SetParam(BG_TASK_BUNDLE_NAME, bundleName);
@@ -1487,6 +1784,34 @@ ErrCode StandbyServiceImpl::HandleCommonEvent(const uint32_t resType, const int6
 {
     STANDBYSERVICE_LOGD("HandleCommonEvent resType = %{public}u, value = %{public}lld, sceneInfo = %{public}s",
                         resType, (long long)(value), sceneInfo.c_str());
+    int64_t flushDelay = 0;
+    IngressDecision decision = ingressFilter_.Filter(resType, value, sceneInfo, GetSteadyTimeMs(), flushDelay);
+    if (flushDelay > 0) {
+        PostLaneTask(TaskLane::CRITICAL, [this]() { this->FlushIngressEvents(); }, FLUSH_INGRESS_EVENTS_TASK,
+            flushDelay);
+    }
+    if (decision == IngressDecision::PASS) {
+        DeliverCommonEvent(resType, value, sceneInfo);
+    }
+    return ERR_OK;
+}
+
+void StandbyServiceImpl::FlushIngressEvents()
+{
+    int64_t flushDelay = 0;
+    std::vector<IngressEvent> dueEvents = ingressFilter_.TakeDueEvents(GetSteadyTimeMs(), flushDelay);
+    if (flushDelay > 0) {
+        PostLaneTask(TaskLane::CRITICAL, [this]() { this->FlushIngressEvents(); }, FLUSH_INGRESS_EVENTS_TASK,
+            flushDelay);
+    }
+    for (const auto& event : dueEvents) {
+        DeliverCommonEvent(event.resType_, event.value_, event.sceneInfo_);
+    }
+}
+
+void StandbyServiceImpl::DeliverCommonEvent(const uint32_t resType, const int64_t value,
+    const std::string &sceneInfo)
+{
     switch (resType) {
         case ResourceSchedule::ResType::RES_TYPE_SCREEN_STATUS:
             HandleScreenStateChanged(value);
@@ -1527,7 +1852,6 @@ ErrCode StandbyServiceImpl::HandleCommonEvent(const uint32_t resType, const int6
             SubHandleCommonEvent(resType, value, sceneInfo);
             break;
     }
-    return ERR_OK;
 }
 
 void StandbyServiceImpl::SubHandleCommonEvent(const uint32_t resType, const int64_t value, const std::string &sceneInfo)
@@ -1567,45 +1891,27 @@ void StandbyServiceImpl::HandlePowerModeChanged(const int64_t value)
 
 void StandbyServiceImpl::HandleAudioRendererChanged(const int64_t value, const std::string &sceneInfo)
 {
-    nlohmann::json payload = nlohmann::json::parse(sceneInfo, nullptr, false);
-    if (payload.is_discarded()) {
-        STANDBYSERVICE_LOGE("parse json failed");
-        return;
-    }
-    if (!payload.contains("uid")) {
-        STANDBYSERVICE_LOGE("param does not exist");
-        return;
-    }
-    if (!payload.at("uid").is_string()) {
-        STANDBYSERVICE_LOGE("uid param is invalid");
+    SceneInfoFields fields;
+    if (!DecodeSceneInfo(sceneInfo, SceneInfoSchemas::AUDIO_STATE_CHANGED, fields, "uid")) {
         return;
     }
     StandbyMessage message(StandbyMessageType::AUDIO_RENDERER_CHANGE);
     message.want_ = AAFwk::Want {};
     message.want_->SetParam("rendererState", static_cast<int32_t>(value));
-    message.want_->SetParam("uid", payload["uid"].get<std::string>());
+    message.want_->SetParam("uid", fields[SceneInfoSchemas::AUDIO_UID].ToString());
     DispatchEvent(message);
 }
 
 void StandbyServiceImpl::HandleAudioCapturerChanged(const int64_t value, const std::string &sceneInfo)
 {
-    nlohmann::json payload = nlohmann::json::parse(sceneInfo, nullptr, false);
-    if (payload.is_discarded()) {
-        STANDBYSERVICE_LOGE("parse json failed");
-        return;
-    }
-    if (!payload.contains("uid")) {
-        STANDBYSERVICE_LOGE("param does not exist");
-        return;
-    }
-    if (!payload.at("uid").is_string()) {
-        STANDBYSERVICE_LOGE("uid param is invalid");
+    SceneInfoFields fields;
+    if (!DecodeSceneInfo(sceneInfo, SceneInfoSchemas::AUDIO_STATE_CHANGED, fields, "uid")) {
         return;
     }
     StandbyMessage message(StandbyMessageType::AUDIO_CAPTURER_CHANGE);
     message.want_ = AAFwk::Want {};
     message.want_->SetParam("capturerState", static_cast<int32_t>(value));
-    message.want_->SetParam("uid", payload["uid"].get<std::string>());
+    message.want_->SetParam("uid", fields[SceneInfoSchemas::AUDIO_UID].ToString());
     DispatchEvent(message);
 }
 
@@ -1618,56 +1924,79 @@ void StandbyServiceImpl::AppEventHandler(const uint32_t resType, const int64_t v
          value == ResourceSchedule::ResType::AppInstallStatus::BUNDLE_REMOVED ||
          value == ResourceSchedule::ResType::AppInstallStatus::APP_FULLY_REMOVED)
         ) {
-        nlohmann::json payload = nlohmann::json::parse(sceneInfo, nullptr, false);
-        if (payload.is_discarded()) {
-            STANDBYSERVICE_LOGE("parse json failed");
+        // a reinstalled or updated app may be granted different permissions
+        callerPermissionCache_.Clear();
+        SceneInfoFields fields;
+        if (!DecodeSceneInfo(sceneInfo, SceneInfoSchemas::APP_INSTALL_UNINSTALL, fields, "bundle name or uid")) {
             return;
         }
-        if (!payload.contains("bundleName") || !payload.contains("uid")) {
-            STANDBYSERVICE_LOGE("HandleCommonEvent,There is no valid bundle name in payload");
-            return;
-        }
-        if (!payload.at("bundleName").is_string()) {
-            STANDBYSERVICE_LOGE("bundle name is invaild");
-            return;
-        }
-        std::string bundleName = payload.at("bundleName").get<std::string>();
-        int32_t uid = -1;
-        if (payload.at("uid").is_string()) {
-            uid = atoi(payload["uid"].get<std::string>().c_str());
-        }
-        if (payload.at("uid").is_number_integer()) {
-            uid = payload["uid"].get<std::int32_t>();
-        }
-        handler_->PostTask([uid, bundleName]() {
+        std::string bundleName = fields[SceneInfoSchemas::INSTALL_BUNDLE_NAME].ToString();
+        int32_t uid = static_cast<int32_t>(fields[SceneInfoSchemas::INSTALL_UID].num_);
+        PostLaneTask(TaskLane::STRATEGY, [uid, bundleName]() {
             StandbyServiceImpl::GetInstance()->RemoveAppAllowRecord(uid, bundleName, true);
         });
     } else if (resType == ResourceSchedule::ResType::RES_TYPE_TIMEZONE_CHANGED ||
                resType == ResourceSchedule::ResType::RES_TYPE_NITZ_TIMEZONE_CHANGED ||
                resType == ResourceSchedule::ResType::RES_TYPE_TIME_CHANGED ||
                resType == ResourceSchedule::ResType::RES_TYPE_NITZ_TIME_CHANGED) {
-        handler_->PostTask([]() {StandbyServiceImpl::GetInstance()->ResetTimeObserver(); });
+        PostLaneTask(TaskLane::CRITICAL, []() {
+            TimeProvider::RefreshCondition();
+            StandbyServiceImpl::GetInstance()->WriteStatePage();
+            StandbyServiceImpl::GetInstance()->ResetTimeObserver();
+        });
     }
 }
 
-void StandbyServiceImpl::DispatchEvent(const StandbyMessage& message)
+void StandbyServiceImpl::DispatchEvent(StandbyMessage message)
 {
     if (!IsServiceReady()) {
         return;
     }
 
-    auto dispatchEventFunc = [this, message]() {
-        STANDBYSERVICE_LOGD("standby service implement dispatch message %{public}d", message.eventId_);
-        if (!listenerManager_ || !standbyStateManager_ || !strategyManager_) {
-            STANDBYSERVICE_LOGE("can not dispatch event, state manager or strategy manager is nullptr");
-            return;
-        };
-        listenerManager_->HandleEvent(message);
-        standbyStateManager_->HandleEvent(message);
-        strategyManager_->HandleEvent(message);
+    auto dispatchEventFunc = [this, message = std::move(message)]() mutable {
+        DispatchEventInHandler(std::move(message));
+    };
+
+    // state machine input is handled on the critical lane in the order messages are dispatched
+    PostLaneTask(TaskLane::CRITICAL, std::move(dispatchEventFunc));
+}
+
+void StandbyServiceImpl::DispatchEventInHandler(StandbyMessage&& message)
+{
+    STANDBYSERVICE_LOGD("standby service implement dispatch message %{public}d", message.eventId_);
+    if (!listenerManager_ || !standbyStateManager_ || !strategyManager_) {
+        STANDBYSERVICE_LOGE("can not dispatch event, state manager or strategy manager is nullptr");
+        return;
     };
+    DispatchEventInner(std::move(message));
+}
 
-    handler_->PostTask(dispatchEventFunc);
+// only deliver the message to the components which declare interest in it
+void StandbyServiceImpl::DispatchEventInner(StandbyMessage&& message)
+{
+    StandbyEventMask eventMask = GetEventMask(message.eventId_);
+    ++dispatchedMessageCount_;
+    if ((listenerManager_->GetEventInterest() & eventMask) != 0) {
+        listenerManager_->HandleEvent(message);
+    } else {
+        ++skippedDeliveryCount_;
+    }
+    if ((standbyStateManager_->GetEventInterest() & eventMask) != 0) {
+        standbyStateManager_->HandleEvent(message);
+    } else {
+        ++skippedDeliveryCount_;
+    }
+    if ((strategyManager_->GetEventInterest() & eventMask) == 0) {
+        ++skippedDeliveryCount_;
+        return;
+    }
+    // strategies may issue slow ipc, so they run on the strategy lane and never delay state transitions.
+    // the critical lane runs in dispatch order and posts here in the same order, so strategies see that order too
+    PostLaneTask(TaskLane::STRATEGY, [this, message = std::move(message)]() {
+        if (strategyManager_ != nullptr) {
+            strategyManager_->HandleEvent(message);
+        }
+    });
 }
 
 bool StandbyServiceImpl::IsDebugMode()
@@ -1682,9 +2011,9 @@ void StandbyServiceImpl::ShellDump(const std::vector<std::string>& argsInStr,
         result += "standby service manager is not ready";
         return;
     }
-    handler_->PostSyncTask([this, &argsInStr, &result]() {
+    taskLaneScheduler_->PostSyncTask(handler_, TaskLane::QUERY, [this, &argsInStr, &result]() {
         this->ShellDumpInner(argsInStr, result);
-        }, AppExecFwk::EventQueue::Priority::HIGH);
+        });
 }
 
 void StandbyServiceImpl::ShellDumpInner(const std::vector<std::string>& argsInStr,
@@ -1767,6 +2096,10 @@ void StandbyServiceImpl::DumpShowDetailInfo(const std::vector<std::string>& args
     std::string& result)
 {
     DumpAllowListInfo(result);
+    result.append("dispatched message: " + std::to_string(dispatchedMessageCount_))
+        .append(", skipped delivery: " + std::to_string(skippedDeliveryCount_)).append("\n");
+    taskLaneScheduler_->ShellDump(result);
+    ingressFilter_.ShellDump(result);
     if (argsInStr.size() < DUMP_DETAILED_INFO_MAX_NUMS) {
         return;
     }
@@ -1778,35 +2111,37 @@ void StandbyServiceImpl::DumpShowDetailInfo(const std::vector<std::string>& args
 void StandbyServiceImpl::DumpAllowListInfo(std::string& result)
 {
     std::lock_guard<std::mutex> allowRecordLock(allowRecordMutex_);
-    if (allowInfoMap_.empty()) {
+    if (allowRecordIndex_.Empty()) {
         result += "allow resources record is empty\n";
         return;
     }
 
     std::stringstream stream;
     uint32_t index = 1;
-    for (auto iter = allowInfoMap_.begin(); iter != allowInfoMap_.end(); iter++) {
+    allowRecordIndex_.ForEach([&stream, &index, &result](AllowRecord& allowRecord) {
         stream << "No." << index << "\n";
-        stream << "\tuid: " << iter->first << "\n";
+        stream << "\tuid: " << AllowRecordIndex::GetRecordKey(allowRecord.uid_, allowRecord.name_) << "\n";
         stream << "\tallow record: " << "\n";
-        stream << "\t\tname: " << iter->second->name_ << "\n";
-        stream << "\t\tpid: " << iter->second->pid_ << "\n";
-        stream << "\t\tallow type: " << iter->second->allowType_ << "\n";
-        stream << "\t\treason code: " << iter->second->reasonCode_ << "\n";
-        int64_t curTime = MiscServices::TimeServiceClient::GetInstance()->GetMonotonicTimeMs();
-        auto &allowTimeList = iter->second->allowTimeList_;
-        for (auto unitIter = allowTimeList.begin();
-            unitIter != allowTimeList.end(); ++unitIter) {
-            stream << "\t\t\tallow type: " << AllowTypeName[unitIter->allowTypeIndex_] << "\n";
-            stream << "\t\t\tremainTime: " << unitIter->endTime_ - curTime << "\n";
-            stream << "\t\t\treason: " << unitIter->reason_ << "\n";
+        stream << "\t\tname: " << allowRecord.name_ << "\n";
+        stream << "\t\tpid: " << allowRecord.pid_ << "\n";
+        stream << "\t\tallow type: " << allowRecord.allowType_ << "\n";
+        stream << "\t\treason code: " << allowRecord.reasonCode_ << "\n";
+        int64_t curTime = MiscServices::TimeServiceClient::GetInstance()->GetBootTimeMs();
+        for (uint32_t allowTypeIndex = 0; allowTypeIndex < ALLOW_TIME_SLOT_NUM; ++allowTypeIndex) {
+            const AllowTime* allowTime = allowRecord.GetAllowTime(allowTypeIndex);
+            if (allowTime == nullptr) {
+                continue;
+            }
+            stream << "\t\t\tallow type: " << AllowTypeName[allowTypeIndex] << "\n";
+            stream << "\t\t\tremainTime: " << allowTime->endTime_ - curTime << "\n";
+            stream << "\t\t\treason: " << allowTime->reason_ << "\n";
         }
         stream << "\n";
         result += stream.str();
         stream.str("");
         stream.clear();
         index++;
-    }
+    });
 }
 
 void StandbyServiceImpl::DumpStandbyConfigInfo(std::string& result)
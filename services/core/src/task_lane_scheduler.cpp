@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "task_lane_scheduler.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "standby_service_log.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+const std::array<std::string, TaskLaneScheduler::LANE_NUM> LANE_NAMES = {
+    "critical", "query", "strategy", "background"
+};
+// a lane is picked before lanes of higher priority once its oldest task waited longer than the bound
+const std::array<int64_t, TaskLaneScheduler::LANE_NUM> LANE_AGING_BOUND_MS = {0, 20, 200, 1000};
+const std::array<uint64_t, TaskLaneScheduler::WAIT_BUCKET_NUM - 1> WAIT_BUCKET_BOUND_US = {
+    1000, 5000, 10000, 50000, 100000, 500000
+};
+const std::array<std::string, TaskLaneScheduler::WAIT_BUCKET_NUM> WAIT_BUCKET_NAMES = {
+    "<1ms", "<5ms", "<10ms", "<50ms", "<100ms", "<500ms", ">=500ms"
+};
+const std::array<uint32_t, TaskLaneScheduler::DEPTH_BUCKET_NUM - 1> DEPTH_BUCKET_BOUND = {2, 4, 8, 16};
+const std::array<std::string, TaskLaneScheduler::DEPTH_BUCKET_NUM> DEPTH_BUCKET_NAMES = {
+    "1", "2-3", "4-7", "8-15", ">=16"
+};
+}
+
+bool TaskLaneScheduler::PostTask(const std::shared_ptr<AppExecFwk::EventHandler>& handler, TaskLane lane,
+    const std::function<void()>& task, const std::string& name, int64_t delayMs)
+{
+    if (handler == nullptr || lane >= TaskLane::LANE_NUM) {
+        return false;
+    }
+    if (delayMs <= 0) {
+        return Enqueue(handler, lane, task, name);
+    }
+    // the timer stays in the handler so that it can be removed by name, the task joins its lane once due
+    std::weak_ptr<TaskLaneScheduler> weakScheduler = weak_from_this();
+    return handler->PostTask([weakScheduler, handler, lane, task, name]() {
+        if (auto scheduler = weakScheduler.lock(); scheduler != nullptr) {
+            scheduler->Enqueue(handler, lane, task, name);
+        }
+        }, name, delayMs);
+}
+
+bool TaskLaneScheduler::PostSyncTask(const std::shared_ptr<AppExecFwk::EventHandler>& handler, TaskLane lane,
+    const std::function<void()>& task)
+{
+    if (handler == nullptr || lane >= TaskLane::LANE_NUM) {
+        return false;
+    }
+    // the lane task refers to locals of this frame, so it is queued by the pump and never outlives a failed post.
+    // tasks picked before the sync task would have been run by their own pump, whose pump turns into a no-op
+    return handler->PostSyncTask([this, lane, &task]() {
+        bool isDone = false;
+        {
+            std::lock_guard<std::mutex> lock(laneMutex_);
+            PushLocked(static_cast<uint32_t>(lane), {[&isDone, &task]() {
+                task();
+                isDone = true;
+            }, "", Clock::now()});
+        }
+        while (!isDone && RunNextTask()) {}
+        }, GetPumpPriority(lane));
+}
+
+void TaskLaneScheduler::RemoveTask(const std::shared_ptr<AppExecFwk::EventHandler>& handler, const std::string& name)
+{
+    if (name.empty()) {
+        return;
+    }
+    if (handler != nullptr) {
+        handler->RemoveTask(name);
+    }
+    std::lock_guard<std::mutex> lock(laneMutex_);
+    for (auto& lane : lanes_) {
+        lane.erase(std::remove_if(lane.begin(), lane.end(),
+            [&name](const LaneTask& laneTask) { return laneTask.name_ == name; }), lane.end());
+    }
+}
+
+bool TaskLaneScheduler::Enqueue(const std::shared_ptr<AppExecFwk::EventHandler>& handler, TaskLane lane,
+    const std::function<void()>& task, const std::string& name)
+{
+    uint32_t laneIndex = static_cast<uint32_t>(lane);
+    {
+        std::lock_guard<std::mutex> lock(laneMutex_);
+        PushLocked(laneIndex, {task, name, Clock::now()});
+    }
+    std::weak_ptr<TaskLaneScheduler> weakScheduler = weak_from_this();
+    if (!handler->PostTask([weakScheduler]() {
+        if (auto scheduler = weakScheduler.lock(); scheduler != nullptr) {
+            scheduler->RunNextTask();
+        }
+        }, GetPumpPriority(lane))) {
+        STANDBYSERVICE_LOGE("failed to post pump of %{public}s lane", LANE_NAMES[laneIndex].c_str());
+        return false;
+    }
+    return true;
+}
+
+void TaskLaneScheduler::PushLocked(uint32_t laneIndex, LaneTask laneTask)
+{
+    lanes_[laneIndex].push_back(std::move(laneTask));
+    auto& laneStat = laneStats_[laneIndex];
+    ++laneStat.postedCount_;
+    uint32_t depth = static_cast<uint32_t>(lanes_[laneIndex].size());
+    laneStat.maxDepth_ = std::max(laneStat.maxDepth_, depth);
+    ++laneStat.depthBuckets_[GetDepthBucket(depth)];
+}
+
+bool TaskLaneScheduler::RunNextTask()
+{
+    LaneTask laneTask;
+    {
+        std::lock_guard<std::mutex> lock(laneMutex_);
+        Clock::time_point now = Clock::now();
+        uint32_t laneIndex = PickLaneLocked(now);
+        if (laneIndex >= LANE_NUM) {
+            return false;
+        }
+        laneTask = std::move(lanes_[laneIndex].front());
+        lanes_[laneIndex].pop_front();
+        auto& laneStat = laneStats_[laneIndex];
+        uint64_t waitUs = static_cast<uint64_t>(std::max(static_cast<int64_t>(0), static_cast<int64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - laneTask.enqueueTime_).count())));
+        ++laneStat.runCount_;
+        laneStat.maxWaitUs_ = std::max(laneStat.maxWaitUs_, waitUs);
+        ++laneStat.waitBuckets_[GetWaitBucket(waitUs)];
+    }
+    if (laneTask.task_) {
+        laneTask.task_();
+    }
+    return true;
+}
+
+uint32_t TaskLaneScheduler::PickLaneLocked(Clock::time_point now)
+{
+    uint32_t highestLane = LANE_NUM;
+    for (uint32_t laneIndex = 0; laneIndex < LANE_NUM; ++laneIndex) {
+        if (lanes_[laneIndex].empty()) {
+            continue;
+        }
+        if (highestLane == LANE_NUM) {
+            highestLane = laneIndex;
+        }
+        auto waitMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            now - lanes_[laneIndex].front().enqueueTime_).count();
+        if (waitMs >= LANE_AGING_BOUND_MS[laneIndex]) {
+            if (laneIndex != highestLane) {
+                ++laneStats_[laneIndex].agedCount_;
+            }
+            return laneIndex;
+        }
+    }
+    return highestLane;
+}
+
+AppExecFwk::EventQueue::Priority TaskLaneScheduler::GetPumpPriority(TaskLane lane)
+{
+    switch (lane) {
+        case TaskLane::CRITICAL:
+            return AppExecFwk::EventQueue::Priority::IMMEDIATE;
+        case TaskLane::QUERY:
+            return AppExecFwk::EventQueue::Priority::HIGH;
+        default:
+            return AppExecFwk::EventQueue::Priority::LOW;
+    }
+}
+
+uint32_t TaskLaneScheduler::GetWaitBucket(uint64_t waitUs)
+{
+    return static_cast<uint32_t>(std::upper_bound(WAIT_BUCKET_BOUND_US.begin(), WAIT_BUCKET_BOUND_US.end(),
+        waitUs) - WAIT_BUCKET_BOUND_US.begin());
+}
+
+uint32_t TaskLaneScheduler::GetDepthBucket(uint32_t depth)
+{
+    return static_cast<uint32_t>(std::upper_bound(DEPTH_BUCKET_BOUND.begin(), DEPTH_BUCKET_BOUND.end(),
+        depth) - DEPTH_BUCKET_BOUND.begin());
+}
+
+void TaskLaneScheduler::ShellDump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(laneMutex_);
+    std::stringstream stream;
+    stream << "task lanes:\n";
+    for (uint32_t laneIndex = 0; laneIndex < LANE_NUM; ++laneIndex) {
+        const auto& laneStat = laneStats_[laneIndex];
+        stream << "\t" << LANE_NAMES[laneIndex] << ": queued " << lanes_[laneIndex].size()
+            << ", posted " << laneStat.postedCount_ << ", run " << laneStat.runCount_
+            << ", aged " << laneStat.agedCount_ << ", max wait " << laneStat.maxWaitUs_ << "us"
+            << ", max depth " << laneStat.maxDepth_ << "\n";
+        stream << "\t\twait:";
+        for (uint32_t bucket = 0; bucket < WAIT_BUCKET_NUM; ++bucket) {
+            stream << " " << WAIT_BUCKET_NAMES[bucket] << "=" << laneStat.waitBuckets_[bucket];
+        }
+        stream << "\n\t\tdepth:";
+        for (uint32_t bucket = 0; bucket < DEPTH_BUCKET_NUM; ++bucket) {
+            stream << " " << DEPTH_BUCKET_NAMES[bucket] << "=" << laneStat.depthBuckets_[bucket];
+        }
+        stream << "\n";
+    }
+    result += stream.str();
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
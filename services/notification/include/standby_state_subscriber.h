@@ -31,6 +31,7 @@
 #include "istandby_service_subscriber.h"
 #include "standby_state.h"
 #include "istate_manager_adapter.h"
+#include "subscriber_notifier.h"
 
 namespace OHOS {
 namespace DevStandbyMgr {
@@ -40,10 +41,14 @@ DECLARE_DELAYED_SINGLETON(StandbyStateSubscriber);
 
 public:
     static std::shared_ptr<StandbyStateSubscriber> GetInstance();
+    // start the notify workers with the standby config, callbacks are delivered in the reporting thread before
+    void Init();
+    void UnInit();
     ErrCode AddSubscriber(const sptr<IStandbyServiceSubscriber>& subscriber);
     ErrCode RemoveSubscriber(const sptr<IStandbyServiceSubscriber>& subscriber);
     void ReportStandbyState(uint32_t curState);
     void ReportAllowListChanged(int32_t uid, const std::string& name, uint32_t allowType, bool added);
+    void ReportAllowListChanged(const std::vector<AllowListChange>& changes);
     void HandleSubscriberDeath(const wptr<IRemoteObject>& remote);
     void ShellDump(const std::vector<std::string>& argsInStr, std::string& result);
     void NotifyAllowChangedByCommonEvent(int32_t uid, const std::string& name, uint32_t allowType, bool added);
@@ -55,6 +60,10 @@ private:
     void NotifyIdleModeByCommonEvent(bool napped, bool sleeping);
     void NotifyAllowChangedByCallback(int32_t uid, const std::string& name, uint32_t allowType, bool added);
     std::list<sptr<IStandbyServiceSubscriber>>::iterator FindSubcriberObject(sptr<IRemoteObject>& proxy);
+    // copy all subscribers out of the list
+    std::vector<sptr<IStandbyServiceSubscriber>> GetSubscribers();
+    // copy subscribers whose module name equals module out of the list, an empty module matches empty names only
+    std::vector<sptr<IStandbyServiceSubscriber>> GetSubscribers(const std::string& module);
     void NotifyPowerOnRegister(const sptr<IStandbyServiceSubscriber>& subscriber);
     void NotifyLowpowerActionOnRegister(const sptr<IStandbyServiceSubscriber>& subscriber);
     void UpdateCallBackMap(std::mutex& moduleLock, std::unordered_map<std::string, uint32_t>& callBackMap,
@@ -74,6 +83,7 @@ private:
     std::unordered_map<std::string, uint32_t> modulePowerMap_;
     std::unordered_map<std::string, uint32_t> moduleActionMap_;
     std::atomic<int32_t> curDate_;
+    std::shared_ptr<SubscriberNotifier> notifier_ {nullptr};
 };
 
 class SubscriberDeathRecipient final : public IRemoteObject::DeathRecipient {
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_NOTIFICATION_INCLUDE_SUBSCRIBER_NOTIFIER_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_NOTIFICATION_INCLUDE_SUBSCRIBER_NOTIFIER_H
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "iremote_object.h"
+#include "nocopyable.h"
+#include "thread_pool.h"
+
+#include "istandby_service_subscriber.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+// what to do with a notification sent to a subscriber whose queue is full
+enum class NotifyOverflowPolicy : uint32_t {
+    // drop the oldest queued notification to make room for the new one
+    DROP_OLDEST = 1,
+    // drop the new notification
+    DROP_NEWEST,
+    // replace the queued notification of the same key, drop the oldest one if there is none
+    COALESCE,
+    // lossless notifications are exempt from all the policies above
+};
+
+/**
+ * @brief delivers callbacks to subscribers from a worker pool instead of the thread reporting the event.
+ *
+ * Every subscriber has a bounded queue drained by at most one worker at a time, so callbacks of one subscriber keep
+ * their order while a slow subscriber only delays itself. Before the workers are started, callbacks are delivered in
+ * the calling thread.
+ */
+class SubscriberNotifier {
+public:
+    using Callback = std::function<void(const sptr<IStandbyServiceSubscriber>&)>;
+    static constexpr uint32_t DEFAULT_WORKER_NUM = 2;
+    static constexpr uint32_t DEFAULT_QUEUE_CAPACITY = 32;
+
+    DISALLOW_COPY_AND_MOVE(SubscriberNotifier);
+    SubscriberNotifier();
+    ~SubscriberNotifier();
+
+    void Start(uint32_t workerNum, uint32_t queueCapacity, NotifyOverflowPolicy overflowPolicy);
+    // queued notifications are discarded
+    void Stop();
+
+    void AddSubscriber(const sptr<IStandbyServiceSubscriber>& subscriber);
+    void RemoveSubscriber(const sptr<IRemoteObject>& remote);
+
+    /**
+     * @brief queue the callback for each subscriber, subscribers not added to the notifier are skipped.
+     *
+     * @param key notifications of the same key can be coalesced on overflow, empty if never coalesced.
+     * @param isLossless lossless notifications are never dropped, the queue grows beyond its capacity for them.
+     */
+    void Notify(const std::vector<sptr<IStandbyServiceSubscriber>>& subscribers, const std::string& key,
+        const Callback& callback, bool isLossless = false);
+
+    void ShellDump(std::string& result);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Notification {
+        std::string key_ {};
+        Callback callback_ {};
+        Clock::time_point enqueueTime_ {};
+        bool isLossless_ {false};
+    };
+
+    struct Channel {
+        sptr<IStandbyServiceSubscriber> subscriber_ {nullptr};
+        std::deque<Notification> queue_ {};
+        // true if a worker is draining the queue or about to
+        bool isDraining_ {false};
+        uint64_t deliveredCount_ {0};
+        uint64_t droppedCount_ {0};
+        uint64_t coalescedCount_ {0};
+        uint64_t totalLatencyUs_ {0};
+        uint64_t maxLatencyUs_ {0};
+        uint64_t maxCallUs_ {0};
+    };
+
+    void EnqueueLocked(Channel& channel, Notification notification);
+    void Schedule(const std::shared_ptr<Channel>& channel);
+    void Drain(const std::shared_ptr<Channel>& channel);
+
+private:
+    std::mutex channelMutex_ {};
+    std::unordered_map<IRemoteObject*, std::shared_ptr<Channel>> channels_ {};
+    uint32_t workerNum_ {0};
+    uint32_t queueCapacity_ {DEFAULT_QUEUE_CAPACITY};
+    NotifyOverflowPolicy overflowPolicy_ {NotifyOverflowPolicy::COALESCE};
+    // declared last so that workers are joined before the channels are destroyed
+    ThreadPool workerPool_;
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_SERVICES_NOTIFICATION_INCLUDE_SUBSCRIBER_NOTIFIER_H
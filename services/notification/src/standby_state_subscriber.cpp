@@ -21,6 +21,7 @@
 #include "common_event_support.h"
 #include "want.h"
 
+#include "standby_config_manager.h"
 #include "standby_messsage.h"
 #include "standby_service_log.h"
 #include "standby_state.h"
@@ -31,9 +32,19 @@
 
 namespace OHOS {
 namespace DevStandbyMgr {
+namespace {
+const std::string TAG_NOTIFY_WORKER_NUM = "notify_worker_num";
+const std::string TAG_NOTIFY_QUEUE_CAPACITY = "notify_queue_capacity";
+const std::string TAG_NOTIFY_OVERFLOW_POLICY = "notify_overflow_policy";
+const std::string IDLE_MODE_NOTIFY_KEY = "idle_mode";
+const std::string POWER_OVERUSED_NOTIFY_KEY = "power_overused:";
+const std::string LOWPOWER_ACTION_NOTIFY_KEY = "lowpower_action:";
+}
+
 StandbyStateSubscriber::StandbyStateSubscriber()
 {
     deathRecipient_ = new (std::nothrow) SubscriberDeathRecipient();
+    notifier_ = std::make_shared<SubscriberNotifier>();
     curDate_.store(TimeProvider::GetCurrentDate(), std::memory_order_relaxed);
 }
 
@@ -44,6 +55,25 @@ std::shared_ptr<StandbyStateSubscriber> StandbyStateSubscriber::GetInstance()
     return DelayedSingleton<StandbyStateSubscriber>::GetInstance();
 }
 
+void StandbyStateSubscriber::Init()
+{
+    int32_t workerNum = StandbyConfigManager::GetInstance()->GetStandbyParam(TAG_NOTIFY_WORKER_NUM);
+    int32_t queueCapacity = StandbyConfigManager::GetInstance()->GetStandbyParam(TAG_NOTIFY_QUEUE_CAPACITY);
+    int32_t overflowPolicy = StandbyConfigManager::GetInstance()->GetStandbyParam(TAG_NOTIFY_OVERFLOW_POLICY);
+    if (overflowPolicy < static_cast<int32_t>(NotifyOverflowPolicy::DROP_OLDEST) ||
+        overflowPolicy > static_cast<int32_t>(NotifyOverflowPolicy::COALESCE)) {
+        overflowPolicy = static_cast<int32_t>(NotifyOverflowPolicy::COALESCE);
+    }
+    notifier_->Start(workerNum > 0 ? static_cast<uint32_t>(workerNum) : SubscriberNotifier::DEFAULT_WORKER_NUM,
+        queueCapacity > 0 ? static_cast<uint32_t>(queueCapacity) : SubscriberNotifier::DEFAULT_QUEUE_CAPACITY,
+        static_cast<NotifyOverflowPolicy>(overflowPolicy));
+}
+
+void StandbyStateSubscriber::UnInit()
+{
+    notifier_->Stop();
+}
+
 ErrCode StandbyStateSubscriber::AddSubscriber(const sptr<IStandbyServiceSubscriber>& subscriber)
 {
     STANDBYSERVICE_LOGD("StandbyStateSubscriber start subscriber");
@@ -68,6 +98,7 @@ ErrCode StandbyStateSubscriber::AddSubscriber(const sptr<IStandbyServiceSubscrib
     }
 
     subscriberList_.emplace_back(subscriber);
+    notifier_->AddSubscriber(subscriber);
     NotifyPowerOnRegister(subscriber);
     NotifyLowpowerActionOnRegister(subscriber);
     remote->AddDeathRecipient(deathRecipient_);
@@ -98,6 +129,7 @@ ErrCode StandbyStateSubscriber::RemoveSubscriber(const sptr<IStandbyServiceSubsc
         return ERR_STANDBY_OBJECT_EXISTS;
     }
     subscriberList_.erase(subscriberIter);
+    notifier_->RemoveSubscriber(remote);
     remote->RemoveDeathRecipient(deathRecipient_);
     STANDBYSERVICE_LOGD("remove subscriber from standby service subscriber succeed");
     return ERR_OK;
@@ -119,13 +151,14 @@ void StandbyStateSubscriber::ReportStandbyState(uint32_t curState)
 
 void StandbyStateSubscriber::NotifyIdleModeByCallback(bool napped, bool sleeping)
 {
-    std::lock_guard<std::mutex> subcriberLock(subscriberLock_);
-    if (subscriberList_.empty()) {
+    auto subscribers = GetSubscribers();
+    if (subscribers.empty()) {
         return;
     }
-    for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); ++iter) {
-        (*iter)->OnDeviceIdleMode(napped, sleeping);
-    }
+    notifier_->Notify(subscribers, IDLE_MODE_NOTIFY_KEY,
+        [napped, sleeping](const sptr<IStandbyServiceSubscriber>& subscriber) {
+            subscriber->OnDeviceIdleMode(napped, sleeping);
+        });
     STANDBYSERVICE_LOGD("stop callback subscriber list");
 }
 
@@ -153,55 +186,66 @@ void StandbyStateSubscriber::ReportAllowListChanged(int32_t uid, const std::stri
     NotifyAllowChangedByCommonEvent(uid, name, allowType, added);
 }
 
+void StandbyStateSubscriber::ReportAllowListChanged(const std::vector<AllowListChange>& changes)
+{
+    STANDBYSERVICE_LOGI("start ReportAllowListChanged, change num is %{public}d", static_cast<int32_t>(changes.size()));
+    // subscribers keep their allow lists by applying every diff, so the diffs are never dropped on overflow
+    notifier_->Notify(GetSubscribers(), "", [changes](const sptr<IStandbyServiceSubscriber>& subscriber) {
+        subscriber->OnAllowListChangedBatch(changes);
+    }, true);
+    for (const auto& change : changes) {
+        NotifyAllowChangedByCommonEvent(change.uid_, change.name_, change.allowType_, change.added_);
+    }
+}
+
 void StandbyStateSubscriber::NotifyAllowChangedByCallback(int32_t uid, const std::string& name,
     uint32_t allowType, bool added)
 {
-    std::lock_guard<std::mutex> subcriberLock(subscriberLock_);
-    if (subscriberList_.empty()) {
+    auto subscribers = GetSubscribers();
+    if (subscribers.empty()) {
         STANDBYSERVICE_LOGW("Sleep State Subscriber List is empty");
         return;
     }
-    for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); ++iter) {
-        (*iter)->OnAllowListChanged(uid, name, allowType, added);
-    }
+    notifier_->Notify(subscribers, "",
+        [uid, name, allowType, added](const sptr<IStandbyServiceSubscriber>& subscriber) {
+            subscriber->OnAllowListChanged(uid, name, allowType, added);
+        }, true);
 }
 
 void StandbyStateSubscriber::NotifyPowerOverusedByCallback(const std::string& module, uint32_t level)
 {
     UpdateCallBackMap(modulePowerLock_, modulePowerMap_, module, level);
 
-    std::lock_guard<std::mutex> lock(subscriberLock_);
-    if (subscriberList_.empty()) {
+    auto subscribers = GetSubscribers(module);
+    if (subscribers.empty()) {
         STANDBYSERVICE_LOGW("[PowerOverused] Sleep state Subscriber List is empty.");
         return;
     }
 
-    for (auto iter : subscriberList_) {
-        if (module == iter->GetModuleName()) {
-            STANDBYSERVICE_LOGI("[PowerOverused] Subscriber module match successful, starting to callback. "
-                "module: %{public}s, level: %{public}u.", module.c_str(), level);
-            iter->OnPowerOverused(module, level);
-        }
-    }
+    STANDBYSERVICE_LOGI("[PowerOverused] Subscriber module match successful, starting to callback. "
+        "module: %{public}s, level: %{public}u.", module.c_str(), level);
+    notifier_->Notify(subscribers, POWER_OVERUSED_NOTIFY_KEY + module,
+        [module, level](const sptr<IStandbyServiceSubscriber>& subscriber) {
+            subscriber->OnPowerOverused(module, level);
+        });
 }
 
 void StandbyStateSubscriber::NotifyLowpowerActionByCallback(const std::string& module, uint32_t action)
 {
     UpdateCallBackMap(moduleActionLock_, moduleActionMap_, module, action);
 
-    std::lock_guard<std::mutex> lock(subscriberLock_);
-    if (subscriberList_.empty()) {
+    auto subscribers = GetSubscribers(module);
+    if (subscribers.empty()) {
         STANDBYSERVICE_LOGW("[ActionChanged] Sleep state Subscriber List is empty.");
         return;
     }
 
-    for (auto iter : subscriberList_) {
-        if (module == iter->GetModuleName()) {
-            STANDBYSERVICE_LOGI("[ActionChanged] Subscriber module match successful, starting to callback. "
-                "module: %{public}s, action: %{public}u.", module.c_str(), action);
-            iter->OnActionChanged(module, action);
-        }
-    }
+    STANDBYSERVICE_LOGI("[ActionChanged] Subscriber module match successful, starting to callback. "
+        "module: %{public}s, action: %{public}u.", module.c_str(), action);
+    notifier_->Notify(subscribers, LOWPOWER_ACTION_NOTIFY_KEY + module,
+        [module, action](const sptr<IStandbyServiceSubscriber>& subscriber) {
+            subscriber->OnActionChanged(module, action);
+        });
 }
 
 void StandbyStateSubscriber::NotifyAllowChangedByCommonEvent(int32_t uid, const std::string& name,
@@ -235,7 +279,10 @@ void StandbyStateSubscriber::NotifyLowpowerActionOnRegister(const sptr<IStandbyS
 
     STANDBYSERVICE_LOGI("[ActionChanged] Subscriber callback when register, "
         "module: %{public}s, action: %{public}u.", module.c_str(), action);
-    subscriber->OnActionChanged(module, action);
+    notifier_->Notify({subscriber}, LOWPOWER_ACTION_NOTIFY_KEY + module,
+        [module, action](const sptr<IStandbyServiceSubscriber>& registered) {
+            registered->OnActionChanged(module, action);
+        });
 }
 
 void StandbyStateSubscriber::NotifyPowerOnRegister(const sptr<IStandbyServiceSubscriber>& subscriber)
@@ -251,7 +298,10 @@ void StandbyStateSubscriber::NotifyPowerOnRegister(const sptr<IStandbyServiceSub
 
     STANDBYSERVICE_LOGI("[PowerOverused] Subscriber callback when register, "
         "module: %{public}s, level: %{public}u.", module.c_str(), level);
-    subscriber->OnPowerOverused(module, level);
+    notifier_->Notify({subscriber}, POWER_OVERUSED_NOTIFY_KEY + module,
+        [module, level](const sptr<IStandbyServiceSubscriber>& registered) {
+            registered->OnPowerOverused(module, level);
+        });
 }
 
 void StandbyStateSubscriber::HandleSubscriberDeath(const wptr<IRemoteObject>& remote)
@@ -272,6 +322,7 @@ void StandbyStateSubscriber::HandleSubscriberDeath(const wptr<IRemoteObject>& re
         return;
     }
     subscriberList_.erase(subscriberIter);
+    notifier_->RemoveSubscriber(proxy);
     STANDBYSERVICE_LOGD("suscriber death, remove it from list");
 }
 
@@ -290,17 +341,38 @@ void StandbyStateSubscriber::UpdateCallBackMap(std::mutex& moduleLock, std::unor
 
 void StandbyStateSubscriber::ShellDump(const std::vector<std::string>& argsInStr, std::string& result)
 {
-    std::lock_guard<std::mutex> subcriberLock(subscriberLock_);
-    if (subscriberList_.empty()) {
-        result += "subscriber observer record is empty\n";
-        return;
+    {
+        std::lock_guard<std::mutex> subcriberLock(subscriberLock_);
+        if (subscriberList_.empty()) {
+            result += "subscriber observer record is empty\n";
+            return;
+        }
+        std::stringstream stream;
+        for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); iter++) {
+            stream << "\tobserverName: " << (*iter)->GetSubscriberName() << "\n";
+            result += stream.str();
+            stream.clear();
+        }
     }
-    std::stringstream stream;
-    for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); iter++) {
-        stream << "\tobserverName: " << (*iter)->GetSubscriberName() << "\n";
-        result += stream.str();
-        stream.clear();
+    notifier_->ShellDump(result);
+}
+
+std::vector<sptr<IStandbyServiceSubscriber>> StandbyStateSubscriber::GetSubscribers()
+{
+    std::lock_guard<std::mutex> subcriberLock(subscriberLock_);
+    return std::vector<sptr<IStandbyServiceSubscriber>>(subscriberList_.begin(), subscriberList_.end());
+}
+
+std::vector<sptr<IStandbyServiceSubscriber>> StandbyStateSubscriber::GetSubscribers(const std::string& module)
+{
+    std::lock_guard<std::mutex> subcriberLock(subscriberLock_);
+    std::vector<sptr<IStandbyServiceSubscriber>> subscribers;
+    for (const auto& subscriber : subscriberList_) {
+        if (module == subscriber->GetModuleName()) {
+            subscribers.emplace_back(subscriber);
+        }
     }
+    return subscribers;
 }
 
 std::list<sptr<IStandbyServiceSubscriber>>::iterator StandbyStateSubscriber::FindSubcriberObject(
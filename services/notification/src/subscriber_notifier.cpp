@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "subscriber_notifier.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "standby_service_log.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+const std::string NOTIFY_WORKER_NAME = "StandbyNotify";
+// a worker yields the channel after delivering the batch, so that other subscribers are not kept waiting
+constexpr uint32_t DRAIN_BATCH_NUM = 8;
+
+uint64_t GetDurationUs(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end)
+{
+    return static_cast<uint64_t>(std::max(static_cast<int64_t>(0), static_cast<int64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count())));
+}
+
+const char* GetPolicyName(NotifyOverflowPolicy overflowPolicy)
+{
+    switch (overflowPolicy) {
+        case NotifyOverflowPolicy::DROP_OLDEST:
+            return "drop oldest";
+        case NotifyOverflowPolicy::DROP_NEWEST:
+            return "drop newest";
+        default:
+            return "coalesce";
+    }
+}
+}
+
+SubscriberNotifier::SubscriberNotifier() : workerPool_(NOTIFY_WORKER_NAME) {}
+
+SubscriberNotifier::~SubscriberNotifier()
+{
+    Stop();
+}
+
+void SubscriberNotifier::Start(uint32_t workerNum, uint32_t queueCapacity, NotifyOverflowPolicy overflowPolicy)
+{
+    {
+        std::lock_guard<std::mutex> lock(channelMutex_);
+        queueCapacity_ = queueCapacity;
+        overflowPolicy_ = overflowPolicy;
+        if (workerNum_ != 0) {
+            return;
+        }
+        workerNum_ = workerNum;
+    }
+    if (workerPool_.Start(static_cast<int>(workerNum)) != ERR_OK) {
+        STANDBYSERVICE_LOGE("failed to start notify workers, deliver callbacks in the reporting thread");
+        std::lock_guard<std::mutex> lock(channelMutex_);
+        workerNum_ = 0;
+    }
+}
+
+void SubscriberNotifier::Stop()
+{
+    workerPool_.Stop();
+    std::lock_guard<std::mutex> lock(channelMutex_);
+    workerNum_ = 0;
+    for (auto& [remote, channel] : channels_) {
+        channel->queue_.clear();
+        channel->isDraining_ = false;
+    }
+}
+
+void SubscriberNotifier::AddSubscriber(const sptr<IStandbyServiceSubscriber>& subscriber)
+{
+    if (subscriber == nullptr || subscriber->AsObject() == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(channelMutex_);
+    auto& channel = channels_[subscriber->AsObject().GetRefPtr()];
+    if (channel == nullptr) {
+        channel = std::make_shared<Channel>();
+        channel->subscriber_ = subscriber;
+    }
+}
+
+void SubscriberNotifier::RemoveSubscriber(const sptr<IRemoteObject>& remote)
+{
+    std::lock_guard<std::mutex> lock(channelMutex_);
+    auto iter = channels_.find(remote.GetRefPtr());
+    if (iter == channels_.end()) {
+        return;
+    }
+    // a worker draining the channel stops once it finds the queue empty
+    iter->second->queue_.clear();
+    channels_.erase(iter);
+}
+
+void SubscriberNotifier::Notify(const std::vector<sptr<IStandbyServiceSubscriber>>& subscribers,
+    const std::string& key, const Callback& callback, bool isLossless)
+{
+    Clock::time_point now = Clock::now();
+    std::vector<std::shared_ptr<Channel>> idleChannels;
+    {
+        std::lock_guard<std::mutex> lock(channelMutex_);
+        for (const auto& subscriber : subscribers) {
+            if (subscriber == nullptr || subscriber->AsObject() == nullptr) {
+                continue;
+            }
+            auto iter = channels_.find(subscriber->AsObject().GetRefPtr());
+            if (iter == channels_.end()) {
+                continue;
+            }
+            EnqueueLocked(*iter->second, {key, callback, now, isLossless});
+            if (!iter->second->isDraining_) {
+                iter->second->isDraining_ = true;
+                idleChannels.emplace_back(iter->second);
+            }
+        }
+    }
+    for (const auto& channel : idleChannels) {
+        Schedule(channel);
+    }
+}
+
+void SubscriberNotifier::EnqueueLocked(Channel& channel, Notification notification)
+{
+    if (channel.queue_.size() < queueCapacity_ || notification.isLossless_) {
+        channel.queue_.emplace_back(std::move(notification));
+        return;
+    }
+    if (overflowPolicy_ == NotifyOverflowPolicy::DROP_NEWEST) {
+        ++channel.droppedCount_;
+        return;
+    }
+    if (overflowPolicy_ == NotifyOverflowPolicy::COALESCE && !notification.key_.empty()) {
+        auto iter = std::find_if(channel.queue_.begin(), channel.queue_.end(),
+            [&notification](const Notification& queued) {
+                return !queued.isLossless_ && queued.key_ == notification.key_;
+            });
+        if (iter != channel.queue_.end()) {
+            // the new one is queued behind the others, as if the old one had been delivered before them
+            channel.queue_.erase(iter);
+            channel.queue_.emplace_back(std::move(notification));
+            ++channel.coalescedCount_;
+            return;
+        }
+    }
+    ++channel.droppedCount_;
+    auto oldest = std::find_if(channel.queue_.begin(), channel.queue_.end(),
+        [](const Notification& queued) { return !queued.isLossless_; });
+    if (oldest == channel.queue_.end()) {
+        // the queue is full of lossless notifications, none of them can make room
+        return;
+    }
+    channel.queue_.erase(oldest);
+    channel.queue_.emplace_back(std::move(notification));
+}
+
+void SubscriberNotifier::Schedule(const std::shared_ptr<Channel>& channel)
+{
+    // the workers are joined before the notifier is destroyed
+    workerPool_.AddTask([this, channel]() {
+        Drain(channel);
+    });
+}
+
+void SubscriberNotifier::Drain(const std::shared_ptr<Channel>& channel)
+{
+    for (uint32_t count = 0; count < DRAIN_BATCH_NUM; ++count) {
+        Notification notification;
+        {
+            std::lock_guard<std::mutex> lock(channelMutex_);
+            if (channel->queue_.empty()) {
+                channel->isDraining_ = false;
+                return;
+            }
+            notification = std::move(channel->queue_.front());
+            channel->queue_.pop_front();
+        }
+        Clock::time_point callTime = Clock::now();
+        if (notification.callback_) {
+            notification.callback_(channel->subscriber_);
+        }
+        Clock::time_point doneTime = Clock::now();
+        std::lock_guard<std::mutex> lock(channelMutex_);
+        uint64_t latencyUs = GetDurationUs(notification.enqueueTime_, doneTime);
+        ++channel->deliveredCount_;
+        channel->totalLatencyUs_ += latencyUs;
+        channel->maxLatencyUs_ = std::max(channel->maxLatencyUs_, latencyUs);
+        channel->maxCallUs_ = std::max(channel->maxCallUs_, GetDurationUs(callTime, doneTime));
+    }
+    Schedule(channel);
+}
+
+void SubscriberNotifier::ShellDump(std::string& result)
+{
+    std::lock_guard<std::mutex> lock(channelMutex_);
+    std::stringstream stream;
+    stream << "subscriber notification: workers " << workerNum_ << ", queue capacity " << queueCapacity_
+        << ", overflow policy " << GetPolicyName(overflowPolicy_) << "\n";
+    for (const auto& [remote, channel] : channels_) {
+        uint64_t avgLatencyUs = channel->deliveredCount_ == 0 ? 0 :
+            channel->totalLatencyUs_ / channel->deliveredCount_;
+        stream << "\t" << channel->subscriber_->GetSubscriberName() << ": queued " << channel->queue_.size()
+            << ", delivered " << channel->deliveredCount_ << ", dropped " << channel->droppedCount_
+            << ", coalesced " << channel->coalescedCount_ << ", avg latency " << avgLatencyUs << "us"
+            << ", max latency " << channel->maxLatencyUs_ << "us, max call " << channel->maxCallUs_ << "us\n";
+    }
+    result += stream.str();
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstdlib>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "nlohmann/json.hpp"
+
+#include "scene_info_decoder.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+    struct CapturedSceneInfo {
+        const char* name_;
+        const SceneInfoSchema* schema_;
+        std::string sceneInfo_;
+    };
+
+    // payloads as reported by resource schedule service, app install events carry the full bundle info
+    const std::array<CapturedSceneInfo, 6> CAPTURED_SCENE_INFOS = {{
+        {"CallState", &SceneInfoSchemas::CALL_STATE_CHANGED,
+            R"({"accountId":0,"bundleName":"com.ohos.callui","state":"4","teleNumber":"","uid":"20010017"})"},
+        {"GattAppRegister", &SceneInfoSchemas::GATT_APP_REGISTER,
+            R"({"ACTION":"register","UID":"20020041","PID":"4821","SIDE":"client","APPID":"12",)"
+            R"("ADDRESS":"00:00:00:00:00:00"})"},
+        {"BrokerGattConnect", &SceneInfoSchemas::BROKER_GATT_CONNECT,
+            R"({"clientIf":"5","pkg":"com.example.wearable","address":"AA:BB:CC:DD:EE:FF","transport":"2"})"},
+        {"EfficiencyResources", &SceneInfoSchemas::EFFICIENCY_RESOURCES_STATE_CHANGED,
+            R"({"bundleName":"com.example.music","pid":3921,"uid":20010042,"resourceNumber":16,)"
+            R"("isPersist":false,"timeOut":0,"reason":"play music in background","isProcess":false})"},
+        {"AudioRenderer", &SceneInfoSchemas::AUDIO_STATE_CHANGED,
+            R"({"uid":"20010042","pid":"3921","sessionId":"100004","rendererState":"2",)"
+            R"("streamUsage":"1","contentType":"2"})"},
+        {"AppInstall", &SceneInfoSchemas::APP_INSTALL_UNINSTALL,
+            R"({"bundleName":"com.example.music","uid":20010042,"userId":100,"appIndex":0,)"
+            R"("abilities":[{"name":"EntryAbility","labelId":16777216,"skills":[{"actions":)"
+            R"(["action.system.home"],"entities":["entity.system.home"]}]}],)"
+            R"("moduleNames":["entry","feature"],"versionName":"1.0.2","isSystemApp":false})"},
+    }};
+
+    // the field extraction of the handlers before the schema decoder
+    int64_t DecodeWithDom(const std::string& sceneInfo, const SceneInfoSchema& schema)
+    {
+        nlohmann::json payload = nlohmann::json::parse(sceneInfo, nullptr, false);
+        if (payload.is_discarded()) {
+            return -1;
+        }
+        int64_t checksum = 0;
+        for (uint32_t index = 0; index < schema.fieldNum_; ++index) {
+            std::string key(schema.fields_[index].key_);
+            if (!payload.contains(key)) {
+                return -1;
+            }
+            const auto& field = payload.at(key);
+            switch (schema.fields_[index].type_) {
+                case SceneFieldType::STRING:
+                    checksum += static_cast<int64_t>(field.get<std::string>().size());
+                    break;
+                case SceneFieldType::INT_STRING:
+                    checksum += atoi(field.get<std::string>().c_str());
+                    break;
+                case SceneFieldType::INT:
+                    checksum += field.is_string() ? atoi(field.get<std::string>().c_str()) : field.get<int32_t>();
+                    break;
+                case SceneFieldType::UINT:
+                    checksum += field.get<uint32_t>();
+                    break;
+            }
+        }
+        return checksum;
+    }
+
+    int64_t DecodeWithSchema(const std::string& sceneInfo, const SceneInfoSchema& schema)
+    {
+        SceneInfoFields fields;
+        if (SceneInfoDecoder::Decode(sceneInfo, schema, fields) != SceneDecodeResult::OK) {
+            return -1;
+        }
+        int64_t checksum = 0;
+        for (uint32_t index = 0; index < schema.fieldNum_; ++index) {
+            checksum += schema.fields_[index].type_ == SceneFieldType::STRING ?
+                static_cast<int64_t>(fields[index].str_.size()) : fields[index].num_;
+        }
+        return checksum;
+    }
+
+    template<int64_t (*Decode)(const std::string&, const SceneInfoSchema&)>
+    void RunDecode(benchmark::State& state)
+    {
+        const CapturedSceneInfo& captured = CAPTURED_SCENE_INFOS[state.range(0)];
+        state.SetLabel(captured.name_);
+        if (Decode(captured.sceneInfo_, *captured.schema_) < 0) {
+            state.SkipWithError("captured sceneInfo is not decoded");
+            return;
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Decode(captured.sceneInfo_, *captured.schema_));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+            static_cast<int64_t>(captured.sceneInfo_.size()));
+    }
+}
+
+/**
+ * @tc.name: SceneInfoWithDom
+ * @tc.desc: extract the fields of captured sceneInfo through a nlohmann json document.
+ */
+static void SceneInfoWithDom(benchmark::State& state)
+{
+    RunDecode<DecodeWithDom>(state);
+}
+BENCHMARK(SceneInfoWithDom)->DenseRange(0, CAPTURED_SCENE_INFOS.size() - 1);
+
+/**
+ * @tc.name: SceneInfoWithSchema
+ * @tc.desc: extract the fields of captured sceneInfo through SceneInfoDecoder.
+ */
+static void SceneInfoWithSchema(benchmark::State& state)
+{
+    RunDecode<DecodeWithSchema>(state);
+}
+BENCHMARK(SceneInfoWithSchema)->DenseRange(0, CAPTURED_SCENE_INFOS.size() - 1);
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+
+BENCHMARK_MAIN();
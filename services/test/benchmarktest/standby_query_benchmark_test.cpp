@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "caller_permission_cache.h"
+#include "event_handler.h"
+#include "event_runner.h"
+#include "standby_state.h"
+#include "standby_state_snapshot.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+    constexpr uint32_t TOKEN_ID = 537000000;
+    constexpr int32_t LOAD_CHAIN_NUM = 4;
+    constexpr int64_t LOAD_TASK_US = 50;
+
+    /**
+     * @brief event loop kept busy by chains of short tasks, like the service handler running strategy work.
+     */
+    class BusyEventLoop {
+    public:
+        BusyEventLoop()
+        {
+            handler_ = std::make_shared<AppExecFwk::EventHandler>(
+                AppExecFwk::EventRunner::Create("StandbyQueryBenchmark"));
+            for (int32_t index = 0; index < LOAD_CHAIN_NUM; ++index) {
+                PostLoadTask();
+            }
+        }
+
+        std::shared_ptr<AppExecFwk::EventHandler>& GetHandler()
+        {
+            return handler_;
+        }
+
+        // only accessed in the handler thread, as the state read by the posted query
+        uint32_t curState_ {StandbyState::SLEEP};
+
+    private:
+        void PostLoadTask()
+        {
+            handler_->PostTask([this]() {
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(LOAD_TASK_US);
+                while (std::chrono::steady_clock::now() < deadline) {}
+                PostLoadTask();
+            });
+        }
+
+        std::shared_ptr<AppExecFwk::EventHandler> handler_ {nullptr};
+    };
+
+    BusyEventLoop& GetBusyEventLoop()
+    {
+        // never destroyed, the load chains keep running until the process exits
+        static BusyEventLoop* busyEventLoop = new BusyEventLoop();
+        return *busyEventLoop;
+    }
+}
+
+/**
+ * @tc.name: IsDeviceInStandbyWithSyncTask
+ * @tc.desc: query the state by a synchronous task posted to a busy event loop, the path before the snapshot.
+ */
+static void IsDeviceInStandbyWithSyncTask(benchmark::State& state)
+{
+    auto& busyEventLoop = GetBusyEventLoop();
+    auto& handler = busyEventLoop.GetHandler();
+    for (auto _ : state) {
+        bool isStandby = false;
+        handler->PostSyncTask([&busyEventLoop, &isStandby]() {
+            isStandby = (busyEventLoop.curState_ == StandbyState::SLEEP);
+            }, AppExecFwk::EventQueue::Priority::HIGH);
+        benchmark::DoNotOptimize(isStandby);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(IsDeviceInStandbyWithSyncTask)->Threads(1)->Threads(4)->UseRealTime();
+
+/**
+ * @tc.name: IsDeviceInStandbyWithSnapshot
+ * @tc.desc: query the state from the published snapshot with the caller permission cached, while the event loop
+ *           is equally busy.
+ */
+static void IsDeviceInStandbyWithSnapshot(benchmark::State& state)
+{
+    static StandbyStateSnapshot snapshot;
+    static CallerPermissionCache permissionCache;
+    GetBusyEventLoop();
+    snapshot.Publish(StandbyState::SLEEP, 0);
+    permissionCache.Put(TOKEN_ID, true);
+    for (auto _ : state) {
+        bool isGranted = false;
+        bool isStandby = false;
+        uint32_t curState = StandbyState::WORKING;
+        uint32_t curPhase = 0;
+        if (permissionCache.Get(TOKEN_ID, isGranted) && isGranted && snapshot.Load(curState, curPhase)) {
+            isStandby = (curState == StandbyState::SLEEP);
+        }
+        benchmark::DoNotOptimize(isStandby);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(IsDeviceInStandbyWithSnapshot)->Threads(1)->Threads(4)->UseRealTime();
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -12,9 +12,16 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <fstream>
+#include <iterator>
+
 #include "gtest/gtest.h"
 #include "gtest/hwext/gtest-multithread.h"
+#include "allow_expiry_index.h"
+#include "allow_list_change_aggregator.h"
 #include "allow_record.h"
+#include "allow_record_index.h"
+#include "allow_record_journal.h"
 
 using namespace testing::ext;
 using namespace testing::mt;
@@ -30,6 +37,8 @@ namespace {
     const uint32_t DEFAULT_ALLOW_TYPE_INDEX = 1;
     const int64_t DEFAULT_END_TIME = 1;
     const std::string DEFAULT_REASON = "test";
+    const std::string TEST_SNAPSHOT_PATH = "/data/service/el1/public/device_standby/allow_record_test";
+    const std::string TEST_JOURNAL_PATH = "/data/service/el1/public/device_standby/allow_record_test_journal";
 }
 class AllowRecordUnitTest : public testing::Test {
 public:
@@ -79,5 +88,184 @@ HWTEST_F(AllowRecordUnitTest, AllowRecordUnitTest_001, TestSize.Level1)
     payload["allowTimeList"] = vector3;
     EXPECT_EQ(allowRecord->ParseFromJson(payload), true);
 }
+
+/**
+ * @tc.name: AllowRecordUnitTest_002
+ * @tc.desc: test AllowRecordJournal flush, replay and compaction
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AllowRecordUnitTest, AllowRecordUnitTest_002, TestSize.Level1)
+{
+    remove(TEST_SNAPSHOT_PATH.c_str());
+    remove(TEST_JOURNAL_PATH.c_str());
+    auto journal = std::make_shared<AllowRecordJournal>(TEST_SNAPSHOT_PATH, TEST_JOURNAL_PATH);
+    nlohmann::json root;
+    EXPECT_FALSE(journal->Load(root));
+
+    AllowRecord allowRecord {DEFAULT_UID, DEFAULT_PID, DEFAULT_BUNDLE_NAME, DEFAULT_ALLOW_TYPE};
+    allowRecord.SetAllowTime(AllowTime {0, DEFAULT_END_TIME, DEFAULT_REASON});
+    journal->RecordUpdate("0_test", allowRecord.ParseToJson());
+    journal->RecordUpdate("1_test", allowRecord.ParseToJson());
+    journal->RecordRemove("1_test");
+    EXPECT_TRUE(journal->Flush());
+
+    auto reloaded = std::make_shared<AllowRecordJournal>(TEST_SNAPSHOT_PATH, TEST_JOURNAL_PATH);
+    EXPECT_TRUE(reloaded->Load(root));
+    EXPECT_TRUE(root.contains("0_test"));
+    EXPECT_FALSE(root.contains("1_test"));
+    AllowRecord parsedRecord;
+    EXPECT_TRUE(parsedRecord.ParseFromJson(root["0_test"]));
+    EXPECT_EQ(parsedRecord.name_, DEFAULT_BUNDLE_NAME);
+
+    EXPECT_TRUE(reloaded->Compact(root));
+    EXPECT_FALSE(reloaded->NeedsCompaction());
+    nlohmann::json compacted;
+    EXPECT_TRUE(reloaded->Load(compacted));
+    EXPECT_EQ(compacted, root);
+    remove(TEST_SNAPSHOT_PATH.c_str());
+    remove(TEST_JOURNAL_PATH.c_str());
+}
+
+/**
+ * @tc.name: AllowRecordUnitTest_003
+ * @tc.desc: test AllowExpiryIndex move and batch expiry
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AllowRecordUnitTest, AllowRecordUnitTest_003, TestSize.Level1)
+{
+    AllowExpiryIndex expiryIndex;
+    EXPECT_EQ(expiryIndex.GetEarliestDeadline(), AllowExpiryIndex::NO_DEADLINE);
+    expiryIndex.Update(DEFAULT_UID, DEFAULT_BUNDLE_NAME, 0, 100);
+    expiryIndex.Update(DEFAULT_UID, DEFAULT_BUNDLE_NAME, 1, 100);
+    expiryIndex.Update(DEFAULT_UID + 1, DEFAULT_BUNDLE_NAME, 0, 300);
+    EXPECT_EQ(expiryIndex.Size(), 3);
+    expiryIndex.Update(DEFAULT_UID, DEFAULT_BUNDLE_NAME, 0, 200);
+    EXPECT_EQ(expiryIndex.Size(), 3);
+    EXPECT_EQ(expiryIndex.GetEarliestDeadline(), 100);
+    expiryIndex.Remove(DEFAULT_UID, DEFAULT_BUNDLE_NAME, 1);
+    EXPECT_EQ(expiryIndex.GetEarliestDeadline(), 200);
+    EXPECT_TRUE(expiryIndex.PopExpired(199).empty());
+    auto expiredEntries = expiryIndex.PopExpired(300);
+    EXPECT_EQ(expiredEntries.size(), 2);
+    EXPECT_EQ(expiryIndex.GetEarliestDeadline(), AllowExpiryIndex::NO_DEADLINE);
+}
+
+/**
+ * @tc.name: AllowRecordUnitTest_004
+ * @tc.desc: test AllowRecordIndex lookup and per type posting lists
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AllowRecordUnitTest, AllowRecordUnitTest_004, TestSize.Level1)
+{
+    AllowRecordIndex recordIndex;
+    EXPECT_EQ(recordIndex.Find(DEFAULT_UID, DEFAULT_BUNDLE_NAME), AllowRecordIndex::INVALID_SLOT);
+    auto [slot, inserted] = recordIndex.Emplace(DEFAULT_UID, DEFAULT_PID, DEFAULT_BUNDLE_NAME);
+    EXPECT_TRUE(inserted);
+    EXPECT_FALSE(recordIndex.Emplace(DEFAULT_UID, DEFAULT_PID, DEFAULT_BUNDLE_NAME).second);
+    EXPECT_EQ(recordIndex.Find(DEFAULT_UID, DEFAULT_BUNDLE_NAME), slot);
+
+    AllowRecord& allowRecord = recordIndex.Get(slot);
+    EXPECT_TRUE(allowRecord.SetAllowTime(AllowTime {DEFAULT_ALLOW_TYPE_INDEX, DEFAULT_END_TIME, DEFAULT_REASON}));
+    EXPECT_FALSE(allowRecord.SetAllowTime(AllowTime {ALLOW_TIME_SLOT_NUM, DEFAULT_END_TIME, DEFAULT_REASON}));
+    recordIndex.Sync(slot);
+    uint32_t visited = 0;
+    recordIndex.ForEachOfType(DEFAULT_ALLOW_TYPE_INDEX, [&visited](AllowRecord&) { ++visited; });
+    recordIndex.ForEachOfType(0, [&visited](AllowRecord&) { ++visited; });
+    EXPECT_EQ(visited, 1);
+
+    AllowRecord otherRecord {DEFAULT_UID + 1, DEFAULT_PID, DEFAULT_BUNDLE_NAME, DEFAULT_ALLOW_TYPE};
+    otherRecord.SetAllowTime(AllowTime {DEFAULT_ALLOW_TYPE_INDEX, DEFAULT_END_TIME, DEFAULT_REASON});
+    recordIndex.Insert(otherRecord);
+    EXPECT_EQ(recordIndex.Size(), 2);
+
+    recordIndex.Erase(slot);
+    visited = 0;
+    recordIndex.ForEachOfType(DEFAULT_ALLOW_TYPE_INDEX, [&visited](AllowRecord&) { ++visited; });
+    EXPECT_EQ(visited, 1);
+    EXPECT_EQ(recordIndex.Find(DEFAULT_UID, DEFAULT_BUNDLE_NAME), AllowRecordIndex::INVALID_SLOT);
+
+    // the interned name is reclaimed with its last record and its id is reused by the next name
+    recordIndex.Erase(recordIndex.Find(DEFAULT_UID + 1, DEFAULT_BUNDLE_NAME));
+    EXPECT_TRUE(recordIndex.nameIds_.empty());
+    recordIndex.Emplace(DEFAULT_UID, DEFAULT_PID, "other");
+    EXPECT_EQ(recordIndex.names_.size(), 1);
+    recordIndex.Clear();
+    EXPECT_TRUE(recordIndex.Empty());
+}
+
+/**
+ * @tc.name: AllowRecordUnitTest_005
+ * @tc.desc: test AllowListChangeAggregator folds changes into net diffs
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AllowRecordUnitTest, AllowRecordUnitTest_005, TestSize.Level1)
+{
+    AllowListChangeAggregator aggregator;
+    EXPECT_TRUE(aggregator.Empty());
+    aggregator.Add(DEFAULT_UID, DEFAULT_BUNDLE_NAME, AllowType::NETWORK | AllowType::TIMER, true);
+    aggregator.Add(DEFAULT_UID, DEFAULT_BUNDLE_NAME, AllowType::TIMER, false);
+    aggregator.Add(DEFAULT_UID, DEFAULT_BUNDLE_NAME, AllowType::RUNNING_LOCK, false);
+    aggregator.Add(DEFAULT_UID + 1, DEFAULT_BUNDLE_NAME, AllowType::NETWORK, false);
+    aggregator.Add(DEFAULT_UID + 1, DEFAULT_BUNDLE_NAME, AllowType::NETWORK, true);
+    EXPECT_FALSE(aggregator.Empty());
+
+    std::vector<AllowListChange> changes = aggregator.Drain();
+    ASSERT_EQ(changes.size(), 2);
+    EXPECT_EQ(changes[0].uid_, DEFAULT_UID);
+    EXPECT_EQ(changes[0].allowType_, AllowType::NETWORK);
+    EXPECT_TRUE(changes[0].added_);
+    EXPECT_EQ(changes[1].allowType_, AllowType::RUNNING_LOCK);
+    EXPECT_FALSE(changes[1].added_);
+    EXPECT_TRUE(aggregator.Empty());
+    EXPECT_TRUE(aggregator.Drain().empty());
+}
+
+/**
+ * @tc.name: AllowRecordUnitTest_006
+ * @tc.desc: test AllowRecordJournal skips a journal left behind by an interrupted compaction
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AllowRecordUnitTest, AllowRecordUnitTest_006, TestSize.Level1)
+{
+    remove(TEST_SNAPSHOT_PATH.c_str());
+    remove(TEST_JOURNAL_PATH.c_str());
+    auto journal = std::make_shared<AllowRecordJournal>(TEST_SNAPSHOT_PATH, TEST_JOURNAL_PATH);
+    nlohmann::json root;
+    EXPECT_FALSE(journal->Load(root));
+    AllowRecord allowRecord {DEFAULT_UID, DEFAULT_PID, DEFAULT_BUNDLE_NAME, DEFAULT_ALLOW_TYPE};
+    allowRecord.SetAllowTime(AllowTime {0, DEFAULT_END_TIME, DEFAULT_REASON});
+    journal->RecordUpdate("0_test", allowRecord.ParseToJson());
+    EXPECT_TRUE(journal->Flush());
+    std::string staleJournal;
+    {
+        std::ifstream fin(TEST_JOURNAL_PATH);
+        staleJournal.assign(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+    }
+
+    // the record is removed and compacted, then the device powers off before the journal is truncated
+    EXPECT_TRUE(journal->Compact(nlohmann::json::object()));
+    {
+        std::ofstream fout(TEST_JOURNAL_PATH, std::ios::trunc);
+        fout << staleJournal;
+    }
+    auto reloaded = std::make_shared<AllowRecordJournal>(TEST_SNAPSHOT_PATH, TEST_JOURNAL_PATH);
+    EXPECT_TRUE(reloaded->Load(root));
+    EXPECT_TRUE(root.empty());
+
+    // changes flushed after the stale journal is dropped are replayed
+    reloaded->RecordUpdate("1_test", allowRecord.ParseToJson());
+    EXPECT_TRUE(reloaded->Flush());
+    nlohmann::json replayed;
+    EXPECT_TRUE(std::make_shared<AllowRecordJournal>(TEST_SNAPSHOT_PATH, TEST_JOURNAL_PATH)->Load(replayed));
+    EXPECT_TRUE(replayed.contains("1_test"));
+    EXPECT_FALSE(replayed.contains("0_test"));
+    remove(TEST_SNAPSHOT_PATH.c_str());
+    remove(TEST_JOURNAL_PATH.c_str());
+}
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
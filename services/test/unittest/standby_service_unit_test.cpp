@@ -12,12 +12,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <functional>
 #include <chrono>
 #include <thread>
 #include <message_parcel.h>
 #include <climits>
 #include <dlfcn.h>
+#include <unistd.h>
 
 #include "gtest/gtest.h"
 #include "gtest/hwext/gtest-multithread.h"
@@ -47,6 +49,10 @@
 #include "bundle_manager_helper.h"
 #include "standby_config_manager.h"
 #include "app_state_observer.h"
+#include "event_ingress_filter.h"
+#include "mpsc_queue.h"
+#include "scene_info_decoder.h"
+#include "task_lane_scheduler.h"
 #include "app_mgr_constants.h"
 #include "mock_common_event.h"
 #include "ibundle_manager_helper.h"
@@ -62,7 +68,6 @@ namespace {
     constexpr int32_t SAMPLE_APP_UID = 10001;
     const std::string SAMPLE_BUNDLE_NAME = "name";
     const std::string DEFAULT_BUNDLENAME = "test";
-    const std::string DEFAULT_KEY = "0_test";
     const vector<std::string> COMMON_EVENT_LIST = {
         EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED,
         EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED,
@@ -113,7 +118,7 @@ void StandbyServiceUnitTest::SetUpTestCase()
 void StandbyServiceUnitTest::TearDown()
 {
     SleepForFC();
-    StandbyServiceImpl::GetInstance()->allowInfoMap_.clear();
+    StandbyServiceImpl::GetInstance()->allowRecordIndex_.Clear();
 }
 
 void StandbyServiceUnitTest::TearDownTestCase()
@@ -309,8 +314,8 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_005, TestSize.Level1)
     StandbyServiceImpl::GetInstance()->ShellDumpInner({"-P", "--get", "127", "false", "true"}, result);
     StandbyServiceImpl::GetInstance()->ShellDumpInner({"-P", "--allowlist", "127", "false", "true"}, result);
     auto allowRecord = std::make_shared<AllowRecord>(0, 0, "name", AllowType::NETWORK);
-    allowRecord->allowTimeList_.emplace_back(AllowTime{0, INT64_MAX, "reason"});
-    StandbyServiceImpl::GetInstance()->allowInfoMap_.emplace(DEFAULT_KEY, allowRecord);
+    allowRecord->SetAllowTime(AllowTime{0, INT64_MAX, "reason"});
+    StandbyServiceImpl::GetInstance()->allowRecordIndex_.Insert(*allowRecord);
     StandbyServiceImpl::GetInstance()->ShellDumpInner({"-D"}, result);
     SleepForFC();
     EXPECT_NE(StandbyService::GetInstance()->Dump(-1, args), ERR_OK);
@@ -326,6 +331,10 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_006, TestSize.Level1)
 {
     EXPECT_NE(StandbyServiceImpl::GetInstance()->RegisterPlugin("test_standby.z.so"), ERR_OK);
     EXPECT_NE(StandbyServiceImpl::GetInstance()->RegisterPlugin("libstandby_utils_policy.z.so"), ERR_OK);
+    // a library without the interface version is rejected before its register function is called
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->RegisterPlugin("libstandby_utils_policy.z.so"),
+        ERR_STANDBY_PLUGIN_NOT_AVAILABLE);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->registerPlugin_, nullptr);
 }
 
 /**
@@ -349,30 +358,34 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_007, TestSize.Level1)
 HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_008, TestSize.Level0)
 {
     StandbyServiceImpl::GetInstance()->ParsePersistentData();
-    auto allowRecord = std::make_shared<AllowRecord>(0, 0, "name", AllowType::NETWORK);
-    allowRecord->allowTimeList_.emplace_back(AllowTime{0, INT64_MAX, "reason"});
-    allowRecord = std::make_shared<AllowRecord>(-1, -1, "test", AllowType::NETWORK);
-    allowRecord->allowTimeList_.emplace_back(AllowTime{-1, INT64_MAX, "test"});
-    allowRecord = std::make_shared<AllowRecord>(-1, -1, "test", AllowType::NETWORK);
-    allowRecord->allowTimeList_.emplace_back(AllowTime{-1, INT64_MAX, "test"});
-    StandbyServiceImpl::GetInstance()->allowInfoMap_.emplace(DEFAULT_KEY, allowRecord);
+    auto& allowRecordIndex = StandbyServiceImpl::GetInstance()->allowRecordIndex_;
+    allowRecordIndex.Clear();
+    uint32_t slot = allowRecordIndex.Insert(AllowRecord {-1, -1, "test", AllowType::NETWORK});
+    // an allow type index out of range is rejected rather than stored
+    EXPECT_FALSE(allowRecordIndex.Get(slot).SetAllowTime(AllowTime{-1, INT64_MAX, "test"}));
+    EXPECT_TRUE(allowRecordIndex.Get(slot).SetAllowTime(AllowTime{0, INT64_MAX, "test"}));
+    allowRecordIndex.Sync(slot);
     StandbyServiceImpl::GetInstance()->DumpPersistantData();
-    StandbyServiceImpl::GetInstance()->ParsePersistentData();
     StandbyServiceImpl::GetInstance()->RecoverTimeLimitedTask();
-    allowRecord->allowTimeList_.clear();
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowExpiryIndex_.Size(), 1);
+    allowRecordIndex.Get(slot).ClearAllowTime();
+    allowRecordIndex.Sync(slot);
+    StandbyServiceImpl::GetInstance()->RecoverTimeLimitedTask();
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowExpiryIndex_.Size(), 0);
     StandbyServiceImpl::GetInstance()->DumpPersistantData();
     StandbyServiceImpl::GetInstance()->ParsePersistentData();
-    EXPECT_TRUE(StandbyServiceImpl::GetInstance()->allowInfoMap_.empty());
+    EXPECT_TRUE(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Empty());
     IBundleManagerHelper::MockGetAllRunningProcesses(false);
     StandbyServiceImpl::GetInstance()->ParsePersistentData();
     IBundleManagerHelper::MockGetAllRunningProcesses(true);
 
     auto emptyRecord = std::make_shared<AllowRecord>(0, 0, "name", 0);
-    emptyRecord->allowTimeList_.emplace_back(AllowTime{0, 0, "reason"});
-    StandbyServiceImpl::GetInstance()->allowInfoMap_.emplace(DEFAULT_KEY, emptyRecord);
+    emptyRecord->SetAllowTime(AllowTime{0, 0, "reason"});
+    StandbyServiceImpl::GetInstance()->allowRecordIndex_.Insert(*emptyRecord);
     StandbyServiceImpl::GetInstance()->UnapplyAllowResInner(0, "test", 0, true);
-    emptyRecord->allowTimeList_.emplace_back(AllowTime{1, 0, "reason"});
-    emptyRecord->allowTimeList_.emplace_back(AllowTime{2, 0, "reason"});
+    emptyRecord->SetAllowTime(AllowTime{1, 0, "reason"});
+    emptyRecord->SetAllowTime(AllowTime{2, 0, "reason"});
+    StandbyServiceImpl::GetInstance()->allowRecordIndex_.Insert(*emptyRecord);
     StandbyServiceImpl::GetInstance()->UnapplyAllowResInner(0, "test", AllowType::NETWORK, true);
 }
 
@@ -419,7 +432,7 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_010, TestSize.Level0)
 HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_011, TestSize.Level1)
 {
     StandbyServiceImpl::GetInstance()->RemoveAppAllowRecord(DEFAULT_UID, DEFAULT_BUNDLENAME, true);
-    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowInfoMap_.size(), 0);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Size(), 0);
 }
 
 /**
@@ -453,7 +466,7 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_013, TestSize.Level1)
     StandbyServiceImpl::GetInstance()->ApplyAllowResource(resourceRequest);
     SleepForFC();
     StandbyServiceImpl::GetInstance()->ApplyAllowResInner(resourceRequest, -1);
-    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowInfoMap_.size(), 0);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Size(), 0);
 }
 
 /**
@@ -466,10 +479,10 @@ HWTEST_F(StandbyServiceUnitTest, UpdateRecord_014, TestSize.Level1)
 {
     std::shared_ptr<AllowRecord> allowRecord = std::make_shared<AllowRecord>();
     ResourceRequest resourceRequest;
-    StandbyServiceImpl::GetInstance()->UpdateRecord(allowRecord, resourceRequest);
+    StandbyServiceImpl::GetInstance()->UpdateRecord(*allowRecord, resourceRequest);
     SleepForFC();
-    StandbyServiceImpl::GetInstance()->UpdateRecord(allowRecord, resourceRequest);
-    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowInfoMap_.size(), 0);
+    StandbyServiceImpl::GetInstance()->UpdateRecord(*allowRecord, resourceRequest);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Size(), 0);
 }
 
 /**
@@ -483,9 +496,9 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_015, TestSize.Level1)
     std::shared_ptr<AllowRecord> allowRecord = std::make_shared<AllowRecord>();
     std::shared_ptr<ResourceRequest> resourceRequest = std::make_shared<ResourceRequest>(MAX_ALLOW_TYPE_NUMBER,
         DEFAULT_UID, DEFAULT_BUNDLENAME, 10, "reason", ReasonCodeEnum::REASON_APP_API);
-    StandbyServiceImpl::GetInstance()->UpdateRecord(allowRecord, *resourceRequest);
+    StandbyServiceImpl::GetInstance()->UpdateRecord(*allowRecord, *resourceRequest);
     SleepForFC();
-    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowInfoMap_.size(), 0);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Size(), 0);
 }
 
 /**
@@ -528,8 +541,8 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_016, TestSize.Level0)
 HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_017, TestSize.Level0)
 {
     auto allowRecord = std::make_shared<AllowRecord>(DEFAULT_UID, 0, DEFAULT_BUNDLENAME, AllowType::NETWORK);
-    allowRecord->allowTimeList_.emplace_back(AllowTime{0, INT64_MAX, "reason"});
-    StandbyServiceImpl::GetInstance()->allowInfoMap_.emplace(DEFAULT_KEY, allowRecord);
+    allowRecord->SetAllowTime(AllowTime{0, INT64_MAX, "reason"});
+    StandbyServiceImpl::GetInstance()->allowRecordIndex_.Insert(*allowRecord);
 
     std::vector<AllowInfo> allowInfoList;
     StandbyServiceImpl::GetInstance()->GetAllowList(MAX_ALLOW_TYPE_NUMBER, allowInfoList,
@@ -559,17 +572,17 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_017, TestSize.Level0)
     StandbyServiceImpl::GetInstance()->UnapplyAllowResInner(DEFAULT_UID, DEFAULT_BUNDLENAME, 1, false);
     StandbyServiceImpl::GetInstance()->UnapplyAllowResInner(DEFAULT_UID, DEFAULT_BUNDLENAME, 1, true);
     allowRecord = std::make_shared<AllowRecord>(0, 0, "name", MAX_ALLOW_TYPE_NUMBER);
-    allowRecord->allowTimeList_.emplace_back(AllowTime{0, INT64_MAX, "reason"});
-    allowRecord->allowTimeList_.emplace_back(AllowTime{1, INT64_MAX, "reason"});
-    StandbyServiceImpl::GetInstance()->allowInfoMap_.emplace(DEFAULT_KEY, allowRecord);
+    allowRecord->SetAllowTime(AllowTime{0, INT64_MAX, "reason"});
+    allowRecord->SetAllowTime(AllowTime{1, INT64_MAX, "reason"});
+    StandbyServiceImpl::GetInstance()->allowRecordIndex_.Insert(*allowRecord);
     StandbyServiceImpl::GetInstance()->GetTemporaryAllowList(MAX_ALLOW_TYPE_NUM, allowInfoList,
         ReasonCodeEnum::REASON_NATIVE_API);
     StandbyServiceImpl::GetInstance()->GetPersistAllowList(MAX_ALLOW_TYPE_NUM, allowInfoList,
         true, true);
     StandbyServiceImpl::GetInstance()->GetPersistAllowList(MAX_ALLOW_TYPE_NUM, allowInfoList,
         false, true);
-    StandbyServiceImpl::GetInstance()->allowInfoMap_.clear();
-    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowInfoMap_.size(), 0);
+    StandbyServiceImpl::GetInstance()->allowRecordIndex_.Clear();
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Size(), 0);
 }
 
 /**
@@ -629,12 +642,12 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_019, TestSize.Level1)
     auto allowRecord = std::make_shared<AllowRecord>(DEFAULT_UID, 0, DEFAULT_BUNDLENAME, AllowType::NETWORK);
     auto value = allowRecord->ParseToJson();
     allowRecord->ParseFromJson(value);
-    allowRecord->allowTimeList_.emplace_back(AllowTime{0, 0, "reason"});
+    allowRecord->SetAllowTime(AllowTime{0, 0, "reason"});
     value = allowRecord->ParseToJson();
     nlohmann::json emptyValue {};
     allowRecord->ParseFromJson(emptyValue);
     allowRecord->ParseFromJson(value);
-    EXPECT_FALSE(allowRecord->allowTimeList_.empty());
+    EXPECT_NE(allowRecord->allowTimeMask_, 0);
 }
 
 /**
@@ -1050,7 +1063,7 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_042, TestSize.Level1)
     appStateObserver->OnPageShow(pageStateData);
     appStateObserver->OnPageHide(pageStateData);
     SleepForFC();
-    EXPECT_TRUE(StandbyServiceImpl::GetInstance()->allowInfoMap_.empty());
+    EXPECT_TRUE(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Empty());
 }
 
 /**
@@ -1547,5 +1560,607 @@ HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_069, TestSize.Level1)
     StandbyServiceImpl::GetInstance()->HandleAudioCapturerChanged(value, sceneInfo);
     EXPECT_NE(g_logMsg.find("uid param is invalid"), std::string::npos);
 }
+
+/**
+ * @tc.name: StandbyServiceUnitTest_070
+ * @tc.desc: test ApplyAllowResourceBatch and UnapplyAllowResourceBatch of StandbyServiceImpl.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_070, TestSize.Level1)
+{
+    std::vector<ResourceRequest> resourceRequests;
+    EXPECT_NE(StandbyServiceImpl::GetInstance()->ApplyAllowResourceBatch(resourceRequests), ERR_OK);
+    resourceRequests.emplace_back(AllowType::NETWORK, 0, "test_process", 100, "test", 1);
+    resourceRequests.emplace_back(AllowType::NETWORK, -1, "test_process", 100, "test", 1);
+    EXPECT_NE(StandbyServiceImpl::GetInstance()->ApplyAllowResourceBatch(resourceRequests), ERR_OK);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Find(0, "test_process"),
+        AllowRecordIndex::INVALID_SLOT);
+
+    resourceRequests.pop_back();
+    resourceRequests.emplace_back(AllowType::RUNNING_LOCK, 0, "test_process", 100, "test", 1);
+    resourceRequests.emplace_back(AllowType::NETWORK, 1, "test_process", 100, "test", 1);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->ApplyAllowResourceBatch(resourceRequests), ERR_OK);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->UnapplyAllowResourceBatch(resourceRequests), ERR_OK);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Find(0, "test_process"),
+        AllowRecordIndex::INVALID_SLOT);
+    EXPECT_EQ(StandbyServiceImpl::GetInstance()->allowRecordIndex_.Find(1, "test_process"),
+        AllowRecordIndex::INVALID_SLOT);
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_071
+ * @tc.desc: test cached condition clock of TimeProvider.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_071, TestSize.Level1)
+{
+    TimeProvider::RefreshCondition();
+    int64_t timeDiff {0};
+    EXPECT_TRUE(TimeProvider::TimeDiffToDayNightSwitch(timeDiff));
+    EXPECT_GE(timeDiff, 0);
+    EXPECT_LE(timeDiff, TimeConstant::MSEC_PER_DAY);
+
+    int64_t curSecTimeStamp = TimeProvider::GetWallTimeMs() / TimeConstant::MSEC_PER_SEC;
+    uint64_t conditionClock = TimeProvider::ComputeConditionClock(curSecTimeStamp);
+    EXPECT_EQ(TimeProvider::GetCondition(), static_cast<uint32_t>(conditionClock & 0x3));
+    int64_t nextSwitchSec = static_cast<int64_t>(conditionClock >> 2);
+    EXPECT_NE(TimeProvider::ComputeConditionClock(nextSwitchSec) & 0x3, conditionClock & 0x3);
+    EXPECT_EQ(TimeProvider::GetCondition(TimeConstant::SEC_PER_DAY), TimeProvider::GetCondition());
+
+    // a stale clock is recomputed on read
+    TimeProvider::conditionClock_.store(static_cast<uint64_t>(curSecTimeStamp) << 2 | ConditionType::NIGHT_STANDBY);
+    EXPECT_EQ(TimeProvider::GetCondition(), static_cast<uint32_t>(conditionClock & 0x3));
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_072
+ * @tc.desc: test app state events handled by AppStateEventQueue.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_072, TestSize.Level1)
+{
+    MpscQueue<int32_t> queue;
+    std::vector<std::thread> producers;
+    constexpr int32_t producerNum = 4;
+    constexpr int32_t eventNum = 1000;
+    for (int32_t index = 0; index < producerNum; ++index) {
+        producers.emplace_back([&queue]() {
+            for (int32_t event = 0; event < eventNum; ++event) {
+                queue.Push(event);
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    int32_t value {0};
+    int32_t popNum {0};
+    while (queue.Pop(value)) {
+        ++popNum;
+    }
+    EXPECT_EQ(popNum, producerNum * eventNum);
+
+    auto eventQueue = std::make_shared<AppStateEventQueue>(nullptr);
+    eventQueue->Enqueue({AppStateEvent::PROCESS_CREATED, SAMPLE_APP_UID, 1, SAMPLE_BUNDLE_NAME});
+    eventQueue->Enqueue({AppStateEvent::PROCESS_CREATED, SAMPLE_APP_UID, 2, SAMPLE_BUNDLE_NAME});
+    EXPECT_TRUE(eventQueue->isLivePidsSeeded_);
+    EXPECT_EQ(eventQueue->livePids_[SAMPLE_BUNDLE_NAME].size(), 2);
+    AppStateEvent diedEvent {AppStateEvent::PROCESS_DIED, SAMPLE_APP_UID, 1, SAMPLE_BUNDLE_NAME};
+    eventQueue->Enqueue(AppStateEvent(diedEvent));
+    EXPECT_TRUE(eventQueue->IsAppAlive(diedEvent));
+    diedEvent.pid_ = 2;
+    eventQueue->Enqueue(AppStateEvent(diedEvent));
+    EXPECT_FALSE(eventQueue->IsAppAlive(diedEvent));
+    EXPECT_EQ(eventQueue->livePids_.count(SAMPLE_BUNDLE_NAME), 0);
+    EXPECT_FALSE(eventQueue->isDrainPosted_.load());
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_073
+ * @tc.desc: test tasks dispatched by priority lanes of TaskLaneScheduler.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_073, TestSize.Level1)
+{
+    auto scheduler = std::make_shared<TaskLaneScheduler>();
+    auto& handler = StandbyServiceImpl::GetInstance()->handler_;
+    std::vector<int32_t> order;
+    handler->PostSyncTask([&scheduler, &handler, &order]() {
+        scheduler->PostTask(handler, TaskLane::BACKGROUND, [&order]() { order.emplace_back(3); });
+        scheduler->PostTask(handler, TaskLane::STRATEGY, [&order]() { order.emplace_back(2); }, "strategy_task");
+        scheduler->PostTask(handler, TaskLane::STRATEGY, [&order]() { order.emplace_back(2); });
+        scheduler->PostTask(handler, TaskLane::CRITICAL, [&order]() { order.emplace_back(0); });
+        scheduler->RemoveTask(handler, "strategy_task");
+        });
+    SleepForFC();
+    EXPECT_EQ(order, std::vector<int32_t>({0, 2, 3}));
+
+    bool isDone = false;
+    EXPECT_TRUE(scheduler->PostSyncTask(handler, TaskLane::QUERY, [&isDone]() { isDone = true; }));
+    EXPECT_TRUE(isDone);
+    EXPECT_FALSE(scheduler->RunNextTask());
+    EXPECT_FALSE(scheduler->PostTask(nullptr, TaskLane::CRITICAL, []() {}));
+
+    // a sync task failed to post leaves nothing in its lane
+    auto detachedHandler = std::make_shared<AppExecFwk::EventHandler>(nullptr);
+    isDone = false;
+    EXPECT_FALSE(scheduler->PostSyncTask(detachedHandler, TaskLane::QUERY, [&isDone]() { isDone = true; }));
+    EXPECT_FALSE(scheduler->RunNextTask());
+    EXPECT_FALSE(isDone);
+
+    std::string result {""};
+    scheduler->ShellDump(result);
+    EXPECT_NE(result.find("critical: queued 0, posted 1, run 1"), std::string::npos);
+    EXPECT_NE(result.find("strategy: queued 0, posted 2, run 1"), std::string::npos);
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_074
+ * @tc.desc: test IsDeviceInStandby reading the published state and the caller permission cache.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_074, TestSize.Level1)
+{
+    StandbyStateSnapshot snapshot;
+    uint32_t state {0};
+    uint32_t phase {0};
+    EXPECT_FALSE(snapshot.Load(state, phase));
+    snapshot.Publish(StandbyState::SLEEP, SleepStatePhase::END);
+    EXPECT_TRUE(snapshot.Load(state, phase));
+    EXPECT_EQ(state, StandbyState::SLEEP);
+    EXPECT_EQ(phase, SleepStatePhase::END);
+    snapshot.Reset();
+    EXPECT_FALSE(snapshot.Load(state, phase));
+
+    CallerPermissionCache cache;
+    bool isGranted = false;
+    constexpr uint32_t tokenId = 1;
+    EXPECT_FALSE(cache.Get(tokenId, isGranted));
+    cache.Put(tokenId, true);
+    EXPECT_TRUE(cache.Get(tokenId, isGranted));
+    EXPECT_TRUE(isGranted);
+    // a token sharing the slot evicts the cached one
+    cache.Put(tokenId + CallerPermissionCache::SLOT_NUM, false);
+    EXPECT_FALSE(cache.Get(tokenId, isGranted));
+    EXPECT_TRUE(cache.Get(tokenId + CallerPermissionCache::SLOT_NUM, isGranted));
+    EXPECT_FALSE(isGranted);
+    cache.Clear();
+    EXPECT_FALSE(cache.Get(tokenId + CallerPermissionCache::SLOT_NUM, isGranted));
+
+    // an entry put ENTRY_TTL_SEC ago is expired, shift its put time back instead of sleeping
+    cache.Put(tokenId, true);
+    constexpr uint32_t putTimeShift = 2;
+    uint64_t slot = cache.slots_[tokenId].load();
+    uint64_t putTime = (slot >> putTimeShift) & (0xFFFFFFFFu >> putTimeShift);
+    uint64_t expiredTime = (putTime - CallerPermissionCache::ENTRY_TTL_SEC) & (0xFFFFFFFFu >> putTimeShift);
+    slot = (slot & ~(static_cast<uint64_t>(0xFFFFFFFFu >> putTimeShift) << putTimeShift)) |
+        (expiredTime << putTimeShift);
+    cache.slots_[tokenId].store(slot);
+    EXPECT_FALSE(cache.Get(tokenId, isGranted));
+
+    auto standbyServiceImpl = StandbyServiceImpl::GetInstance();
+    bool isStandby = false;
+    standbyServiceImpl->isServiceReady_.store(true);
+    standbyServiceImpl->PublishStandbyState(StandbyState::SLEEP, SleepStatePhase::SYS_RES_DEEP);
+    EXPECT_EQ(standbyServiceImpl->IsDeviceInStandby(isStandby), ERR_OK);
+    EXPECT_TRUE(isStandby);
+    standbyServiceImpl->PublishStandbyState(StandbyState::WORKING, 0);
+    EXPECT_EQ(standbyServiceImpl->IsDeviceInStandby(isStandby), ERR_OK);
+    EXPECT_FALSE(isStandby);
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_075
+ * @tc.desc: test GetStandbyStatePage and the state written to the page.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_075, TestSize.Level1)
+{
+    auto standbyServiceImpl = StandbyServiceImpl::GetInstance();
+    auto statePage = standbyServiceImpl->statePage_;
+    int32_t fd = -1;
+    standbyServiceImpl->statePage_ = nullptr;
+    EXPECT_NE(standbyServiceImpl->GetStandbyStatePage(fd), ERR_OK);
+    standbyServiceImpl->statePage_ = StandbyStatePage::Create();
+    ASSERT_NE(standbyServiceImpl->statePage_, nullptr);
+    EXPECT_EQ(standbyServiceImpl->GetStandbyStatePage(fd), ERR_OK);
+    auto reader = StandbyStatePage::Map(fd);
+    ASSERT_NE(reader, nullptr);
+
+    standbyServiceImpl->PublishStandbyState(StandbyState::NAP, NapStatePhase::SYS_RES_LIGHT);
+    StandbyStateRecord record;
+    EXPECT_TRUE(reader->Read(record));
+    EXPECT_EQ(record.state_, StandbyState::NAP);
+    EXPECT_EQ(record.phase_, NapStatePhase::SYS_RES_LIGHT);
+    uint32_t generation = record.generation_;
+    standbyServiceImpl->WriteStatePage();
+    EXPECT_TRUE(reader->WaitForChange(generation, 0));
+
+    // a write which never finishes makes the reader give up instead of spinning forever
+    auto& sequence = standbyServiceImpl->statePage_->layout_->sequence_;
+    sequence.fetch_add(1);
+    EXPECT_FALSE(reader->Read(record));
+    sequence.fetch_add(1);
+    EXPECT_TRUE(reader->Read(record));
+    standbyServiceImpl->statePage_ = statePage;
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_076
+ * @tc.desc: test SubscriberNotifier delivery and overflow policies.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_076, TestSize.Level1)
+{
+    auto notifier = std::make_shared<SubscriberNotifier>();
+    sptr<IStandbyServiceSubscriber> subscriber = new (std::nothrow) StandbyServiceSubscriberStub();
+    sptr<IStandbyServiceSubscriber> unknownSubscriber = new (std::nothrow) StandbyServiceSubscriberStub();
+    notifier->AddSubscriber(subscriber);
+    int32_t deliveredCount = 0;
+    auto callback = [&deliveredCount](const sptr<IStandbyServiceSubscriber>&) { ++deliveredCount; };
+    // delivered in the calling thread before the workers are started
+    notifier->Notify({subscriber, unknownSubscriber}, "", callback);
+    EXPECT_EQ(deliveredCount, 1);
+
+    SubscriberNotifier::Channel channel;
+    notifier->queueCapacity_ = 2;
+    notifier->overflowPolicy_ = NotifyOverflowPolicy::DROP_NEWEST;
+    notifier->EnqueueLocked(channel, {"first", callback, {}});
+    notifier->EnqueueLocked(channel, {"second", callback, {}});
+    notifier->EnqueueLocked(channel, {"first", callback, {}});
+    EXPECT_EQ(channel.queue_.size(), 2);
+    EXPECT_EQ(channel.droppedCount_, 1);
+    notifier->overflowPolicy_ = NotifyOverflowPolicy::COALESCE;
+    notifier->EnqueueLocked(channel, {"first", callback, {}});
+    EXPECT_EQ(channel.coalescedCount_, 1);
+    EXPECT_EQ(channel.queue_.back().key_, "first");
+    notifier->overflowPolicy_ = NotifyOverflowPolicy::DROP_OLDEST;
+    notifier->EnqueueLocked(channel, {"third", callback, {}});
+    EXPECT_EQ(channel.droppedCount_, 2);
+    EXPECT_EQ(channel.queue_.front().key_, "first");
+
+    // lossless notifications are queued beyond the capacity and never dropped to make room
+    SubscriberNotifier::Channel losslessChannel;
+    for (uint32_t count = 0; count <= notifier->queueCapacity_; ++count) {
+        notifier->EnqueueLocked(losslessChannel, {"", callback, {}, true});
+    }
+    EXPECT_EQ(losslessChannel.queue_.size(), notifier->queueCapacity_ + 1);
+    notifier->EnqueueLocked(losslessChannel, {"first", callback, {}});
+    EXPECT_EQ(losslessChannel.droppedCount_, 1);
+    notifier->overflowPolicy_ = NotifyOverflowPolicy::COALESCE;
+    notifier->EnqueueLocked(losslessChannel, {"", callback, {}});
+    EXPECT_EQ(losslessChannel.droppedCount_, 2);
+    EXPECT_EQ(losslessChannel.queue_.size(), notifier->queueCapacity_ + 1);
+    EXPECT_TRUE(std::all_of(losslessChannel.queue_.begin(), losslessChannel.queue_.end(),
+        [](const SubscriberNotifier::Notification& queued) { return queued.isLossless_; }));
+
+    notifier->Start(1, SubscriberNotifier::DEFAULT_QUEUE_CAPACITY, NotifyOverflowPolicy::COALESCE);
+    notifier->Notify({subscriber}, "", callback);
+    std::string result {""};
+    notifier->ShellDump(result);
+    EXPECT_FALSE(result.empty());
+    notifier->RemoveSubscriber(subscriber->AsObject());
+    notifier->Stop();
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_077
+ * @tc.desc: test SceneInfoDecoder extracts schema fields and rejects invalid sceneInfo.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_077, TestSize.Level1)
+{
+    SceneInfoFields fields;
+    std::string sceneInfo = R"({"ACTION":"a\"b","UID":" 42x","extra":[1,{"k":null},true,-1.5e3],)"
+        R"("SIDE":"\u00e9","APPID":"1","APPID":"-7"})";
+    EXPECT_EQ(SceneInfoDecoder::Decode(sceneInfo, SceneInfoSchemas::GATT_APP_REGISTER, fields),
+        SceneDecodeResult::OK);
+    EXPECT_EQ(fields[SceneInfoSchemas::REGISTER_ACTION].ToString(), "a\"b");
+    EXPECT_EQ(fields[SceneInfoSchemas::REGISTER_UID].num_, 42);
+    EXPECT_EQ(fields[SceneInfoSchemas::REGISTER_SIDE].ToString(), "\xc3\xa9");
+    EXPECT_EQ(fields[SceneInfoSchemas::REGISTER_APPID].num_, -7);
+
+    EXPECT_EQ(SceneInfoDecoder::Decode(R"({"state":3})", SceneInfoSchemas::CALL_STATE_CHANGED, fields),
+        SceneDecodeResult::OK);
+    EXPECT_EQ(fields[SceneInfoSchemas::CALL_STATE].num_, 3);
+    EXPECT_EQ(SceneInfoDecoder::Decode(R"({"state":"4"})", SceneInfoSchemas::CALL_STATE_CHANGED, fields),
+        SceneDecodeResult::OK);
+    EXPECT_EQ(fields[SceneInfoSchemas::CALL_STATE].num_, 4);
+
+    const SceneInfoSchema& schema = SceneInfoSchemas::EFFICIENCY_RESOURCES_STATE_CHANGED;
+    EXPECT_EQ(SceneInfoDecoder::Decode(R"({"bundleName":"b","resourceNumber":5})", schema, fields),
+        SceneDecodeResult::OK);
+    EXPECT_EQ(SceneInfoDecoder::Decode(R"({"bundleName":"b","resourceNumber":-5})", schema, fields),
+        SceneDecodeResult::FIELD_INVALID);
+    EXPECT_EQ(SceneInfoDecoder::Decode(R"({"bundleName":"b","resourceNumber":"5"})", schema, fields),
+        SceneDecodeResult::FIELD_INVALID);
+    EXPECT_EQ(SceneInfoDecoder::Decode(R"({"bundleName":"b"})", schema, fields), SceneDecodeResult::FIELD_MISSING);
+    EXPECT_EQ(SceneInfoDecoder::Decode(R"({"bundleName":"b",})", schema, fields), SceneDecodeResult::MALFORMED);
+    EXPECT_EQ(SceneInfoDecoder::Decode(R"({"bundleName":"b"} x)", schema, fields), SceneDecodeResult::MALFORMED);
+    EXPECT_EQ(SceneInfoDecoder::Decode("", schema, fields), SceneDecodeResult::MALFORMED);
+
+    auto standbyServiceImpl = StandbyServiceImpl::GetInstance();
+    standbyServiceImpl->HandleCallStateChanged("invalid");
+    standbyServiceImpl->HandleBrokerGattConnect(1, R"({"clientIf":"3"})");
+    standbyServiceImpl->HandleAudioRendererChanged(1, R"({"uid":"20010001"})");
+    EXPECT_NE(standbyServiceImpl, nullptr);
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_078
+ * @tc.desc: test EventIngressFilter passes, deduplicates and coalesces events by policy.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_078, TestSize.Level1)
+{
+    EventIngressFilter filter;
+    filter.Reset(100, 1000);
+    int64_t flushDelay = 0;
+    EXPECT_EQ(filter.Filter(ResourceSchedule::ResType::RES_TYPE_SCREEN_STATUS, 1, "", 0, flushDelay),
+        IngressDecision::PASS);
+    EXPECT_EQ(filter.Filter(ResourceSchedule::ResType::RES_TYPE_SCREEN_STATUS, 1, "", 0, flushDelay),
+        IngressDecision::PASS);
+
+    uint32_t callState = ResourceSchedule::ResType::RES_TYPE_CALL_STATE_CHANGED;
+    EXPECT_EQ(filter.Filter(callState, 0, R"({"state":"4"})", 0, flushDelay), IngressDecision::PASS);
+    EXPECT_EQ(filter.Filter(callState, 0, R"({"state":"4"})", 10, flushDelay), IngressDecision::SUPPRESS);
+    EXPECT_EQ(filter.Filter(callState, 0, R"({"state":"6"})", 20, flushDelay), IngressDecision::PASS);
+    EXPECT_EQ(filter.Filter(callState, 0, R"({"state":"6"})", 1020, flushDelay), IngressDecision::PASS);
+
+    uint32_t audioState = ResourceSchedule::ResType::RES_TYPE_INNER_AUDIO_STATE;
+    EXPECT_EQ(filter.Filter(audioState, 2, R"({"uid":"1"})", 1000, flushDelay), IngressDecision::PASS);
+    EXPECT_EQ(filter.Filter(audioState, 3, R"({"uid":"1"})", 1010, flushDelay), IngressDecision::DEFER);
+    EXPECT_EQ(flushDelay, 90);
+    // folded back to the delivered value
+    EXPECT_EQ(filter.Filter(audioState, 2, R"({"uid":"1"})", 1020, flushDelay), IngressDecision::DEFER);
+    EXPECT_EQ(flushDelay, 0);
+    EXPECT_EQ(filter.Filter(audioState, 2, R"({"uid":"2"})", 1020, flushDelay), IngressDecision::PASS);
+    EXPECT_EQ(filter.Filter(audioState, 5, R"({"uid":"2"})", 1030, flushDelay), IngressDecision::DEFER);
+    EXPECT_TRUE(filter.TakeDueEvents(1100, flushDelay).empty());
+    EXPECT_EQ(flushDelay, 20);
+    auto dueEvents = filter.TakeDueEvents(1120, flushDelay);
+    ASSERT_EQ(dueEvents.size(), 1);
+    EXPECT_EQ(dueEvents.front().value_, 5);
+    EXPECT_EQ(flushDelay, 0);
+
+    std::string result {""};
+    filter.ShellDump(result);
+    EXPECT_NE(result.find("suppressed 2"), std::string::npos);
+    StandbyServiceImpl::GetInstance()->HandleCommonEvent(audioState, 2, R"({"uid":"3"})");
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_079
+ * @tc.desc: test streaming backup and restore together with callbacks of the vector API.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_079, TestSize.Level1)
+{
+    auto standbyServiceImpl = StandbyServiceImpl::GetInstance();
+    std::string streamData(4096, 's');
+    std::string restoredStreamData {""};
+    std::string restoredData {""};
+    auto onStreamBackupFunc = [&streamData](CloneSectionWriter& writer) -> ErrCode {
+        size_t half = streamData.size() / 2;
+        return writer.Write(streamData.data(), half) && writer.Write(streamData.data() + half,
+            streamData.size() - half) ? ERR_OK : ERR_INVALID_OPERATION;
+    };
+    auto onStreamRestoreFunc = [&restoredStreamData](std::string_view section) -> ErrCode {
+        restoredStreamData = std::string(section);
+        return ERR_OK;
+    };
+    auto onBackupFunc = [](std::vector<char>& buff) -> ErrCode {
+        std::string data = "vector";
+        buff.insert(buff.end(), data.begin(), data.end());
+        return ERR_OK;
+    };
+    auto onRestoreFunc = [&restoredData](std::vector<char>& buff) -> ErrCode {
+        restoredData = std::string(buff.begin(), buff.end());
+        return ERR_OK;
+    };
+    EXPECT_EQ(standbyServiceImpl->SubscribeStreamBackupRestoreCallback("stream", onStreamBackupFunc,
+        onStreamRestoreFunc), ERR_OK);
+    EXPECT_EQ(standbyServiceImpl->SubscribeStreamBackupRestoreCallback("stream", onStreamBackupFunc,
+        onStreamRestoreFunc), ERR_INVALID_OPERATION);
+    EXPECT_EQ(standbyServiceImpl->SubscribeBackupRestoreCallback("stream", onBackupFunc, onRestoreFunc),
+        ERR_INVALID_OPERATION);
+    EXPECT_EQ(standbyServiceImpl->SubscribeStreamBackupRestoreCallback(std::string(CLONE_MODULE_NAME_LEN, 'n'),
+        onStreamBackupFunc, onStreamRestoreFunc), ERR_INVALID_VALUE);
+    EXPECT_EQ(standbyServiceImpl->SubscribeBackupRestoreCallback("vector", onBackupFunc, onRestoreFunc), ERR_OK);
+
+    MessageParcel data;
+    MessageParcel reply;
+    EXPECT_EQ(standbyServiceImpl->OnBackup(data, reply), ERR_OK);
+    int32_t fd = reply.ReadFileDescriptor();
+    EXPECT_GE(fd, 0);
+    data.WriteFileDescriptor(fd);
+    EXPECT_EQ(standbyServiceImpl->OnRestore(data, reply), ERR_OK);
+    EXPECT_EQ(restoredStreamData, streamData);
+    EXPECT_EQ(restoredData, "vector");
+    close(fd);
+
+    EXPECT_EQ(standbyServiceImpl->UnsubscribeBackupRestoreCallback("stream"), ERR_OK);
+    EXPECT_EQ(standbyServiceImpl->UnsubscribeBackupRestoreCallback("vector"), ERR_OK);
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_080
+ * @tc.desc: test subscribers of an empty module are distinguished from all subscribers.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_080, TestSize.Level1)
+{
+    auto stateSubscriber = StandbyStateSubscriber::GetInstance();
+    auto subscriberList = stateSubscriber->subscriberList_;
+    sptr<IStandbyServiceSubscriber> moduleSubscriber = new (std::nothrow) StandbyServiceSubscriberStub();
+    sptr<IStandbyServiceSubscriber> unnamedSubscriber = new (std::nothrow) StandbyServiceSubscriberStub();
+    moduleSubscriber->SetModuleName("test_module");
+    stateSubscriber->subscriberList_ = {moduleSubscriber, unnamedSubscriber};
+    EXPECT_EQ(stateSubscriber->GetSubscribers().size(), 2);
+    auto subscribers = stateSubscriber->GetSubscribers("");
+    ASSERT_EQ(subscribers.size(), 1);
+    EXPECT_EQ(subscribers.front(), unnamedSubscriber);
+    subscribers = stateSubscriber->GetSubscribers("test_module");
+    ASSERT_EQ(subscribers.size(), 1);
+    EXPECT_EQ(subscribers.front(), moduleSubscriber);
+    stateSubscriber->subscriberList_ = subscriberList;
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_081
+ * @tc.desc: test restoring a clone file of the CloneFileHead chain format and backing up in the same format.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_081, TestSize.Level1)
+{
+    auto standbyServiceImpl = StandbyServiceImpl::GetInstance();
+    std::string restoredData {""};
+    auto onBackupFunc = [](std::vector<char>& buff) -> ErrCode {
+        std::string data = "backup";
+        buff.insert(buff.end(), data.begin(), data.end());
+        return ERR_OK;
+    };
+    auto onRestoreFunc = [&restoredData](std::vector<char>& buff) -> ErrCode {
+        restoredData = std::string(buff.begin(), buff.end());
+        return ERR_OK;
+    };
+    EXPECT_EQ(standbyServiceImpl->SubscribeBackupRestoreCallback("legacy", onBackupFunc, onRestoreFunc), ERR_OK);
+
+    // built the way clone files of older versions are, each head is directly followed by its data
+    std::vector<char> cloneFile;
+    auto appendModule = [&cloneFile](const std::string& moduleName, const std::string& moduleData) {
+        CloneFileHead head {};
+        std::copy(moduleName.begin(), moduleName.end(), head.moduleName);
+        head.fileOffset = static_cast<uint32_t>(cloneFile.size());
+        head.fileSize = static_cast<uint32_t>(moduleData.size());
+        const char* headData = reinterpret_cast<const char*>(&head);
+        cloneFile.insert(cloneFile.end(), headData, headData + sizeof(CloneFileHead));
+        cloneFile.insert(cloneFile.end(), moduleData.begin(), moduleData.end());
+    };
+    appendModule("unknown", "skipped");
+    appendModule("legacy", "restored");
+    int32_t pipeFds[2] = {-1, -1};
+    ASSERT_EQ(pipe(pipeFds), 0);
+    EXPECT_EQ(write(pipeFds[1], cloneFile.data(), cloneFile.size()), static_cast<ssize_t>(cloneFile.size()));
+    close(pipeFds[1]);
+    MessageParcel data;
+    MessageParcel reply;
+    data.WriteFileDescriptor(pipeFds[0]);
+    EXPECT_EQ(standbyServiceImpl->OnRestore(data, reply), ERR_OK);
+    EXPECT_EQ(restoredData, "restored");
+    close(pipeFds[0]);
+
+    MessageParcel backupData;
+    MessageParcel backupReply;
+    EXPECT_EQ(standbyServiceImpl->OnBackup(backupData, backupReply), ERR_OK);
+    int32_t fd = backupReply.ReadFileDescriptor();
+    ASSERT_GE(fd, 0);
+    off_t len = lseek(fd, 0, SEEK_END);
+    ASSERT_GT(len, 0);
+    std::vector<char> backupFile(static_cast<size_t>(len));
+    EXPECT_EQ(pread(fd, backupFile.data(), backupFile.size(), 0), static_cast<ssize_t>(len));
+    close(fd);
+    std::string backupModuleData {""};
+    size_t offset = 0;
+    while (offset + sizeof(CloneFileHead) <= static_cast<size_t>(len)) {
+        CloneFileHead head {};
+        std::copy(backupFile.data() + offset, backupFile.data() + offset + sizeof(CloneFileHead),
+            reinterpret_cast<char*>(&head));
+        EXPECT_EQ(head.fileOffset, offset);
+        ASSERT_LE(offset + sizeof(CloneFileHead) + head.fileSize, static_cast<size_t>(len));
+        if (std::string(head.moduleName) == "legacy") {
+            backupModuleData = std::string(backupFile.data() + offset + sizeof(CloneFileHead), head.fileSize);
+        }
+        offset += sizeof(CloneFileHead) + head.fileSize;
+    }
+    EXPECT_EQ(offset, static_cast<size_t>(len));
+    EXPECT_EQ(backupModuleData, "backup");
+    EXPECT_EQ(standbyServiceImpl->UnsubscribeBackupRestoreCallback("legacy"), ERR_OK);
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_082
+ * @tc.desc: test seeding live processes of AppStateEventQueue is retried with backoff.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_082, TestSize.Level1)
+{
+    IBundleManagerHelper::MockGetAllRunningProcesses(false);
+    auto eventQueue = std::make_shared<AppStateEventQueue>(nullptr);
+    eventQueue->Enqueue({AppStateEvent::PROCESS_CREATED, SAMPLE_APP_UID, 1, SAMPLE_BUNDLE_NAME});
+    EXPECT_FALSE(eventQueue->isSeedTaken_.load());
+    int64_t nextSeedTimeMs = eventQueue->nextSeedTimeMs_.load();
+    EXPECT_GT(nextSeedTimeMs, 0);
+    // seeding is not retried before the backoff passes
+    eventQueue->Enqueue({AppStateEvent::PROCESS_CREATED, SAMPLE_APP_UID, 2, SAMPLE_BUNDLE_NAME});
+    EXPECT_EQ(eventQueue->nextSeedTimeMs_.load(), nextSeedTimeMs);
+    // the app of the died process is checked by the enqueuing thread, which the mock reports running
+    eventQueue->Enqueue({AppStateEvent::PROCESS_DIED, SAMPLE_APP_UID, 1, SAMPLE_BUNDLE_NAME});
+    EXPECT_FALSE(eventQueue->isLivePidsSeeded_);
+    EXPECT_EQ(eventQueue->diedPids_.count(1), 1);
+    EXPECT_EQ(eventQueue->livePids_[SAMPLE_BUNDLE_NAME].size(), 1);
+
+    IBundleManagerHelper::MockGetAllRunningProcesses(true);
+    eventQueue->nextSeedTimeMs_.store(0);
+    eventQueue->Enqueue({AppStateEvent::PROCESS_DIED, SAMPLE_APP_UID, 2, SAMPLE_BUNDLE_NAME});
+    EXPECT_TRUE(eventQueue->isSeedTaken_.load());
+    EXPECT_TRUE(eventQueue->isLivePidsSeeded_);
+    EXPECT_TRUE(eventQueue->diedPids_.empty());
+    EXPECT_EQ(eventQueue->livePids_.count(SAMPLE_BUNDLE_NAME), 0);
+
+    // pids died before the seed is applied are not revived by it
+    auto seedQueue = std::make_shared<AppStateEventQueue>(nullptr);
+    seedQueue->diedPids_.emplace(1);
+    seedQueue->seed_[SAMPLE_BUNDLE_NAME] = {1, 3};
+    seedQueue->ApplySeed();
+    EXPECT_EQ(seedQueue->livePids_[SAMPLE_BUNDLE_NAME].count(1), 0);
+    EXPECT_EQ(seedQueue->livePids_[SAMPLE_BUNDLE_NAME].count(3), 1);
+}
+
+/**
+ * @tc.name: StandbyServiceUnitTest_083
+ * @tc.desc: test UninitReadyState withdraws the record of the state page.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyServiceUnitTest, StandbyServiceUnitTest_083, TestSize.Level1)
+{
+    auto standbyServiceImpl = StandbyServiceImpl::GetInstance();
+    auto statePage = standbyServiceImpl->statePage_;
+    standbyServiceImpl->statePage_ = StandbyStatePage::Create();
+    ASSERT_NE(standbyServiceImpl->statePage_, nullptr);
+    auto reader = StandbyStatePage::Map(standbyServiceImpl->statePage_->GetFd());
+    ASSERT_NE(reader, nullptr);
+    standbyServiceImpl->isServiceReady_.store(true);
+    standbyServiceImpl->PublishStandbyState(StandbyState::SLEEP, SleepStatePhase::SYS_RES_DEEP);
+    StandbyStateRecord record;
+    EXPECT_TRUE(reader->Read(record));
+
+    standbyServiceImpl->UninitReadyState();
+    StandbyServiceUnitTest::SleepForFC();
+    EXPECT_FALSE(standbyServiceImpl->isServiceReady_.load());
+    EXPECT_TRUE(reader->WaitForChange(record.generation_, 0));
+    EXPECT_FALSE(reader->Read(record));
+    // the state is not published again by a later day and night switch
+    standbyServiceImpl->WriteStatePage();
+    EXPECT_FALSE(reader->Read(record));
+
+    standbyServiceImpl->statePage_ = statePage;
+    standbyServiceImpl->InitReadyState();
+    StandbyServiceUnitTest::SleepForFC();
+}
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
@@ -17,6 +17,7 @@
 #include "gtest/hwext/gtest-multithread.h"
 
 #include "standby_config_manager.h"
+#include "standby_config_cache.h"
 #include "nlohmann/json.hpp"
 
 #include "standby_service_log.h"
@@ -34,6 +35,7 @@ namespace {
     const std::string JSON_ERROR_KEY = "error_key";
     const std::string TAG_APPS_LIMIT = "apps_limit";
     const std::string TAG_BATTERY_THRESHOLD = "battery_threshold";
+    const std::string TEST_CONFIG_CACHE_PATH = "/data/service/el1/public/device_standby/standby_config_cache_test";
 }
 class StandbyUtilsUnitTest : public testing::Test {
 public:
@@ -541,9 +543,11 @@ HWTEST_F(StandbyUtilsUnitTest, StandbyUtilsUnitTest_028, TestSize.Level1)
     StandbyConfigManager::GetInstance()->ladderBatteryListMap_ = {
         {"battery_threshold", {90, 40}}
     };
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
     auto result = StandbyConfigManager::GetInstance()->GetStandbyLadderBatteryList(TAG_BATTERY_THRESHOLD);
     EXPECT_EQ(result.size(), 2);
     StandbyConfigManager::GetInstance()->ladderBatteryListMap_.clear();
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
     result = StandbyConfigManager::GetInstance()->GetStandbyLadderBatteryList(TAG_BATTERY_THRESHOLD);
     EXPECT_EQ(result.size(), 0);
 }
@@ -659,5 +663,169 @@ HWTEST_F(StandbyUtilsUnitTest, StandbyUtilsUnitTest_036, TestSize.Level1)
     const auto& mxAfter = StandbyConfigManager::GetInstance()->GetMxStandbyConfig();
     EXPECT_EQ(mxAfter.size(), sizeBefore);
 }
+
+/**
+ * @tc.name: StandbyUtilsUnitTest_037
+ * @tc.desc: test resource control config snapshot.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyUtilsUnitTest, StandbyUtilsUnitTest_037, TestSize.Level1)
+{
+    std::string content = R"({"snapshot_test":[{"condition":["day_standby"], "action":"allow",
+        "processes":["proc_b", "proc_a"], "apps":["app_a"],
+        "processes_limit":[{"name":"proc_c", "duration":10}, {"name":"proc_c", "duration":20}]},
+        {"condition":["day_standby&night_standby"], "action":"allow", "processes":["proc_a", "proc_d"]}]})";
+    nlohmann::json resCtrlConfig = nlohmann::json::parse(content, nullptr, false);
+    EXPECT_TRUE(StandbyConfigManager::GetInstance()->ParseResCtrlConfig(resCtrlConfig));
+
+    auto persistAllowList = StandbyConfigManager::GetInstance()->GetEligiblePersistAllowList("snapshot_test",
+        ConditionType::DAY_STANDBY, true, false);
+    ASSERT_NE(persistAllowList, nullptr);
+    EXPECT_EQ(*persistAllowList, std::vector<std::string>({"proc_a", "proc_b"}));
+    persistAllowList = StandbyConfigManager::GetInstance()->GetEligiblePersistAllowList("snapshot_test",
+        ConditionType::DAY_STANDBY | ConditionType::NIGHT_STANDBY, true, false);
+    ASSERT_NE(persistAllowList, nullptr);
+    EXPECT_EQ(persistAllowList->size(), 3);
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetEligiblePersistAllowConfig("snapshot_test",
+        ConditionType::DAY_STANDBY, true, true).size(), 1);
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetEligiblePersistAllowList("snapshot_none",
+        ConditionType::DAY_STANDBY, true, false), nullptr);
+
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetMaxDuration("proc_c", "snapshot_test",
+        ConditionType::DAY_STANDBY, false), 10);
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetMaxDuration("proc_c", "snapshot_test",
+        ConditionType::NIGHT_STANDBY, false), 0);
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetEligibleAllowTimeConfig("snapshot_test",
+        ConditionType::DAY_STANDBY, true, false).size(), 1);
+}
+
+/**
+ * @tc.name: StandbyUtilsUnitTest_038
+ * @tc.desc: test config handles are updated by published snapshots.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyUtilsUnitTest, StandbyUtilsUnitTest_038, TestSize.Level1)
+{
+    const std::string paramName = "handle_test_param";
+    const std::string switchName = "handle_test_switch";
+    uint32_t paramHandle = StandbyConfigManager::GetInstance()->GetParamHandle(paramName);
+    uint32_t switchHandle = StandbyConfigManager::GetInstance()->GetSwitchHandle(switchName);
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetParamHandle(paramName), paramHandle);
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetStandbyParamByHandle(paramHandle), 0);
+    EXPECT_FALSE(StandbyConfigManager::GetInstance()->GetStandbySwitchByHandle(switchHandle));
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetStandbyParamByHandle(UINT32_MAX), 0);
+
+    StandbyConfigManager::GetInstance()->standbyParaMap_[paramName] = 1;
+    StandbyConfigManager::GetInstance()->standbySwitchMap_[switchName] = false;
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetStandbyParamByHandle(paramHandle), 1);
+    std::string result {""};
+    StandbyConfigManager::GetInstance()->DumpSetParameter(paramName, 2, result);
+    StandbyConfigManager::GetInstance()->DumpSetSwitch(switchName, true, result);
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetStandbyParamByHandle(paramHandle), 2);
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetStandbyParam(paramName), 2);
+    EXPECT_TRUE(StandbyConfigManager::GetInstance()->GetStandbySwitchByHandle(switchHandle));
+
+    StandbyConfigManager::GetInstance()->standbyParaMap_.erase(paramName);
+    StandbyConfigManager::GetInstance()->standbySwitchMap_.erase(switchName);
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
+
+    // lists are shared with the snapshot rather than copied for every call
+    EXPECT_TRUE(StandbyConfigManager::GetInstance()->GetStandbyListPara(paramName)->empty());
+    StandbyConfigManager::GetInstance()->standbyListParaMap_[paramName] = {"test"};
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
+    auto standbyList = StandbyConfigManager::GetInstance()->GetStandbyListPara(paramName);
+    EXPECT_EQ(standbyList->size(), 1);
+    EXPECT_EQ(StandbyConfigManager::GetInstance()->GetStandbyListPara(paramName), standbyList);
+    StandbyConfigManager::GetInstance()->standbyListParaMap_.erase(paramName);
+    StandbyConfigManager::GetInstance()->PublishConfigSnapshot();
+    EXPECT_EQ(standbyList->size(), 1);
+}
+
+/**
+ * @tc.name: StandbyUtilsUnitTest_039
+ * @tc.desc: test StandbyConfigCache rejects stale or corrupted cache.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyUtilsUnitTest, StandbyUtilsUnitTest_039, TestSize.Level1)
+{
+    ConfigCacheWriter writer;
+    writer.WriteString("standby_config");
+    writer.WriteInt32(-1);
+    writer.WriteBool(true);
+    StandbyConfigCache configCache(TEST_CONFIG_CACHE_PATH);
+    configCache.AddContentSource("standby_config");
+    configCache.AddVersionSource("1.0.0");
+    EXPECT_TRUE(configCache.Store(writer.GetPayload()));
+    std::string content;
+    int32_t value = 0;
+    bool flag = false;
+    auto decodeFunc = [&](ConfigCacheReader& reader) {
+        return reader.ReadString(content) && reader.ReadInt32(value) && reader.ReadBool(flag);
+    };
+    EXPECT_TRUE(configCache.Load(decodeFunc));
+    EXPECT_EQ(content, "standby_config");
+    EXPECT_EQ(value, -1);
+    EXPECT_TRUE(flag);
+    EXPECT_FALSE(configCache.Load([](ConfigCacheReader& reader) {
+        std::string content;
+        return reader.ReadString(content);
+    }));
+
+    StandbyConfigCache changedCache(TEST_CONFIG_CACHE_PATH);
+    changedCache.AddContentSource("changed_config");
+    changedCache.AddVersionSource("1.0.0");
+    EXPECT_NE(changedCache.GetFingerprint(), configCache.GetFingerprint());
+    EXPECT_FALSE(changedCache.Load(decodeFunc));
+    StandbyConfigCache updatedCache(TEST_CONFIG_CACHE_PATH);
+    updatedCache.AddContentSource("standby_config");
+    updatedCache.AddVersionSource("1.0.1");
+    EXPECT_FALSE(updatedCache.Load(decodeFunc));
+
+    FILE* cacheFile = fopen(TEST_CONFIG_CACHE_PATH.c_str(), "r+b");
+    ASSERT_NE(cacheFile, nullptr);
+    fseek(cacheFile, -1, SEEK_END);
+    fputc(0xff, cacheFile);
+    fclose(cacheFile);
+    EXPECT_FALSE(configCache.Load(decodeFunc));
+    remove(TEST_CONFIG_CACHE_PATH.c_str());
+}
+
+/**
+ * @tc.name: StandbyUtilsUnitTest_040
+ * @tc.desc: test the parsed config is restored from the config cache.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StandbyUtilsUnitTest, StandbyUtilsUnitTest_040, TestSize.Level1)
+{
+    auto configManager = StandbyConfigManager::GetInstance();
+    configManager->standbyParaMap_["test_para"] = 1;
+    configManager->standbyListParaMap_["test_list"] = {"test_app"};
+    configManager->timerResConfigList_.emplace_back(TimerResourceConfig {true, {1}, {{"test_app", 1, true}}});
+    ConfigCacheWriter writer;
+    configManager->EncodeParsedConfig(writer);
+    auto standbyParaMap = configManager->standbyParaMap_;
+    auto timerResConfigSize = configManager->timerResConfigList_.size();
+    configManager->ClearParsedConfig();
+    EXPECT_TRUE(configManager->standbyParaMap_.empty());
+
+    const auto& payload = writer.GetPayload();
+    ConfigCacheReader reader(payload.data(), payload.size());
+    EXPECT_TRUE(configManager->DecodeParsedConfig(reader));
+    EXPECT_EQ(reader.GetRemainingSize(), 0);
+    EXPECT_EQ(configManager->standbyParaMap_, standbyParaMap);
+    EXPECT_EQ(configManager->standbyListParaMap_["test_list"], std::vector<std::string> {"test_app"});
+    ASSERT_EQ(configManager->timerResConfigList_.size(), timerResConfigSize);
+    EXPECT_EQ(configManager->timerResConfigList_.back().timerClockApps_.back().name_, "test_app");
+
+    ConfigCacheReader truncatedReader(payload.data(), payload.size() - 1);
+    EXPECT_FALSE(configManager->DecodeParsedConfig(truncatedReader));
+    configManager->ClearParsedConfig();
+    configManager->Init();
+}
 }  // namespace DevStandbyMgr
 }  // namespace OHOS
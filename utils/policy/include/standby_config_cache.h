@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_UTILS_POLICY_INCLUDE_STANDBY_CONFIG_CACHE_H
+#define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_UTILS_POLICY_INCLUDE_STANDBY_CONFIG_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace DevStandbyMgr {
+/**
+ * @brief appends fields of the parsed config to a cache payload, values are stored in host byte order.
+ */
+class ConfigCacheWriter {
+public:
+    void WriteUint32(uint32_t value);
+    void WriteInt32(int32_t value);
+    void WriteBool(bool value);
+    void WriteString(const std::string& value);
+    void WriteBytes(const std::vector<uint8_t>& value);
+    const std::vector<uint8_t>& GetPayload() const;
+
+private:
+    void Append(const void* data, size_t size);
+
+private:
+    std::vector<uint8_t> payload_ {};
+};
+
+/**
+ * @brief reads fields in the order they are written, a read fails once it runs past the end of the payload.
+ */
+class ConfigCacheReader {
+public:
+    ConfigCacheReader(const uint8_t* data, size_t size);
+    bool ReadUint32(uint32_t& value);
+    bool ReadInt32(int32_t& value);
+    bool ReadBool(bool& value);
+    bool ReadString(std::string& value);
+    /**
+     * @brief read a byte field without copying, data points into the payload and is valid while it is mapped.
+     */
+    bool ReadBytes(const uint8_t*& data, size_t& size);
+    size_t GetRemainingSize() const;
+
+private:
+    bool Read(void* data, size_t size);
+
+private:
+    const uint8_t* data_ {nullptr};
+    size_t size_ {0};
+    size_t pos_ {0};
+};
+
+/**
+ * @brief binary cache of the parsed standby config behind a versioned and checksummed header.
+ *
+ * The cache is keyed by a fingerprint of the system software version and the content of all config sources, so it
+ * is invalidated by an update of either the configs or the code parsing them.
+ */
+class StandbyConfigCache {
+public:
+    explicit StandbyConfigCache(const std::string& cachePath);
+
+    void AddVersionSource(const std::string& version);
+    void AddFileSource(const std::string& filePath);
+    void AddContentSource(const std::string& content);
+    uint64_t GetFingerprint() const;
+
+    /**
+     * @brief map the cache file and decode its payload, fails if the fingerprint or checksum mismatches.
+     *
+     * @param decodeFunc decode the parsed config from the payload, returns false if the payload is malformed
+     * @return true if the cache is valid and decoded
+     */
+    bool Load(const std::function<bool(ConfigCacheReader&)>& decodeFunc);
+
+    /**
+     * @brief rewrite the cache file with payload and the current fingerprint.
+     *
+     * @return true if succeed
+     */
+    bool Store(const std::vector<uint8_t>& payload);
+
+    static uint64_t Hash(const void* data, size_t size, uint64_t seed);
+
+private:
+    void AddToFingerprint(const void* data, size_t size);
+
+private:
+    std::string cachePath_ {""};
+    uint64_t fingerprint_ {0};
+};
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_UTILS_POLICY_INCLUDE_STANDBY_CONFIG_CACHE_H
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_UTILS_POLICY_INCLUDE_STANDBY_CONFIG_MANAGER_H
 #define FOUNDATION_RESOURCESCHEDULE_STANDBY_SERVICE_UTILS_POLICY_INCLUDE_STANDBY_CONFIG_MANAGER_H
 
+#include <array>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -34,6 +35,10 @@ namespace {
     using GetExtConfigFunc = int32_t (*)(int32_t, std::vector<std::string>&);
     using GetSingleExtConfigFunc = int32_t (*)(int32_t, std::string&);
 }
+class ConfigCacheReader;
+class ConfigCacheWriter;
+class StandbyConfigCache;
+
 class ConditionType {
 public:
     enum Type : uint32_t {
@@ -61,6 +66,29 @@ struct DefaultResourceConfig {
     std::vector<TimeLtdProcess> timeLtdApps_;
 };
 
+struct EligibleResCtrlConfig {
+    std::unordered_map<std::string, int32_t> maxDurations_;
+    std::vector<std::string> persistAllowList_;
+};
+
+/**
+ * @brief resource control config precompiled for every combination of condition, action and caller type.
+ *
+ * A snapshot is immutable once published, it is rebuilt whenever resource control config is parsed.
+ */
+struct ResCtrlConfigSnapshot {
+    static constexpr uint32_t CONDITION_MASK = ConditionType::DAY_STANDBY | ConditionType::NIGHT_STANDBY;
+    static constexpr uint32_t SLOT_NUM = (CONDITION_MASK + 1) * 4;
+
+    static uint32_t GetSlot(uint32_t condition, bool isAllow, bool isApp)
+    {
+        return ((condition & CONDITION_MASK) << 2) | (static_cast<uint32_t>(isAllow) << 1) |
+            static_cast<uint32_t>(isApp);
+    }
+
+    std::unordered_map<std::string, std::array<EligibleResCtrlConfig, SLOT_NUM>> configMap_;
+};
+
 struct TimerClockApp {
     std::string name_;
     int32_t timerPeriod_;
@@ -73,6 +101,27 @@ struct TimerResourceConfig {
     std::vector<TimerClockApp> timerClockApps_;
 };
 
+/**
+ * @brief parsed standby config published to readers, immutable once published.
+ */
+struct StandbyConfigSnapshot {
+    std::unordered_map<std::string, bool> standbySwitchMap_;
+    std::unordered_map<std::string, int32_t> standbyParaMap_;
+    std::unordered_map<std::string, bool> strategySwitchMap_;
+    std::unordered_map<std::string, bool> strategyListMap_;
+    std::unordered_map<std::string, bool> halfhourSwitchMap_;
+    std::unordered_map<std::string, std::shared_ptr<const std::vector<DefaultResourceConfig>>>
+        defaultResourceConfigMap_;
+    std::unordered_map<std::string, std::vector<int32_t>> intervalListMap_;
+    std::unordered_map<std::string, std::vector<int32_t>> ladderBatteryListMap_;
+    std::unordered_map<std::string, std::vector<std::string>> pkgTypeMap_;
+    std::unordered_map<std::string, nlohmann::json> standbyStrategyConfigMap_;
+    std::unordered_map<std::string, std::shared_ptr<const std::vector<std::string>>> standbyListParaMap_;
+    // values of the names resolved by GetParamHandle and GetSwitchHandle, indexed by handle
+    std::vector<int32_t> paramValues_;
+    std::vector<bool> switchValues_;
+};
+
 class StandbyConfigManager {
     DECLARE_DELAYED_SINGLETON(StandbyConfigManager);
 public:
@@ -82,10 +131,24 @@ public:
     nlohmann::json GetDefaultConfig(const std::string& configName);
     bool GetStandbySwitch(const std::string& switchName);
     int32_t GetStandbyParam(const std::string& paramName);
+    /**
+     * @brief resolve a standby param or switch name to a handle once, the handle is valid for the process lifetime.
+     */
+    uint32_t GetParamHandle(const std::string& paramName);
+    uint32_t GetSwitchHandle(const std::string& switchName);
+    /**
+     * @brief allocation-free read of a value resolved by GetParamHandle or GetSwitchHandle, configMutex_ is not
+     * taken. The snapshot is loaded by std::atomic_load, which may briefly spin on the reference count.
+     */
+    int32_t GetStandbyParamByHandle(uint32_t paramHandle);
+    bool GetStandbySwitchByHandle(uint32_t switchHandle);
     bool GetStrategySwitch(const std::string& switchName);
     bool GetHalfHourSwitch(const std::string& switchName);
-    std::shared_ptr<std::vector<DefaultResourceConfig>> GetResCtrlConfig(const std::string& switchName);
-    std::vector<std::string> GetStandbyListPara(const std::string& paramName);
+    std::shared_ptr<const std::vector<DefaultResourceConfig>> GetResCtrlConfig(const std::string& switchName);
+    /**
+     * @brief get the list shared with the published config snapshot, an empty list if there is no such config.
+     */
+    std::shared_ptr<const std::vector<std::string>> GetStandbyListPara(const std::string& paramName);
     const std::vector<TimerResourceConfig>& GetTimerResConfig();
     const std::vector<std::string>& GetStrategyConfigList();
     bool GetStrategyConfigList(const std::string& switchName);
@@ -97,6 +160,13 @@ public:
     std::set<std::string> GetEligiblePersistAllowConfig(const std::string& paramName,
         uint32_t condition, bool isAllow, bool isApp);
     int32_t GetMaxDuration(const std::string& name, const std::string& paramName, uint32_t condition, bool isApp);
+    /**
+     * @brief get the prebuilt persistent allow list, which is sorted and shared with the config snapshot.
+     *
+     * @return nullptr if there is no config of paramName
+     */
+    std::shared_ptr<const std::vector<std::string>> GetEligiblePersistAllowList(const std::string& paramName,
+        uint32_t condition, bool isAllow, bool isApp);
 
     std::vector<int32_t> GetStandbyLadderBatteryList(const std::string& switchName);
     std::vector<std::string> GetStandbyPkgTypeList(const std::string& switchName);
@@ -115,11 +185,17 @@ private:
     StandbyConfigManager& operator= (const StandbyConfigManager&) = delete;
     StandbyConfigManager(StandbyConfigManager&&) = delete;
     StandbyConfigManager& operator= (StandbyConfigManager&&) = delete;
-    template<typename T> std::set<T> GetEligibleAllowConfig(const std::string& paramName,
-        uint32_t condition, bool isAllow, bool isApp, const std::function<void(bool, std::set<T>&,
-        const DefaultResourceConfig&)>& func);
-    template<typename T> T
-        GetConfigWithName(const std::string& switchName, std::unordered_map<std::string, T>& configMap);
+    std::shared_ptr<const EligibleResCtrlConfig> FindEligibleResCtrlConfig(const std::string& paramName,
+        uint32_t condition, bool isAllow, bool isApp);
+    void BuildResCtrlSnapshot();
+    template<typename T> T GetConfigWithName(const std::string& switchName,
+        std::unordered_map<std::string, T> StandbyConfigSnapshot::* configMap);
+    uint32_t GetConfigHandle(const std::string& name, std::unordered_map<std::string, uint32_t>& handleMap,
+        std::vector<std::string>& handleNames);
+    /**
+     * @brief publish the parsed config to readers, must be called after config changed with configMutex_ held.
+     */
+    void PublishConfigSnapshot();
 
     std::vector<std::string> GetConfigFileList(const std::string& relativeConfigPath);
     bool ParseDeviceStanbyConfig(const nlohmann::json& devStandbyConfigRoot);
@@ -140,8 +216,27 @@ private:
     template<typename T> void DumpResCtrlConfig(const char* name, const std::vector<T>& configArray,
         std::stringstream& stream, const std::function<void(const T&)>& func);
     void LoadGetExtConfigFunc();
-    void GetAndParseStandbyConfig();
-    void GetAndParseStrategyConfig();
+    /**
+     * @brief get config contents from the extension library, or config file paths if the library has none.
+     *
+     * @return true if sourceList holds config contents
+     */
+    bool GetConfigSourceList(int32_t fileIndex, const std::string& relativeConfigPath,
+        std::vector<std::string>& sourceList);
+    void AddConfigSourceList(StandbyConfigCache& configCache, bool isContent,
+        const std::vector<std::string>& sourceList);
+    nlohmann::json LoadConfigRootList(bool isContent, const std::vector<std::string>& sourceList);
+    /**
+     * @brief parse the loaded config roots in the same order as they are read from sources.
+     */
+    void ApplyLoadedConfig(const nlohmann::json& loadedConfig);
+    /**
+     * @brief write the parsed config to the config cache, the order must match DecodeParsedConfig.
+     */
+    void EncodeParsedConfig(ConfigCacheWriter& writer);
+    bool DecodeParsedConfig(ConfigCacheReader& reader);
+    // reset the parsed config before it is parsed again after a partially decoded cache
+    void ClearParsedConfig();
     void GetCloudConfig();
     void ParseCloudConfig(const nlohmann::json& devConfigRoot);
     bool GetParamVersion(const int32_t& fileIndex, std::string& version);
@@ -172,6 +267,13 @@ private:
     std::vector<std::string> strategyList_;
     std::unordered_map<std::string, bool> halfhourSwitchMap_;
     std::unordered_map<std::string, std::shared_ptr<std::vector<DefaultResourceConfig>>> defaultResourceConfigMap_;
+    // published with std::atomic_store, readers take it with std::atomic_load and never lock configMutex_
+    std::shared_ptr<const ResCtrlConfigSnapshot> resCtrlSnapshot_ {nullptr};
+    std::shared_ptr<const StandbyConfigSnapshot> configSnapshot_ {nullptr};
+    std::unordered_map<std::string, uint32_t> paramHandleMap_;
+    std::vector<std::string> paramHandleNames_;
+    std::unordered_map<std::string, uint32_t> switchHandleMap_;
+    std::vector<std::string> switchHandleNames_;
     std::vector<TimerResourceConfig> timerResConfigList_;
     std::unordered_map<std::string, std::vector<int32_t>> intervalListMap_;
     std::unordered_map<std::string, std::vector<int32_t>> ladderBatteryListMap_;
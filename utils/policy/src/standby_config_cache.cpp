@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "standby_config_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "standby_service_log.h"
+
+namespace OHOS {
+namespace DevStandbyMgr {
+namespace {
+    constexpr uint32_t CACHE_MAGIC = 0x43435342;  // "BSCC"
+    // bump when the layout of the cached config changes
+    constexpr uint32_t CACHE_FORMAT_VERSION = 2;
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+    constexpr uint32_t HASH_WORD_SHIFT = 29;
+    const std::string CACHE_TMP_SUFFIX = ".tmp";
+
+    struct ConfigCacheHeader {
+        uint32_t magic_ {0};
+        uint32_t formatVersion_ {0};
+        uint64_t fingerprint_ {0};
+        uint64_t payloadSize_ {0};
+        uint64_t checksum_ {0};
+    };
+
+    bool WriteAll(int32_t fd, const uint8_t* data, size_t size)
+    {
+        size_t written = 0;
+        while (written < size) {
+            ssize_t ret = write(fd, data + written, size - written);
+            if (ret <= 0) {
+                return false;
+            }
+            written += static_cast<size_t>(ret);
+        }
+        return true;
+    }
+
+    bool ReadFileContent(const std::string& filePath, std::string& content)
+    {
+        int32_t fd = open(filePath.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat fileStat {};
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size < 0) {
+            close(fd);
+            return false;
+        }
+        content.resize(static_cast<size_t>(fileStat.st_size));
+        size_t readSize = 0;
+        while (readSize < content.size()) {
+            ssize_t ret = read(fd, content.data() + readSize, content.size() - readSize);
+            if (ret <= 0) {
+                break;
+            }
+            readSize += static_cast<size_t>(ret);
+        }
+        close(fd);
+        content.resize(readSize);
+        return true;
+    }
+}
+
+void ConfigCacheWriter::WriteUint32(uint32_t value)
+{
+    Append(&value, sizeof(value));
+}
+
+void ConfigCacheWriter::WriteInt32(int32_t value)
+{
+    Append(&value, sizeof(value));
+}
+
+void ConfigCacheWriter::WriteBool(bool value)
+{
+    uint8_t byte = value ? 1 : 0;
+    Append(&byte, sizeof(byte));
+}
+
+void ConfigCacheWriter::WriteString(const std::string& value)
+{
+    WriteUint32(static_cast<uint32_t>(value.size()));
+    Append(value.data(), value.size());
+}
+
+void ConfigCacheWriter::WriteBytes(const std::vector<uint8_t>& value)
+{
+    WriteUint32(static_cast<uint32_t>(value.size()));
+    Append(value.data(), value.size());
+}
+
+const std::vector<uint8_t>& ConfigCacheWriter::GetPayload() const
+{
+    return payload_;
+}
+
+void ConfigCacheWriter::Append(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    payload_.insert(payload_.end(), bytes, bytes + size);
+}
+
+ConfigCacheReader::ConfigCacheReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+bool ConfigCacheReader::ReadUint32(uint32_t& value)
+{
+    return Read(&value, sizeof(value));
+}
+
+bool ConfigCacheReader::ReadInt32(int32_t& value)
+{
+    return Read(&value, sizeof(value));
+}
+
+bool ConfigCacheReader::ReadBool(bool& value)
+{
+    uint8_t byte = 0;
+    if (!Read(&byte, sizeof(byte)) || byte > 1) {
+        return false;
+    }
+    value = byte != 0;
+    return true;
+}
+
+bool ConfigCacheReader::ReadString(std::string& value)
+{
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    if (!ReadBytes(data, size)) {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char*>(data), size);
+    return true;
+}
+
+bool ConfigCacheReader::ReadBytes(const uint8_t*& data, size_t& size)
+{
+    uint32_t length = 0;
+    if (!ReadUint32(length) || length > GetRemainingSize()) {
+        return false;
+    }
+    data = data_ + pos_;
+    size = length;
+    pos_ += length;
+    return true;
+}
+
+size_t ConfigCacheReader::GetRemainingSize() const
+{
+    return size_ - pos_;
+}
+
+bool ConfigCacheReader::Read(void* data, size_t size)
+{
+    if (size > GetRemainingSize()) {
+        return false;
+    }
+    std::copy(data_ + pos_, data_ + pos_ + size, static_cast<uint8_t*>(data));
+    pos_ += size;
+    return true;
+}
+
+StandbyConfigCache::StandbyConfigCache(const std::string& cachePath)
+    : cachePath_(cachePath), fingerprint_(Hash(&CACHE_FORMAT_VERSION, sizeof(CACHE_FORMAT_VERSION),
+    FNV_OFFSET_BASIS)) {}
+
+void StandbyConfigCache::AddVersionSource(const std::string& version)
+{
+    AddContentSource(version);
+}
+
+void StandbyConfigCache::AddFileSource(const std::string& filePath)
+{
+    // mtime and size are not reliable, images of different versions may carry the same timestamp
+    std::string content;
+    if (!ReadFileContent(filePath, content)) {
+        STANDBYSERVICE_LOGW("failed to read config file %{public}s", filePath.c_str());
+    }
+    AddToFingerprint(filePath.data(), filePath.size());
+    AddContentSource(content);
+}
+
+void StandbyConfigCache::AddContentSource(const std::string& content)
+{
+    uint64_t contentSize = content.size();
+    AddToFingerprint(&contentSize, sizeof(contentSize));
+    AddToFingerprint(content.data(), content.size());
+}
+
+uint64_t StandbyConfigCache::GetFingerprint() const
+{
+    return fingerprint_;
+}
+
+bool StandbyConfigCache::Load(const std::function<bool(ConfigCacheReader&)>& decodeFunc)
+{
+    int32_t fd = open(cachePath_.c_str(), O_RDONLY);
+    if (fd < 0) {
+        STANDBYSERVICE_LOGI("standby config cache does not exist");
+        return false;
+    }
+    struct stat cacheStat {};
+    if (fstat(fd, &cacheStat) != 0 || cacheStat.st_size < static_cast<off_t>(sizeof(ConfigCacheHeader))) {
+        close(fd);
+        return false;
+    }
+    size_t cacheSize = static_cast<size_t>(cacheStat.st_size);
+    void* addr = mmap(nullptr, cacheSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        STANDBYSERVICE_LOGE("failed to map standby config cache");
+        return false;
+    }
+    const auto* data = static_cast<const uint8_t*>(addr);
+    ConfigCacheHeader header;
+    std::copy(data, data + sizeof(header), reinterpret_cast<uint8_t*>(&header));
+    const uint8_t* payload = data + sizeof(header);
+    bool isValid = header.magic_ == CACHE_MAGIC && header.formatVersion_ == CACHE_FORMAT_VERSION &&
+        header.fingerprint_ == fingerprint_ && header.payloadSize_ == cacheSize - sizeof(header) &&
+        header.checksum_ == Hash(payload, header.payloadSize_, FNV_OFFSET_BASIS);
+    if (isValid) {
+        ConfigCacheReader reader(payload, static_cast<size_t>(header.payloadSize_));
+        isValid = decodeFunc(reader) && reader.GetRemainingSize() == 0;
+    }
+    munmap(addr, cacheSize);
+    STANDBYSERVICE_LOGI("standby config cache is %{public}s", isValid ? "valid" : "stale");
+    return isValid;
+}
+
+bool StandbyConfigCache::Store(const std::vector<uint8_t>& payload)
+{
+    ConfigCacheHeader header;
+    header.magic_ = CACHE_MAGIC;
+    header.formatVersion_ = CACHE_FORMAT_VERSION;
+    header.fingerprint_ = fingerprint_;
+    header.payloadSize_ = payload.size();
+    header.checksum_ = Hash(payload.data(), payload.size(), FNV_OFFSET_BASIS);
+
+    std::string tmpPath = cachePath_ + CACHE_TMP_SUFFIX;
+    int32_t fd = open(tmpPath.c_str(), O_CREAT | O_WRONLY | O_TRUNC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        STANDBYSERVICE_LOGE("failed to create standby config cache");
+        return false;
+    }
+    bool ret = WriteAll(fd, reinterpret_cast<const uint8_t*>(&header), sizeof(header)) &&
+        WriteAll(fd, payload.data(), payload.size());
+    close(fd);
+    if (!ret || rename(tmpPath.c_str(), cachePath_.c_str()) != 0) {
+        STANDBYSERVICE_LOGE("failed to write standby config cache");
+        remove(tmpPath.c_str());
+        return false;
+    }
+    STANDBYSERVICE_LOGI("standby config cache is updated, size is %{public}d", static_cast<int32_t>(payload.size()));
+    return true;
+}
+
+uint64_t StandbyConfigCache::Hash(const void* data, size_t size, uint64_t seed)
+{
+    // FNV-1a over 8 byte words, config files are hashed on every boot so a byte loop is too slow
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed;
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= size; pos += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::copy(bytes + pos, bytes + pos + sizeof(word), reinterpret_cast<uint8_t*>(&word));
+        hash = (hash ^ word) * FNV_PRIME;
+        hash ^= hash >> HASH_WORD_SHIFT;
+    }
+    for (; pos < size; ++pos) {
+        hash = (hash ^ bytes[pos]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+void StandbyConfigCache::AddToFingerprint(const void* data, size_t size)
+{
+    fingerprint_ = Hash(data, size, fingerprint_);
+}
+}  // namespace DevStandbyMgr
+}  // namespace OHOS
@@ -15,6 +15,9 @@
 
 #include "standby_config_manager.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <string>
 #include <sstream>
@@ -25,6 +28,8 @@
 #include "config_policy_utils.h"
 #endif
 #include "json_utils.h"
+#include "parameters.h"
+#include "standby_config_cache.h"
 #include "standby_service_log.h"
 
 namespace OHOS {
@@ -37,6 +42,12 @@ namespace {
     const int32_t STRATEGY_CONFIG_INDEX = 6;
     const int32_t CLOUD_CONFIG_INDEX = 7;
     const char* EXT_CONFIG_LIB = "libsuspend_manager_service.z.so";
+    const std::string STANDBY_CONFIG_CACHE_PATH = "/data/service/el1/public/device_standby/standby_config_cache";
+    // the cached config is parsed by the code of this version, an update invalidates it even if configs are unchanged
+    const std::string SOFTWARE_VERSION_PARAM = "const.product.software.version";
+    const std::string TAG_LOADED_STANDBY = "standby";
+    const std::string TAG_LOADED_STRATEGY = "strategy";
+    const std::string TAG_LOADED_CLOUD = "cloud";
     const std::string TAG_PLUGIN_NAME = "plugin_name";
     const std::string TAG_STANDBY = "standby";
     const std::string TAG_MAINTENANCE_LIST = "maintenance_list";
@@ -77,6 +88,200 @@ namespace {
         {TAG_DAY_STANDBY, ConditionType::DAY_STANDBY},
         {TAG_NIGHT_STANDBY, ConditionType::NIGHT_STANDBY},
     };
+
+    void EncodeConfig(ConfigCacheWriter& writer, bool value)
+    {
+        writer.WriteBool(value);
+    }
+
+    void EncodeConfig(ConfigCacheWriter& writer, int32_t value)
+    {
+        writer.WriteInt32(value);
+    }
+
+    void EncodeConfig(ConfigCacheWriter& writer, uint32_t value)
+    {
+        writer.WriteUint32(value);
+    }
+
+    void EncodeConfig(ConfigCacheWriter& writer, const std::string& value)
+    {
+        writer.WriteString(value);
+    }
+
+    void EncodeConfig(ConfigCacheWriter& writer, const nlohmann::json& value)
+    {
+        writer.WriteBytes(nlohmann::json::to_msgpack(value));
+    }
+
+    bool DecodeConfig(ConfigCacheReader& reader, bool& value)
+    {
+        return reader.ReadBool(value);
+    }
+
+    bool DecodeConfig(ConfigCacheReader& reader, int32_t& value)
+    {
+        return reader.ReadInt32(value);
+    }
+
+    bool DecodeConfig(ConfigCacheReader& reader, uint32_t& value)
+    {
+        return reader.ReadUint32(value);
+    }
+
+    bool DecodeConfig(ConfigCacheReader& reader, std::string& value)
+    {
+        return reader.ReadString(value);
+    }
+
+    bool DecodeConfig(ConfigCacheReader& reader, nlohmann::json& value)
+    {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        if (!reader.ReadBytes(data, size)) {
+            return false;
+        }
+        value = nlohmann::json::from_msgpack(data, data + size, true, false);
+        return !value.is_discarded();
+    }
+
+    void EncodeConfig(ConfigCacheWriter& writer, const TimeLtdProcess& value);
+    void EncodeConfig(ConfigCacheWriter& writer, const DefaultResourceConfig& value);
+    void EncodeConfig(ConfigCacheWriter& writer, const TimerClockApp& value);
+    void EncodeConfig(ConfigCacheWriter& writer, const TimerResourceConfig& value);
+    bool DecodeConfig(ConfigCacheReader& reader, TimeLtdProcess& value);
+    bool DecodeConfig(ConfigCacheReader& reader, DefaultResourceConfig& value);
+    bool DecodeConfig(ConfigCacheReader& reader, TimerClockApp& value);
+    bool DecodeConfig(ConfigCacheReader& reader, TimerResourceConfig& value);
+
+    template<typename T>
+    void EncodeConfig(ConfigCacheWriter& writer, const std::vector<T>& values)
+    {
+        writer.WriteUint32(static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            EncodeConfig(writer, static_cast<const T&>(value));
+        }
+    }
+
+    template<typename T>
+    void EncodeConfig(ConfigCacheWriter& writer, const std::shared_ptr<T>& value)
+    {
+        EncodeConfig(writer, value == nullptr ? T {} : *value);
+    }
+
+    template<typename T>
+    void EncodeConfig(ConfigCacheWriter& writer, const std::unordered_map<std::string, T>& configMap)
+    {
+        writer.WriteUint32(static_cast<uint32_t>(configMap.size()));
+        for (const auto& [key, value] : configMap) {
+            writer.WriteString(key);
+            EncodeConfig(writer, value);
+        }
+    }
+
+    template<typename T>
+    bool DecodeConfig(ConfigCacheReader& reader, std::vector<T>& values)
+    {
+        uint32_t size = 0;
+        if (!reader.ReadUint32(size) || size > reader.GetRemainingSize()) {
+            return false;
+        }
+        values.clear();
+        values.reserve(size);
+        for (uint32_t i = 0; i < size; ++i) {
+            T value {};
+            if (!DecodeConfig(reader, value)) {
+                return false;
+            }
+            values.emplace_back(std::move(value));
+        }
+        return true;
+    }
+
+    template<typename T>
+    bool DecodeConfig(ConfigCacheReader& reader, std::shared_ptr<T>& value)
+    {
+        auto decodedValue = std::make_shared<T>();
+        if (!DecodeConfig(reader, *decodedValue)) {
+            return false;
+        }
+        value = std::move(decodedValue);
+        return true;
+    }
+
+    template<typename T>
+    bool DecodeConfig(ConfigCacheReader& reader, std::unordered_map<std::string, T>& configMap)
+    {
+        uint32_t size = 0;
+        if (!reader.ReadUint32(size) || size > reader.GetRemainingSize()) {
+            return false;
+        }
+        configMap.clear();
+        configMap.reserve(size);
+        for (uint32_t i = 0; i < size; ++i) {
+            std::string key;
+            T value {};
+            if (!reader.ReadString(key) || !DecodeConfig(reader, value)) {
+                return false;
+            }
+            configMap.emplace(std::move(key), std::move(value));
+        }
+        return true;
+    }
+
+    void EncodeConfig(ConfigCacheWriter& writer, const TimeLtdProcess& value)
+    {
+        writer.WriteString(value.name_);
+        writer.WriteInt32(value.maxDurationLim_);
+    }
+
+    void EncodeConfig(ConfigCacheWriter& writer, const DefaultResourceConfig& value)
+    {
+        writer.WriteBool(value.isAllow_);
+        EncodeConfig(writer, value.conditions_);
+        EncodeConfig(writer, value.processes_);
+        EncodeConfig(writer, value.apps_);
+        EncodeConfig(writer, value.timeLtdProcesses_);
+        EncodeConfig(writer, value.timeLtdApps_);
+    }
+
+    void EncodeConfig(ConfigCacheWriter& writer, const TimerClockApp& value)
+    {
+        writer.WriteString(value.name_);
+        writer.WriteInt32(value.timerPeriod_);
+        writer.WriteBool(value.isTimerClock_);
+    }
+
+    void EncodeConfig(ConfigCacheWriter& writer, const TimerResourceConfig& value)
+    {
+        writer.WriteBool(value.isAllow_);
+        EncodeConfig(writer, value.conditions_);
+        EncodeConfig(writer, value.timerClockApps_);
+    }
+
+    bool DecodeConfig(ConfigCacheReader& reader, TimeLtdProcess& value)
+    {
+        return reader.ReadString(value.name_) && reader.ReadInt32(value.maxDurationLim_);
+    }
+
+    bool DecodeConfig(ConfigCacheReader& reader, DefaultResourceConfig& value)
+    {
+        return reader.ReadBool(value.isAllow_) && DecodeConfig(reader, value.conditions_) &&
+            DecodeConfig(reader, value.processes_) && DecodeConfig(reader, value.apps_) &&
+            DecodeConfig(reader, value.timeLtdProcesses_) && DecodeConfig(reader, value.timeLtdApps_);
+    }
+
+    bool DecodeConfig(ConfigCacheReader& reader, TimerClockApp& value)
+    {
+        return reader.ReadString(value.name_) && reader.ReadInt32(value.timerPeriod_) &&
+            reader.ReadBool(value.isTimerClock_);
+    }
+
+    bool DecodeConfig(ConfigCacheReader& reader, TimerResourceConfig& value)
+    {
+        return reader.ReadBool(value.isAllow_) && DecodeConfig(reader, value.conditions_) &&
+            DecodeConfig(reader, value.timerClockApps_);
+    }
 }
 
 StandbyConfigManager::StandbyConfigManager() {}
@@ -91,78 +296,159 @@ std::shared_ptr<StandbyConfigManager> StandbyConfigManager::GetInstance()
 ErrCode StandbyConfigManager::Init()
 {
     STANDBYSERVICE_LOGI("start to read config");
+    auto startTime = std::chrono::steady_clock::now();
     std::lock_guard<std::mutex> lock(configMutex_);
     LoadGetExtConfigFunc();
-    GetAndParseStandbyConfig();
-    GetAndParseStrategyConfig();
-    if (NeedsToReadCloudConfig()) {
-        GetCloudConfig();
+    StandbyConfigCache configCache(STANDBY_CONFIG_CACHE_PATH);
+    std::vector<std::string> standbySourceList;
+    bool isStandbyContent = GetConfigSourceList(STANDBY_CONFIG_INDEX, STANDBY_CONFIG_PATH, standbySourceList);
+    AddConfigSourceList(configCache, isStandbyContent, standbySourceList);
+    std::vector<std::string> strategySourceList;
+    bool isStrategyContent = GetConfigSourceList(STRATEGY_CONFIG_INDEX, STRATEGY_CONFIG_PATH, strategySourceList);
+    AddConfigSourceList(configCache, isStrategyContent, strategySourceList);
+    std::string configCloud;
+    bool hasCloudConfig = getSingleExtConfigFunc_ != nullptr &&
+        getSingleExtConfigFunc_(CLOUD_CONFIG_INDEX, configCloud) == ERR_OK;
+    if (hasCloudConfig) {
+        configCache.AddContentSource(configCloud);
     }
+    configCache.AddVersionSource(system::GetParameter(SOFTWARE_VERSION_PARAM, ""));
+
+    bool isCacheHit = configCache.Load([this](ConfigCacheReader& reader) { return DecodeParsedConfig(reader); });
+    if (isCacheHit) {
+        UpdateStrategyList();
+        BuildResCtrlSnapshot();
+    } else {
+        ClearParsedConfig();
+        nlohmann::json loadedConfig = nlohmann::json::object();
+        loadedConfig[TAG_LOADED_STANDBY] = LoadConfigRootList(isStandbyContent, standbySourceList);
+        loadedConfig[TAG_LOADED_STRATEGY] = LoadConfigRootList(isStrategyContent, strategySourceList);
+        nlohmann::json cloudConfigRoot;
+        if (hasCloudConfig && NeedsToReadCloudConfig() &&
+            JsonUtils::LoadJsonValueFromContent(cloudConfigRoot, configCloud)) {
+            loadedConfig[TAG_LOADED_CLOUD] = cloudConfigRoot;
+        }
+        ApplyLoadedConfig(loadedConfig);
+        ConfigCacheWriter writer;
+        EncodeParsedConfig(writer);
+        configCache.Store(writer.GetPayload());
+    }
+    PublishConfigSnapshot();
+    auto costTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    STANDBYSERVICE_LOGI("read config cost %{public}lld ms, cache hit: %{public}d",
+        static_cast<long long>(costTime), isCacheHit);
     return ERR_OK;
 }
 
-void StandbyConfigManager::GetAndParseStandbyConfig()
+bool StandbyConfigManager::GetConfigSourceList(int32_t fileIndex, const std::string& relativeConfigPath,
+    std::vector<std::string>& sourceList)
 {
-    std::vector<std::string> configContentList;
-    if (getExtConfigFunc_ != nullptr && getExtConfigFunc_(STANDBY_CONFIG_INDEX, configContentList) == ERR_OK) {
-        for (const auto& content : configContentList) {
-            nlohmann::json devStandbyConfigRoot;
-            if (!JsonUtils::LoadJsonValueFromContent(devStandbyConfigRoot, content)) {
-                STANDBYSERVICE_LOGE("load config failed");
-                continue;
-            }
-            if (!ParseDeviceStanbyConfig(devStandbyConfigRoot)) {
-                STANDBYSERVICE_LOGE("parse config failed");
-            }
+    if (getExtConfigFunc_ != nullptr && getExtConfigFunc_(fileIndex, sourceList) == ERR_OK) {
+        return true;
+    }
+    sourceList = GetConfigFileList(relativeConfigPath);
+    return false;
+}
+
+void StandbyConfigManager::AddConfigSourceList(StandbyConfigCache& configCache, bool isContent,
+    const std::vector<std::string>& sourceList)
+{
+    for (const auto& source : sourceList) {
+        if (isContent) {
+            configCache.AddContentSource(source);
+        } else {
+            configCache.AddFileSource(source);
         }
-    } else {
-        std::vector<std::string> configFileList = GetConfigFileList(STANDBY_CONFIG_PATH);
-        for (const auto& configFile : configFileList) {
-            nlohmann::json devStandbyConfigRoot;
-            // if failed to load one json file, read next config file
-            if (!JsonUtils::LoadJsonValueFromFile(devStandbyConfigRoot, configFile)) {
-                STANDBYSERVICE_LOGE("load config file %{public}s failed", configFile.c_str());
-                continue;
-            }
-            if (!ParseDeviceStanbyConfig(devStandbyConfigRoot)) {
-                STANDBYSERVICE_LOGE("parse config file %{public}s failed", configFile.c_str());
-            }
+    }
+}
+
+nlohmann::json StandbyConfigManager::LoadConfigRootList(bool isContent, const std::vector<std::string>& sourceList)
+{
+    nlohmann::json configRootList = nlohmann::json::array();
+    for (const auto& source : sourceList) {
+        nlohmann::json configRoot;
+        // if failed to load one json file, read next config file
+        bool isLoaded = isContent ? JsonUtils::LoadJsonValueFromContent(configRoot, source) :
+            JsonUtils::LoadJsonValueFromFile(configRoot, source);
+        if (!isLoaded) {
+            STANDBYSERVICE_LOGE("load config %{public}s failed", isContent ? "content" : source.c_str());
+            continue;
         }
+        configRootList.emplace_back(std::move(configRoot));
     }
-    UpdateStrategyList();
+    return configRootList;
 }
 
-void StandbyConfigManager::GetAndParseStrategyConfig()
+void StandbyConfigManager::ApplyLoadedConfig(const nlohmann::json& loadedConfig)
 {
-    std::vector<std::string> configContentList;
-    if (getExtConfigFunc_ != nullptr && getExtConfigFunc_(STRATEGY_CONFIG_INDEX, configContentList) == ERR_OK) {
-        for (const auto& content : configContentList) {
-            nlohmann::json resCtrlConfigRoot;
-            if (!JsonUtils::LoadJsonValueFromContent(resCtrlConfigRoot, content)) {
-                STANDBYSERVICE_LOGE("load config failed");
-                continue;
-            }
-            if (!ParseResCtrlConfig(resCtrlConfigRoot)) {
-                STANDBYSERVICE_LOGE("parse config failed");
-            }
+    for (const auto& devStandbyConfigRoot : loadedConfig[TAG_LOADED_STANDBY]) {
+        if (!ParseDeviceStanbyConfig(devStandbyConfigRoot)) {
+            STANDBYSERVICE_LOGE("parse config failed");
         }
-    } else {
-        std::vector<std::string> configFileList = GetConfigFileList(STRATEGY_CONFIG_PATH);
-        for (const auto& configFile : configFileList) {
-            nlohmann::json resCtrlConfigRoot;
-            if (!JsonUtils::LoadJsonValueFromFile(resCtrlConfigRoot, configFile)) {
-                STANDBYSERVICE_LOGE("load config file %{public}s failed", configFile.c_str());
-                continue;
-            }
-            if (!ParseResCtrlConfig(resCtrlConfigRoot)) {
-                STANDBYSERVICE_LOGE("parse config file %{public}s failed", configFile.c_str());
-            }
+    }
+    UpdateStrategyList();
+    for (const auto& resCtrlConfigRoot : loadedConfig[TAG_LOADED_STRATEGY]) {
+        if (!ParseResCtrlConfig(resCtrlConfigRoot)) {
+            STANDBYSERVICE_LOGE("parse config failed");
         }
     }
+    if (loadedConfig.contains(TAG_LOADED_CLOUD)) {
+        ParseCloudConfig(loadedConfig[TAG_LOADED_CLOUD]);
+        UpdateStrategyList();
+    }
+}
+
+void StandbyConfigManager::EncodeParsedConfig(ConfigCacheWriter& writer)
+{
+    EncodeConfig(writer, pluginName_);
+    EncodeConfig(writer, standbySwitchMap_);
+    EncodeConfig(writer, standbyParaMap_);
+    EncodeConfig(writer, strategySwitchMap_);
+    EncodeConfig(writer, strategyListMap_);
+    EncodeConfig(writer, halfhourSwitchMap_);
+    EncodeConfig(writer, defaultResourceConfigMap_);
+    EncodeConfig(writer, timerResConfigList_);
+    EncodeConfig(writer, intervalListMap_);
+    EncodeConfig(writer, ladderBatteryListMap_);
+    EncodeConfig(writer, pkgTypeMap_);
+    EncodeConfig(writer, standbyStrategyConfigMap_);
+    EncodeConfig(writer, standbyListParaMap_);
+    EncodeConfig(writer, mxStandbyConfigMap_);
+}
+
+bool StandbyConfigManager::DecodeParsedConfig(ConfigCacheReader& reader)
+{
+    return DecodeConfig(reader, pluginName_) && DecodeConfig(reader, standbySwitchMap_) &&
+        DecodeConfig(reader, standbyParaMap_) && DecodeConfig(reader, strategySwitchMap_) &&
+        DecodeConfig(reader, strategyListMap_) && DecodeConfig(reader, halfhourSwitchMap_) &&
+        DecodeConfig(reader, defaultResourceConfigMap_) && DecodeConfig(reader, timerResConfigList_) &&
+        DecodeConfig(reader, intervalListMap_) && DecodeConfig(reader, ladderBatteryListMap_) &&
+        DecodeConfig(reader, pkgTypeMap_) && DecodeConfig(reader, standbyStrategyConfigMap_) &&
+        DecodeConfig(reader, standbyListParaMap_) && DecodeConfig(reader, mxStandbyConfigMap_);
+}
+
+void StandbyConfigManager::ClearParsedConfig()
+{
+    pluginName_.clear();
+    standbySwitchMap_.clear();
+    standbyParaMap_.clear();
+    strategySwitchMap_.clear();
+    strategyListMap_.clear();
+    halfhourSwitchMap_.clear();
+    defaultResourceConfigMap_.clear();
+    timerResConfigList_.clear();
+    intervalListMap_.clear();
+    ladderBatteryListMap_.clear();
+    pkgTypeMap_.clear();
+    standbyStrategyConfigMap_.clear();
+    standbyListParaMap_.clear();
+    mxStandbyConfigMap_.clear();
 }
 
 void StandbyConfigManager::GetCloudConfig()
 {
+    std::lock_guard<std::mutex> lock(configMutex_);
     if (getSingleExtConfigFunc_ == nullptr) {
         return;
     }
@@ -176,6 +462,7 @@ void StandbyConfigManager::GetCloudConfig()
         STANDBYSERVICE_LOGE("Decrypt errcode: %{public}d.", returnCode);
     }
     UpdateStrategyList();
+    PublishConfigSnapshot();
 }
 
 void StandbyConfigManager::ParseCloudConfig(const nlohmann::json& devConfigRoot)
@@ -380,47 +667,126 @@ const std::string& StandbyConfigManager::GetPluginName()
 
 nlohmann::json StandbyConfigManager::GetDefaultConfig(const std::string& configName)
 {
-    return GetConfigWithName(configName, standbyStrategyConfigMap_);
+    return GetConfigWithName(configName, &StandbyConfigSnapshot::standbyStrategyConfigMap_);
 }
 
 bool StandbyConfigManager::GetStandbySwitch(const std::string& switchName)
 {
-    return GetConfigWithName(switchName, standbySwitchMap_);
+    return GetConfigWithName(switchName, &StandbyConfigSnapshot::standbySwitchMap_);
 }
 
 int32_t StandbyConfigManager::GetStandbyParam(const std::string& paramName)
 {
-    return GetConfigWithName(paramName, standbyParaMap_);
+    return GetConfigWithName(paramName, &StandbyConfigSnapshot::standbyParaMap_);
 }
 
 bool StandbyConfigManager::GetStrategySwitch(const std::string& switchName)
 {
-    return GetConfigWithName(switchName, strategySwitchMap_);
+    return GetConfigWithName(switchName, &StandbyConfigSnapshot::strategySwitchMap_);
 }
 
 bool StandbyConfigManager::GetHalfHourSwitch(const std::string& switchName)
 {
-    return GetConfigWithName(switchName, halfhourSwitchMap_);
+    return GetConfigWithName(switchName, &StandbyConfigSnapshot::halfhourSwitchMap_);
+}
+
+uint32_t StandbyConfigManager::GetParamHandle(const std::string& paramName)
+{
+    return GetConfigHandle(paramName, paramHandleMap_, paramHandleNames_);
+}
+
+uint32_t StandbyConfigManager::GetSwitchHandle(const std::string& switchName)
+{
+    return GetConfigHandle(switchName, switchHandleMap_, switchHandleNames_);
+}
+
+uint32_t StandbyConfigManager::GetConfigHandle(const std::string& name,
+    std::unordered_map<std::string, uint32_t>& handleMap, std::vector<std::string>& handleNames)
+{
+    std::lock_guard<std::mutex> lock(configMutex_);
+    auto iter = handleMap.find(name);
+    if (iter != handleMap.end()) {
+        return iter->second;
+    }
+    uint32_t handle = static_cast<uint32_t>(handleNames.size());
+    handleNames.emplace_back(name);
+    handleMap.emplace(name, handle);
+    PublishConfigSnapshot();
+    return handle;
+}
+
+int32_t StandbyConfigManager::GetStandbyParamByHandle(uint32_t paramHandle)
+{
+    auto snapshot = std::atomic_load(&configSnapshot_);
+    if (snapshot == nullptr || paramHandle >= snapshot->paramValues_.size()) {
+        return 0;
+    }
+    return snapshot->paramValues_[paramHandle];
+}
+
+bool StandbyConfigManager::GetStandbySwitchByHandle(uint32_t switchHandle)
+{
+    auto snapshot = std::atomic_load(&configSnapshot_);
+    if (snapshot == nullptr || switchHandle >= snapshot->switchValues_.size()) {
+        return false;
+    }
+    return snapshot->switchValues_[switchHandle];
+}
+
+void StandbyConfigManager::PublishConfigSnapshot()
+{
+    auto snapshot = std::make_shared<StandbyConfigSnapshot>();
+    snapshot->standbySwitchMap_ = standbySwitchMap_;
+    snapshot->standbyParaMap_ = standbyParaMap_;
+    snapshot->strategySwitchMap_ = strategySwitchMap_;
+    snapshot->strategyListMap_ = strategyListMap_;
+    snapshot->halfhourSwitchMap_ = halfhourSwitchMap_;
+    snapshot->defaultResourceConfigMap_.insert(defaultResourceConfigMap_.begin(), defaultResourceConfigMap_.end());
+    snapshot->intervalListMap_ = intervalListMap_;
+    snapshot->ladderBatteryListMap_ = ladderBatteryListMap_;
+    snapshot->pkgTypeMap_ = pkgTypeMap_;
+    snapshot->standbyStrategyConfigMap_ = standbyStrategyConfigMap_;
+    for (const auto& [paramName, standbyList] : standbyListParaMap_) {
+        snapshot->standbyListParaMap_.emplace(paramName, std::make_shared<const std::vector<std::string>>(standbyList));
+    }
+    snapshot->paramValues_.reserve(paramHandleNames_.size());
+    for (const auto& paramName : paramHandleNames_) {
+        auto iter = standbyParaMap_.find(paramName);
+        snapshot->paramValues_.emplace_back(iter == standbyParaMap_.end() ? 0 : iter->second);
+    }
+    snapshot->switchValues_.reserve(switchHandleNames_.size());
+    for (const auto& switchName : switchHandleNames_) {
+        auto iter = standbySwitchMap_.find(switchName);
+        snapshot->switchValues_.emplace_back(iter == standbySwitchMap_.end() ? false : iter->second);
+    }
+    std::atomic_store(&configSnapshot_, std::shared_ptr<const StandbyConfigSnapshot>(std::move(snapshot)));
 }
 
-std::shared_ptr<std::vector<DefaultResourceConfig>> StandbyConfigManager::GetResCtrlConfig(const
+std::shared_ptr<const std::vector<DefaultResourceConfig>> StandbyConfigManager::GetResCtrlConfig(const
     std::string& switchName)
 {
-    return GetConfigWithName(switchName, defaultResourceConfigMap_);
+    return GetConfigWithName(switchName, &StandbyConfigSnapshot::defaultResourceConfigMap_);
 }
 
-std::vector<std::string> StandbyConfigManager::GetStandbyListPara(const std::string& paramName)
+std::shared_ptr<const std::vector<std::string>> StandbyConfigManager::GetStandbyListPara(
+    const std::string& paramName)
 {
-    return GetConfigWithName(paramName, standbyListParaMap_);
+    static const auto emptyList = std::make_shared<const std::vector<std::string>>();
+    auto standbyList = GetConfigWithName(paramName, &StandbyConfigSnapshot::standbyListParaMap_);
+    return standbyList == nullptr ? emptyList : standbyList;
 }
 
 template<typename T>
 T StandbyConfigManager::GetConfigWithName(const std::string& switchName,
-    std::unordered_map<std::string, T>& configMap)
+    std::unordered_map<std::string, T> StandbyConfigSnapshot::* configMap)
 {
-    std::lock_guard<std::mutex> lock(configMutex_);
-    auto iter = configMap.find(switchName);
-    if (iter == configMap.end()) {
+    auto snapshot = std::atomic_load(&configSnapshot_);
+    if (snapshot == nullptr) {
+        return T{};
+    }
+    const auto& config = (*snapshot).*configMap;
+    auto iter = config.find(switchName);
+    if (iter == config.end()) {
         STANDBYSERVICE_LOGD("failed to find config %{public}s", switchName.c_str());
         return T{};
     }
@@ -434,7 +800,7 @@ const std::vector<TimerResourceConfig>& StandbyConfigManager::GetTimerResConfig(
 
 bool StandbyConfigManager::GetStrategyConfigList(const std::string& switchName)
 {
-    return GetConfigWithName(switchName, strategyListMap_);
+    return GetConfigWithName(switchName, &StandbyConfigSnapshot::strategyListMap_);
 }
 
 const std::vector<std::string>& StandbyConfigManager::GetStrategyConfigList()
@@ -444,12 +810,12 @@ const std::vector<std::string>& StandbyConfigManager::GetStrategyConfigList()
 
 std::vector<int32_t> StandbyConfigManager::GetStandbyDurationList(const std::string& switchName)
 {
-    return GetConfigWithName(switchName, intervalListMap_);
+    return GetConfigWithName(switchName, &StandbyConfigSnapshot::intervalListMap_);
 }
 
 std::vector<std::string> StandbyConfigManager::GetStandbyPkgTypeList(const std::string& switchName)
 {
-    return GetConfigWithName(switchName, pkgTypeMap_);
+    return GetConfigWithName(switchName, &StandbyConfigSnapshot::pkgTypeMap_);
 }
 
 const std::unordered_map<std::string, nlohmann::json>& StandbyConfigManager::GetMxStandbyConfig()
@@ -460,82 +826,110 @@ const std::unordered_map<std::string, nlohmann::json>& StandbyConfigManager::Get
 int32_t StandbyConfigManager::GetMaxDuration(const std::string& name, const std::string& paramName,
     uint32_t condition, bool isApp)
 {
-    auto eligibleAllowTimeList = GetEligibleAllowTimeConfig(paramName, condition, true, isApp);
-    auto findConfigTask = [&name](const auto& it) { return it.name_ == name; };
-    auto it = std::find_if(eligibleAllowTimeList.begin(), eligibleAllowTimeList.end(), findConfigTask);
-    if (it == eligibleAllowTimeList.end()) {
+    auto eligibleConfig = FindEligibleResCtrlConfig(paramName, condition, true, isApp);
+    if (eligibleConfig == nullptr) {
         return 0;
-    } else {
-        return it->maxDurationLim_;
     }
+    auto iter = eligibleConfig->maxDurations_.find(name);
+    if (iter == eligibleConfig->maxDurations_.end()) {
+        return 0;
+    }
+    return iter->second;
 }
 
 std::vector<int32_t> StandbyConfigManager::GetStandbyLadderBatteryList(const std::string& switchName)
 {
-    return GetConfigWithName(switchName, ladderBatteryListMap_);
+    return GetConfigWithName(switchName, &StandbyConfigSnapshot::ladderBatteryListMap_);
 }
 
-template<typename T> std::set<T> StandbyConfigManager::GetEligibleAllowConfig(const std::string& paramName,
-    uint32_t condition, bool isAllow, bool isApp, const std::function<void(bool, std::set<T>&,
-    const DefaultResourceConfig&)>& func)
+std::shared_ptr<const EligibleResCtrlConfig> StandbyConfigManager::FindEligibleResCtrlConfig(
+    const std::string& paramName, uint32_t condition, bool isAllow, bool isApp)
 {
-    std::lock_guard<std::mutex> lock(configMutex_);
-    if (defaultResourceConfigMap_.find(paramName) == defaultResourceConfigMap_.end()) {
-        return {};
+    auto snapshot = std::atomic_load(&resCtrlSnapshot_);
+    if (snapshot == nullptr) {
+        return nullptr;
     }
-    std::set<T> eligibleResCtrlConfig;
-    const auto& resCtrlConfig = *(defaultResourceConfigMap_.find(paramName)->second);
-    STANDBYSERVICE_LOGD("find duration from %{public}s, size is %{public}d",
-        paramName.c_str(), static_cast<int32_t>(resCtrlConfig.size()));
-    for (const auto& config : resCtrlConfig) {
-        if (config.isAllow_ != isAllow) {
-            continue;
-        }
-        bool isEligiable {false};
-        for (const auto configCondition : config.conditions_) {
-            if ((condition & configCondition) == configCondition) {
-                isEligiable = true;
-                break;
-            }
-        }
-        if (!isEligiable) {
-            continue;
-        }
-        func(isApp, eligibleResCtrlConfig, config);
+    auto iter = snapshot->configMap_.find(paramName);
+    if (iter == snapshot->configMap_.end()) {
+        return nullptr;
     }
-    STANDBYSERVICE_LOGD("eligibleResCtrlConfig size is %{public}d",
-        static_cast<int32_t>(eligibleResCtrlConfig.size()));
-    return eligibleResCtrlConfig;
+    // share ownership with the snapshot, so the result stays valid after a newer snapshot is published
+    return std::shared_ptr<const EligibleResCtrlConfig>(snapshot,
+        &iter->second[ResCtrlConfigSnapshot::GetSlot(condition, isAllow, isApp)]);
 }
 
 std::set<TimeLtdProcess> StandbyConfigManager::GetEligibleAllowTimeConfig(const std::string& paramName,
     uint32_t condition, bool isAllow, bool isApp)
 {
-    auto func = [](bool isApp, std::set<TimeLtdProcess>& eligibleResCtrlConfig,
-        const DefaultResourceConfig& config) {
-        if (isApp) {
-            eligibleResCtrlConfig.insert(config.timeLtdApps_.begin(), config.timeLtdApps_.end());
-        } else {
-            eligibleResCtrlConfig.insert(config.timeLtdProcesses_.begin(), config.timeLtdProcesses_.end());
-        }
-        STANDBYSERVICE_LOGD("after calculate, eligible size is %{public}d",
-            static_cast<int32_t>(eligibleResCtrlConfig.size()));
-    };
-    return GetEligibleAllowConfig<TimeLtdProcess>(paramName, condition, isAllow, isApp, func);
+    auto eligibleConfig = FindEligibleResCtrlConfig(paramName, condition, isAllow, isApp);
+    if (eligibleConfig == nullptr) {
+        return {};
+    }
+    std::set<TimeLtdProcess> eligibleResCtrlConfig;
+    for (const auto& [name, maxDuration] : eligibleConfig->maxDurations_) {
+        eligibleResCtrlConfig.emplace(TimeLtdProcess {name, maxDuration});
+    }
+    return eligibleResCtrlConfig;
 }
 
 std::set<std::string> StandbyConfigManager::GetEligiblePersistAllowConfig(const std::string& paramName,
     uint32_t condition, bool isAllow, bool isApp)
 {
-    auto func = [](bool isApp, std::set<std::string>& eligibleResCtrlConfig,
-        const DefaultResourceConfig& config) {
-        if (isApp) {
-            eligibleResCtrlConfig.insert(config.apps_.begin(), config.apps_.end());
-        } else {
-            eligibleResCtrlConfig.insert(config.processes_.begin(), config.processes_.end());
+    auto eligibleConfig = FindEligibleResCtrlConfig(paramName, condition, isAllow, isApp);
+    if (eligibleConfig == nullptr) {
+        return {};
+    }
+    return std::set<std::string>(eligibleConfig->persistAllowList_.begin(), eligibleConfig->persistAllowList_.end());
+}
+
+std::shared_ptr<const std::vector<std::string>> StandbyConfigManager::GetEligiblePersistAllowList(
+    const std::string& paramName, uint32_t condition, bool isAllow, bool isApp)
+{
+    auto eligibleConfig = FindEligibleResCtrlConfig(paramName, condition, isAllow, isApp);
+    if (eligibleConfig == nullptr) {
+        return nullptr;
+    }
+    return std::shared_ptr<const std::vector<std::string>>(eligibleConfig, &eligibleConfig->persistAllowList_);
+}
+
+void StandbyConfigManager::BuildResCtrlSnapshot()
+{
+    auto snapshot = std::make_shared<ResCtrlConfigSnapshot>();
+    for (const auto& [paramName, resCtrlConfigPtr] : defaultResourceConfigMap_) {
+        if (resCtrlConfigPtr == nullptr) {
+            continue;
         }
-    };
-    return GetEligibleAllowConfig<std::string>(paramName, condition, isAllow, isApp, func);
+        auto& eligibleConfigs = snapshot->configMap_[paramName];
+        for (uint32_t condition = 0; condition <= ResCtrlConfigSnapshot::CONDITION_MASK; ++condition) {
+            for (const auto& config : *resCtrlConfigPtr) {
+                bool isEligiable = std::any_of(config.conditions_.begin(), config.conditions_.end(),
+                    [condition](uint32_t configCondition) { return (condition & configCondition) == configCondition; });
+                if (!isEligiable) {
+                    continue;
+                }
+                for (bool isApp : {false, true}) {
+                    auto& eligibleConfig = eligibleConfigs[ResCtrlConfigSnapshot::GetSlot(condition,
+                        config.isAllow_, isApp)];
+                    // the first config of a name wins, the same as inserting into a set ordered by name
+                    for (const auto& timeLtdProcess : (isApp ? config.timeLtdApps_ : config.timeLtdProcesses_)) {
+                        eligibleConfig.maxDurations_.emplace(timeLtdProcess.name_, timeLtdProcess.maxDurationLim_);
+                    }
+                    const auto& persistList = isApp ? config.apps_ : config.processes_;
+                    eligibleConfig.persistAllowList_.insert(eligibleConfig.persistAllowList_.end(),
+                        persistList.begin(), persistList.end());
+                }
+            }
+        }
+        for (auto& eligibleConfig : eligibleConfigs) {
+            auto& persistAllowList = eligibleConfig.persistAllowList_;
+            std::sort(persistAllowList.begin(), persistAllowList.end());
+            persistAllowList.erase(std::unique(persistAllowList.begin(), persistAllowList.end()),
+                persistAllowList.end());
+        }
+    }
+    STANDBYSERVICE_LOGI("resource control config snapshot is rebuilt, size is %{public}d",
+        static_cast<int32_t>(snapshot->configMap_.size()));
+    std::atomic_store(&resCtrlSnapshot_, std::shared_ptr<const ResCtrlConfigSnapshot>(std::move(snapshot)));
 }
 
 bool StandbyConfigManager::ParseDeviceStanbyConfig(const nlohmann::json& devStandbyConfigRoot)
@@ -744,6 +1138,8 @@ bool StandbyConfigManager::ParseResCtrlConfig(const nlohmann::json& resCtrlConfi
             continue;
         }
     }
+    BuildResCtrlSnapshot();
+    PublishConfigSnapshot();
     return ret;
 }
 
@@ -928,6 +1324,7 @@ void StandbyConfigManager::DumpSetDebugMode(bool debugMode)
         backStandbySwitchMap_.clear();
         backStandbyParaMap_.clear();
     }
+    PublishConfigSnapshot();
 }
 
 void StandbyConfigManager::DumpSetSwitch(const std::string& switchName, bool switchStatus, std::string& result)
@@ -939,6 +1336,7 @@ void StandbyConfigManager::DumpSetSwitch(const std::string& switchName, bool swi
         return;
     }
     iter->second = switchStatus;
+    PublishConfigSnapshot();
 }
 
 void StandbyConfigManager::DumpSetParameter(const std::string& paramName, int32_t paramValue, std::string& result)
@@ -950,6 +1348,7 @@ void StandbyConfigManager::DumpSetParameter(const std::string& paramName, int32_
         return;
     }
     iter->second = paramValue;
+    PublishConfigSnapshot();
 }
 
 void StandbyConfigManager::DumpStandbyConfigInfo(std::string& result)